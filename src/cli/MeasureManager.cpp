@@ -33,6 +33,8 @@
 #include <json/value.h>
 #include <pugixml.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <utility>  // make_pair
 #include <condition_variable>
 #include <mutex>
@@ -90,6 +92,15 @@ boost::optional<bool> get_field(const web::json::value& body, const std::string&
   return boost::none;
 }
 
+template <>
+boost::optional<double> get_field(const web::json::value& body, const std::string& field_name) {
+  auto key = utility::conversions::to_string_t(field_name);
+  if (body.has_number_field(key)) {
+    return body.at(key).as_double();
+  }
+  return boost::none;
+}
+
 template <typename T>
 T get_field(const web::json::value& body, const std::string& field_name, const T& defaultValue) {}
 
@@ -136,11 +147,39 @@ MeasureManager::MeasureManager(ScriptEngineInstance& t_rubyEngine, ScriptEngineI
 // {
 // }
 
+void LatencyStats::add(double seconds) {
+  ++count;
+  totalSeconds += seconds;
+  maxSeconds = std::max(maxSeconds, seconds);
+}
+
+Json::Value LatencyStats::toJSON() const {
+  Json::Value result(Json::objectValue);
+  result["count"] = Json::UInt64(count);
+  result["total_seconds"] = totalSeconds;
+  result["mean_seconds"] = (count > 0) ? totalSeconds / static_cast<double>(count) : 0.0;
+  result["max_seconds"] = maxSeconds;
+  return result;
+}
+
+Json::Value ModelCacheStats::toJSON() const {
+  Json::Value result(Json::objectValue);
+  result["hits"] = Json::UInt64(hits);
+  result["misses"] = Json::UInt64(misses);
+  result["joined"] = Json::UInt64(joined);
+  result["evictions"] = Json::UInt64(evictions);
+  result["failed"] = Json::UInt64(failed);
+  result["loads"] = loads.toJSON();
+  return result;
+}
+
 Json::Value MeasureManager::internalState() const {
   Json::Value result(Json::objectValue);
 
+  std::lock_guard<std::mutex> lock(m_mutex);
+
   Json::Value osms(Json::arrayValue);
-  for (const auto& [k, v] : m_osms) {
+  for (const auto& [k, v] : m_osms.infos) {
     Json::Value osmInfo(Json::objectValue);
     osmInfo["osm_path"] = k.generic_string();
     osmInfo["checksum"] = v.checksum;
@@ -149,7 +188,7 @@ Json::Value MeasureManager::internalState() const {
   result["osms"] = std::move(osms);
 
   Json::Value idfs(Json::arrayValue);
-  for (const auto& [k, v] : m_idfs) {
+  for (const auto& [k, v] : m_idfs.infos) {
     Json::Value idfInfo(Json::objectValue);
     idfInfo["idf_path"] = k.generic_string();
     idfInfo["checksum"] = v.checksum;
@@ -183,10 +222,21 @@ Json::Value MeasureManager::internalState() const {
   }
   // result["measure_info"] = std::move(measureInfos);
 
+  auto& stats = result["stats"];
+  stats["osms"] = m_osms.stats.toJSON();
+  stats["idfs"] = m_idfs.stats.toJSON();
+  stats["model_cache_file_bytes"] = Json::UInt64(m_cachedFileBytes);
+  stats["model_cache_file_budget"] = Json::UInt64(m_modelCacheFileBudget);
+
   return result;
 }
 
 size_t MeasureManager::clearMeasureInfoForOsmorIdfPath(const openstudio::path& osmOrIdfPath) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return clearMeasureInfoForOsmorIdfPathImpl(osmOrIdfPath);
+}
+
+size_t MeasureManager::clearMeasureInfoForOsmorIdfPathImpl(const openstudio::path& osmOrIdfPath) {
   size_t totalRemoved = 0;
   for (auto& [key, value] : m_measures) {
     totalRemoved += value.measureInfos.erase(osmOrIdfPath);
@@ -194,95 +244,170 @@ size_t MeasureManager::clearMeasureInfoForOsmorIdfPath(const openstudio::path& o
   return totalRemoved;
 }
 
-boost::optional<OSMInfo> MeasureManager::getModel(const openstudio::path& osmPath, bool force_reload) {
-
-  if (!openstudio::filesystem::is_regular_file(osmPath)) {
-    fmt::print("Model '{}' does not exist\n", osmPath.generic_string());
-    m_osms.erase(osmPath);
-    clearMeasureInfoForOsmorIdfPath(osmPath);
-    return boost::none;
+void MeasureManager::eraseCachedFile(const openstudio::path& osmOrIdfPath) {
+  m_osms.infos.erase(osmOrIdfPath);
+  m_idfs.infos.erase(osmOrIdfPath);
+  auto it = m_lruIndex.find(osmOrIdfPath.string());
+  if (it != m_lruIndex.end()) {
+    m_cachedFileBytes -= it->second->second;
+    m_lru.erase(it->second);
+    m_lruIndex.erase(it);
   }
+}
 
-  OSMInfo current;
-  current.checksum = openstudio::checksum(osmPath);
-
-  if (!force_reload) {
-    auto it = m_osms.find(osmPath);
-    if (it != m_osms.end()) {
-      auto& cached = it->second;
-      if (current.checksum == cached.checksum) {
-        fmt::print("Using cached model {}\n", osmPath.generic_string());
-        return cached;
-      } else {
-        fmt::print("Checksum of cached model does not match current checksum for '{}'\n", osmPath.generic_string());
-      }
-    }
+void MeasureManager::touchCachedFile(const openstudio::path& osmOrIdfPath, std::uintmax_t fileSize) {
+  auto [it, inserted] = m_lruIndex.try_emplace(osmOrIdfPath.string());
+  if (inserted) {
+    m_lru.emplace_front(osmOrIdfPath, fileSize);
+  } else {
+    m_cachedFileBytes -= it->second->second;
+    it->second->second = fileSize;
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
   }
+  it->second = m_lru.begin();
+  m_cachedFileBytes += fileSize;
+}
 
-  clearMeasureInfoForOsmorIdfPath(osmPath);
-
-  fmt::print("Attempting to load model '{}'\n", osmPath.generic_string());
-  openstudio::osversion::VersionTranslator vt;
-  if (auto model_ = vt.loadModel(osmPath)) {
-    fmt::print("Successfully loaded model '{}'\n", osmPath.generic_string());
-    current.model = std::move(*model_);
-    openstudio::energyplus::ForwardTranslator ft;
-    current.workspace = ft.translateModel(current.model);
-    auto [it, ok] = m_osms.insert_or_assign(osmPath, std::move(current));
-    return it->second;
+void MeasureManager::evictCachedFiles() {
+  while ((m_cachedFileBytes > m_modelCacheFileBudget) && (m_lru.size() > 1)) {
+    const auto [osmOrIdfPath, fileSize] = m_lru.back();
+    m_lruIndex.erase(osmOrIdfPath.string());
+    m_lru.pop_back();
+    m_cachedFileBytes -= fileSize;
+    // The OSMeasureInfos computed with it are kept, they are cleared if the file is loaded again
+    if (m_osms.infos.erase(osmOrIdfPath) > 0) {
+      ++m_osms.stats.evictions;
+    }
+    if (m_idfs.infos.erase(osmOrIdfPath) > 0) {
+      ++m_idfs.stats.evictions;
+    }
+    fmt::print("Dropped cached '{}' to stay within the model cache budget\n", osmOrIdfPath.generic_string());
   }
-
-  fmt::print("Failed to load model '{}'\n", osmPath.generic_string());
-  m_osms.erase(osmPath);
-
-  return boost::none;
 }
 
-boost::optional<IDFInfo> MeasureManager::getIdf(const openstudio::path& idfPath, bool force_reload) {
+template <typename Info>
+boost::optional<Info> MeasureManager::getOrLoad(const openstudio::path& path, bool force_reload, CachedFiles<Info>& cache, const char* kind,
+                                                const std::function<boost::optional<Info>(const openstudio::path&)>& load) {
 
-  if (!openstudio::filesystem::is_regular_file(idfPath)) {
-    fmt::print("Idf '{}' does not exist\n", idfPath.generic_string());
-    m_idfs.erase(idfPath);
-    clearMeasureInfoForOsmorIdfPath(idfPath);
+  if (!openstudio::filesystem::is_regular_file(path)) {
+    fmt::print("{} '{}' does not exist\n", kind, path.generic_string());
+    std::lock_guard<std::mutex> lock(m_mutex);
+    eraseCachedFile(path);
+    clearMeasureInfoForOsmorIdfPathImpl(path);
     return boost::none;
   }
 
-  IDFInfo current;
-  current.checksum = openstudio::checksum(idfPath);
-
-  if (!force_reload) {
-    auto it = m_idfs.find(idfPath);
-    if (it != m_idfs.end()) {
-      auto& cached = it->second;
-      if (current.checksum == cached.checksum) {
-        fmt::print("Using cached workspace {}\n", idfPath.generic_string());
-        return cached;
-      } else {
-        fmt::print("Checksum of cached workspace does not match current checksum for '{}'\n", idfPath.generic_string());
+  // Outside of the lock, reading the file is what takes time on a cache hit
+  const std::string checksum = m_fileChecksums.checksum(path);
+  boost::system::error_code ec;
+  const std::uintmax_t fileSize = openstudio::filesystem::file_size(path, ec);
+
+  std::shared_future<boost::optional<Info>> loading;
+  std::promise<boost::optional<Info>> promise;
+  size_t generation = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto itLoading = cache.loading.find(path);
+    if (itLoading != cache.loading.end()) {
+      ++cache.stats.joined;
+      loading = itLoading->second;
+    } else {
+      if (!force_reload) {
+        auto it = cache.infos.find(path);
+        if (it != cache.infos.end()) {
+          if (checksum == it->second.checksum) {
+            ++cache.stats.hits;
+            touchCachedFile(path, fileSize);
+            fmt::print("Using cached {} {}\n", kind, path.generic_string());
+            return it->second;
+          } else {
+            fmt::print("Checksum of cached {} does not match current checksum for '{}'\n", kind, path.generic_string());
+          }
+        }
       }
+      ++cache.stats.misses;
+      cache.loading.emplace(path, promise.get_future().share());
+      generation = m_generation;
     }
   }
 
-  clearMeasureInfoForOsmorIdfPath(idfPath);
-
-  fmt::print("Attempting to load idf '{}'\n", idfPath.generic_string());
-  if (auto workspace_ = openstudio::Workspace::load(idfPath, openstudio::IddFileType::EnergyPlus)) {
-    fmt::print("Successfully loaded idf '{}'\n", idfPath.generic_string());
+  if (loading.valid()) {
+    fmt::print("Waiting for {} '{}' to be loaded by another request\n", kind, path.generic_string());
+    return loading.get();
+  }
 
-    if (workspace_->isValid(openstudio::StrictnessLevel::Draft)) {
-      current.workspace = std::move(*workspace_);
-      auto [it, ok] = m_idfs.insert_or_assign(idfPath, std::move(current));
-      return it->second;
+  // Only one thread at a time gets here for a given path
+  fmt::print("Attempting to load {} '{}'\n", kind, path.generic_string());
+  const auto start = std::chrono::steady_clock::now();
+  boost::optional<Info> info_;
+  try {
+    info_ = load(path);
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    cache.loading.erase(path);
+    ++cache.stats.failed;
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    cache.loading.erase(path);
+    cache.stats.loads.add(seconds);
+    clearMeasureInfoForOsmorIdfPathImpl(path);
+    if (info_) {
+      info_->checksum = checksum;
+      if (generation == m_generation) {
+        cache.infos.insert_or_assign(path, *info_);
+        touchCachedFile(path, fileSize);
+        evictCachedFiles();
+      }
     } else {
-      fmt::print("Workspace loaded from '{}' is not valid to Draft StrictnessLevel\n", idfPath.generic_string());
+      ++cache.stats.failed;
+      eraseCachedFile(path);
     }
-  } else {
-    fmt::print("Failed to load idf '{}'\n", idfPath.generic_string());
   }
 
-  m_idfs.erase(idfPath);
+  promise.set_value(info_);
+  return info_;
+}
 
-  return boost::none;
+boost::optional<OSMInfo> MeasureManager::getModel(const openstudio::path& osmPath, bool force_reload) {
+  return getOrLoad<OSMInfo>(osmPath, force_reload, m_osms, "model", [](const openstudio::path& p) -> boost::optional<OSMInfo> {
+    openstudio::osversion::VersionTranslator vt;
+    if (auto model_ = vt.loadModel(p)) {
+      fmt::print("Successfully loaded model '{}'\n", p.generic_string());
+      OSMInfo current;
+      current.model = std::move(*model_);
+      openstudio::energyplus::ForwardTranslator ft;
+      current.workspace = ft.translateModel(current.model);
+      return current;
+    }
+
+    fmt::print("Failed to load model '{}'\n", p.generic_string());
+    return boost::none;
+  });
+}
+
+boost::optional<IDFInfo> MeasureManager::getIdf(const openstudio::path& idfPath, bool force_reload) {
+  return getOrLoad<IDFInfo>(idfPath, force_reload, m_idfs, "idf", [](const openstudio::path& p) -> boost::optional<IDFInfo> {
+    if (auto workspace_ = openstudio::Workspace::load(p, openstudio::IddFileType::EnergyPlus)) {
+      fmt::print("Successfully loaded idf '{}'\n", p.generic_string());
+
+      if (workspace_->isValid(openstudio::StrictnessLevel::Draft)) {
+        IDFInfo current;
+        current.workspace = std::move(*workspace_);
+        return current;
+      } else {
+        fmt::print("Workspace loaded from '{}' is not valid to Draft StrictnessLevel\n", p.generic_string());
+      }
+    } else {
+      fmt::print("Failed to load idf '{}'\n", p.generic_string());
+    }
+
+    return boost::none;
+  });
 }
 
 boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& measureDirPath, bool force_reload) {
@@ -292,17 +417,21 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
   // check if measure exists on disk
   if (!openstudio::filesystem::is_directory(measureDirPath)) {
     fmt::print("Measure '{}' does not exist.\n", measureDirPathStr);
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_measures.erase(measureDirPath);
     return boost::none;
   }
   if (!openstudio::filesystem::is_regular_file(measureDirPath / "measure.xml")) {
     fmt::print("Measure directory '{}' exists but does not have a measure.xml.\n", measureDirPathStr);
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_measures.erase(measureDirPath);
     return boost::none;
   }
 
+  // Only this thread adds or removes measures, so the pointer stays valid after unlocking. Its measureInfos are not, see below
   BCLMeasureInfo* measureInfo_ = nullptr;
   if (!force_reload) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     auto it = m_measures.find(measureDirPath);
     if (it != m_measures.end()) {
       measureInfo_ = &(it->second);
@@ -311,7 +440,10 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
   }
 
   if (!measureInfo_) {
-    m_measures.erase(measureDirPath);
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_measures.erase(measureDirPath);
+    }
 
     // load from disk
     fmt::print("Attempting to load measure '{}'\n", measureDirPathStr);
@@ -323,14 +455,20 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
       return boost::none;
     }
     fmt::print("Successfully loaded measure '{}'\n", measureDirPathStr);
+    std::lock_guard<std::mutex> lock(m_mutex);
     auto [it, ok] = m_measures.insert({measureDirPath, BCLMeasureInfo{std::move(*measure_)}});
     measureInfo_ = &(it->second);
   }
 
   auto& measure = measureInfo_->measure;
 
+  const openstudio::path fileChecksumCachePath = measure.fileChecksumCachePath();
+  if (m_persistFileChecksums) {
+    m_fileChecksums.load(fileChecksumCachePath, measure.directory());
+  }
+
   // see if there are updates, want to make sure to perform both checks so do outside of conditional
-  bool file_updates = measure.checkForUpdatesFiles();  // checks if any files have been updated
+  bool file_updates = measure.checkForUpdatesFiles(m_fileChecksums);  // checks if any files have been updated, only hashing those that changed
   bool xml_updates = measure.checkForUpdatesXML();     // only checks if xml as loaded has been changed since last save
 
   auto readmeInPath = measureDirPath / "README.md.erb";
@@ -346,8 +484,11 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
   if (file_updates || xml_updates || missing_fields || readme_out_of_date) {
     fmt::print("Changes detected, updating '{}'\n", measureDirPathStr);
 
-    // Clear cache before calling getMeasureInfo
-    measureInfo_->measureInfos.clear();
+    // Clear cache before calling getMeasureInfo, getModel and getIdf erase entries of it from other threads
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      measureInfo_->measureInfos.clear();
+    }
 
     openstudio::measure::OSMeasureInfo info = getMeasureInfo(measureDirPath, measure, openstudio::path{});
     info.update(measure);
@@ -369,7 +510,7 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
       const bool result = measureInfoBindingPtr->renderFile(readmeInPath.generic_string());
       if (result) {
         // check for file updates again
-        file_updates = measure.checkForUpdatesFiles();
+        file_updates = measure.checkForUpdatesFiles(m_fileChecksums);
       } else {
         fmt::print(stderr, "Failed to generate the README.md via ERB\n");
       }
@@ -379,6 +520,10 @@ boost::optional<BCLMeasure> MeasureManager::getMeasure(const openstudio::path& m
     measure.save();
   }
 
+  if (m_persistFileChecksums) {
+    m_fileChecksums.save(fileChecksumCachePath, measure.directory());
+  }
+
   return measure;
 }
 
@@ -386,14 +531,19 @@ openstudio::measure::OSMeasureInfo MeasureManager::getMeasureInfo(const openstud
                                                                   const openstudio::path& osmOrIdfPath, const boost::optional<model::Model>& model_,
                                                                   const boost::optional<Workspace>& workspace_) {
 
-  if (!m_measures.contains(measureDirPath)) {
-    LOG_AND_THROW("Measure isn't recorded in m_measures, that should NOT happen");
-  }
-  auto& bclMeasureInfo = m_measures.at(measureDirPath);
-  auto it2 = bclMeasureInfo.measureInfos.find(osmOrIdfPath);
-  if (it2 != bclMeasureInfo.measureInfos.end()) {
-    fmt::print("Using cached OSMeasureInfo for '{}', '{}'\n", measureDirPath.generic_string(), osmOrIdfPath.generic_string());
-    return it2->second;
+  BCLMeasureInfo* bclMeasureInfo_ = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_measures.find(measureDirPath);
+    if (it == m_measures.end()) {
+      LOG_AND_THROW("Measure isn't recorded in m_measures, that should NOT happen");
+    }
+    bclMeasureInfo_ = &(it->second);
+    auto it2 = bclMeasureInfo_->measureInfos.find(osmOrIdfPath);
+    if (it2 != bclMeasureInfo_->measureInfos.end()) {
+      fmt::print("Using cached OSMeasureInfo for '{}', '{}'\n", measureDirPath.generic_string(), osmOrIdfPath.generic_string());
+      return it2->second;
+    }
   }
 
   auto scriptPath_ = measure.primaryScriptPath();
@@ -552,14 +702,39 @@ end
   }
 
   openstudio::measure::OSMeasureInfo info(measureType, className, name, description, taxonomy, modelerDescription, arguments, outputs);
-  auto [it, ok] = bclMeasureInfo.measureInfos.insert({osmOrIdfPath, std::move(info)});
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto [it, ok] = bclMeasureInfo_->measureInfos.insert({osmOrIdfPath, std::move(info)});
   return it->second;
 }
 
+bool MeasureManager::persistFileChecksums() const {
+  return m_persistFileChecksums;
+}
+
+void MeasureManager::setPersistFileChecksums(bool persistFileChecksums) {
+  m_persistFileChecksums = persistFileChecksums;
+}
+
+std::uintmax_t MeasureManager::modelCacheFileBudget() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_modelCacheFileBudget;
+}
+
+void MeasureManager::setModelCacheFileBudget(std::uintmax_t bytes) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_modelCacheFileBudget = bytes;
+  evictCachedFiles();
+}
+
 void MeasureManager::reset() {
-  m_osms.clear();
-  m_idfs.clear();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_osms.infos.clear();
+  m_idfs.infos.clear();
   m_measures.clear();
+  m_lru.clear();
+  m_lruIndex.clear();
+  m_cachedFileBytes = 0;
+  ++m_generation;
 }
 
 MeasureManagerServer::MeasureManagerServer(unsigned port, ScriptEngineInstance& rubyEngine, ScriptEngineInstance& pythonEngine)
@@ -646,7 +821,8 @@ void MeasureManagerServer::handle_post(web::http::http_request message) {
 
   // TODO: for testing only, remove
   if (uri == "/get_model") {
-    message.extract_json().then([this, message](const web::json::value& body) { handle_request(message, body, &MeasureManagerServer::get_model); });
+    message.extract_json().then(
+      [this, message](const web::json::value& body) { handle_request_concurrently(message, body, &MeasureManagerServer::get_model); });
     return;
   }
 
@@ -662,8 +838,11 @@ void MeasureManagerServer::handle_post(web::http::http_request message) {
   }
 
   if (uri == "/compute_arguments") {
-    message.extract_json().then(
-      [this, message](const web::json::value& body) { handle_request(message, body, &MeasureManagerServer::compute_arguments); });
+    message.extract_json().then([this, message](const web::json::value& body) {
+      // Loading the model does not need the main thread, so requests for different models load them in parallel
+      prefetch_model(body);
+      handle_request(message, body, &MeasureManagerServer::compute_arguments);
+    });
     return;
   }
 
@@ -699,6 +878,13 @@ MeasureManagerServer::ResponseType MeasureManagerServer::internal_state([[maybe_
     result[key] = internalState[key];
   }
 
+  auto& requests = result["stats"]["requests"];
+  requests = Json::objectValue;
+  std::lock_guard<std::mutex> lock(m_requestStatsMutex);
+  for (const auto& [uri, latency] : m_requestStats) {
+    requests[uri] = latency.toJSON();
+  }
+
   return {web::http::status_codes::OK, toWebJSON(result)};
 }
 
@@ -708,17 +894,29 @@ MeasureManagerServer::ResponseType MeasureManagerServer::reset([[maybe_unused]]
 }
 
 MeasureManagerServer::ResponseType MeasureManagerServer::set(const web::json::value& body) {
-  if (auto p_ = get_field<openstudio::path>(body, "my_measures_dir")) {
-    if (!openstudio::filesystem::is_directory(*p_)) {
-      // Issue an error message
-      return {web::http::status_codes::BadRequest,
-              toWebJSON(fmt::format("Error, my_measures_dir '{}' is a not a valid directory", p_->generic_string()))};
-    }
-    this->my_measures_dir = std::move(*p_);
-    return {web::http::status_codes::OK, web::json::value()};
-  } else {
+  auto p_ = get_field<openstudio::path>(body, "my_measures_dir");
+  auto modelCacheFileBudgetMB_ = get_field<double>(body, "model_cache_file_budget_mb");
+  if (!p_ && !modelCacheFileBudgetMB_) {
     return {web::http::status_codes::BadRequest, toWebJSON("Missing the my_measures_dir in the post data")};
   }
+
+  if (p_ && !openstudio::filesystem::is_directory(*p_)) {
+    // Issue an error message
+    return {web::http::status_codes::BadRequest,
+            toWebJSON(fmt::format("Error, my_measures_dir '{}' is a not a valid directory", p_->generic_string()))};
+  }
+  if (modelCacheFileBudgetMB_ && (*modelCacheFileBudgetMB_ < 0.0)) {
+    return {web::http::status_codes::BadRequest,
+            toWebJSON(fmt::format("Error, model_cache_file_budget_mb '{}' is negative", *modelCacheFileBudgetMB_))};
+  }
+
+  if (p_) {
+    this->my_measures_dir = std::move(*p_);
+  }
+  if (modelCacheFileBudgetMB_) {
+    m_measureManager.setModelCacheFileBudget(static_cast<std::uintmax_t>(*modelCacheFileBudgetMB_ * 1024.0 * 1024.0));
+  }
+  return {web::http::status_codes::OK, web::json::value()};
 }
 
 MeasureManagerServer::ResponseType MeasureManagerServer::download_bcl_measure(const web::json::value& body) {  // NOLINT
@@ -1016,10 +1214,27 @@ void MeasureManagerServer::print_feedback(const web::http::http_request& message
 void MeasureManagerServer::handle_request(const web::http::http_request& message, const web::json::value& body,
                                           memRequestHandlerFunPtr request_handler) {
 
+  const auto start = std::chrono::steady_clock::now();
   std::packaged_task<ResponseType()> task([this, &body, &request_handler]() { return (this->*request_handler)(body); });
 
   auto future_result = task.get_future();  // The task hasn't been started yet
   tasks.push_back(std::move(task));        // It gets queued, the **main** thread will process it
+  reply(message, future_result, start);
+}
+
+void MeasureManagerServer::handle_request_concurrently(const web::http::http_request& message, const web::json::value& body,
+                                                       memRequestHandlerFunPtr request_handler) {
+
+  const auto start = std::chrono::steady_clock::now();
+  std::packaged_task<ResponseType()> task([this, &body, &request_handler]() { return (this->*request_handler)(body); });
+
+  auto future_result = task.get_future();
+  task();  // Runs on this thread, any exception is stored in the future
+  reply(message, future_result, start);
+}
+
+void MeasureManagerServer::reply(const web::http::http_request& message, std::future<ResponseType>& future_result,
+                                 std::chrono::steady_clock::time_point start) {
   web::http::status_code status_code = web::http::status_codes::Created;
   try {
     auto result = future_result.get();  // This block until it's been processed
@@ -1032,6 +1247,29 @@ void MeasureManagerServer::handle_request(const web::http::http_request& message
     message.reply(web::http::status_codes::InternalError, fmt::format(msg, e.what()));
   }
   print_feedback(message, status_code);
+
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  const std::string uri = toString(web::http::uri::decode(message.relative_uri().path()));
+  std::lock_guard<std::mutex> lock(m_requestStatsMutex);
+  m_requestStats[uri].add(seconds);
+}
+
+void MeasureManagerServer::prefetch_model(const web::json::value& body) {
+  const openstudio::path osmPath = get_field<openstudio::path>(body, "osm_path", {});
+  if (osmPath.empty() || (osmPath.extension() != ".osm")) {
+    // compute_arguments will report it
+    return;
+  }
+  if (get_field<bool>(body, "force_reload", false)) {
+    // compute_arguments reloads it, doing it here too would load it twice
+    return;
+  }
+  try {
+    m_measureManager.getModel(osmPath);
+  } catch (const std::exception& e) {
+    // compute_arguments will try again and report it
+    fmt::print(stderr, "Failed to load model at '{}': {}\n", osmPath.generic_string(), e.what());
+  }
 }
 
 void MeasureManagerServer::do_tasks_forever() {
@@ -8,6 +8,7 @@
 
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
+#include "../utilities/core/FileChecksumCache.hpp"
 #include "../utilities/core/ThreadSafeDeque.hpp"
 #include "../scriptengine/ScriptEngine.hpp"
 
@@ -15,6 +16,8 @@
 #include "../utilities/idf/Workspace.hpp"
 #include "../measure/OSMeasureInfoGetter.hpp"
 #include "../utilities/bcl/BCLMeasure.hpp"
+#include <chrono>
+#include <functional>
 #include <future>
 
 #if (defined(__GNUC__))
@@ -30,8 +33,11 @@
 #  pragma GCC diagnostic pop
 #endif
 
+#include <list>
 #include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace Json {
 class Value;
@@ -52,6 +58,30 @@ struct IDFInfo
   openstudio::Workspace workspace;
 };
 
+// Number of calls and time spent, for the internal state
+struct LatencyStats
+{
+  void add(double seconds);
+  Json::Value toJSON() const;
+
+  std::size_t count = 0;
+  double totalSeconds = 0.0;
+  double maxSeconds = 0.0;
+};
+
+struct ModelCacheStats
+{
+  Json::Value toJSON() const;
+
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+  // Requests that waited for the same file being loaded by another request instead of loading it again
+  std::size_t joined = 0;
+  std::size_t evictions = 0;
+  std::size_t failed = 0;
+  LatencyStats loads;
+};
+
 struct BCLMeasureInfo
 {
   explicit BCLMeasureInfo(openstudio::BCLMeasure t_measure) : measure(std::move(t_measure)) {}
@@ -65,6 +95,9 @@ class MeasureManager
  public:
   MeasureManager(ScriptEngineInstance& t_rubyEngine, ScriptEngineInstance& t_pythonEngine);
 
+  // getModel and getIdf can be called from any thread: different files load concurrently, cache hits do not wait for loads of
+  // other files, and a file already being loaded by another thread is waited for instead of loaded twice.
+  // Everything else must be called from the thread that runs the script engines
   boost::optional<OSMInfo> getModel(const openstudio::path& osmPath, bool force_reload = false);
   boost::optional<IDFInfo> getIdf(const openstudio::path& idfPath, bool force_reload = false);
   boost::optional<BCLMeasure> getMeasure(const openstudio::path& measureDirPath, bool force_reload = false);
@@ -84,10 +117,39 @@ class MeasureManager
 
   std::size_t clearMeasureInfoForOsmorIdfPath(const openstudio::path& osmOrIdfPath);
 
+  // Whether getMeasure also keeps the file checksums of each measure in BCLMeasure::fileChecksumCachePath, so that the next process
+  // does not have to hash the files again. They are always kept in memory
+  bool persistFileChecksums() const;
+  void setPersistFileChecksums(bool persistFileChecksums);
+
+  // Loaded models and workspaces are dropped, least recently used first, when the files they were loaded from add up to more than this
+  // many bytes on disk. This is not their size in memory, which is several times larger. The file that was just loaded is always kept
+  std::uintmax_t modelCacheFileBudget() const;
+  void setModelCacheFileBudget(std::uintmax_t bytes);
+
   void reset();
 
  private:
   REGISTER_LOGGER("MeasureManager");
+
+  template <typename Info>
+  struct CachedFiles
+  {
+    std::map<openstudio::path, Info> infos;
+    std::map<openstudio::path, std::shared_future<boost::optional<Info>>> loading;
+    ModelCacheStats stats;
+  };
+
+  template <typename Info>
+  boost::optional<Info> getOrLoad(const openstudio::path& path, bool force_reload, CachedFiles<Info>& cache, const char* kind,
+                                  const std::function<boost::optional<Info>(const openstudio::path&)>& load);
+
+  // These expect m_mutex to be locked
+  std::size_t clearMeasureInfoForOsmorIdfPathImpl(const openstudio::path& osmOrIdfPath);
+  void eraseCachedFile(const openstudio::path& osmOrIdfPath);
+  void touchCachedFile(const openstudio::path& osmOrIdfPath, std::uintmax_t fileSize);
+  void evictCachedFiles();
+
   //#if USE_RUBY_ENGINE
   ScriptEngineInstance& rubyEngine;
   //#endif
@@ -95,9 +157,24 @@ class MeasureManager
   ScriptEngineInstance& pythonEngine;
   //#endif
 
-  std::map<openstudio::path, OSMInfo> m_osms;
-  std::map<openstudio::path, IDFInfo> m_idfs;
+  // Guards the maps below, since models can be loaded by other threads. Measures themselves are only used by the script engines' thread
+  mutable std::mutex m_mutex;
+  CachedFiles<OSMInfo> m_osms;
+  CachedFiles<IDFInfo> m_idfs;
   std::map<openstudio::path, BCLMeasureInfo> m_measures;
+  // Loads started before a reset do not add their result to the cache
+  std::size_t m_generation = 0;
+
+  // Most recently used first, with the size of the file, indexed by the path's string
+  using LruList = std::list<std::pair<openstudio::path, std::uintmax_t>>;
+  LruList m_lru;
+  std::unordered_map<std::string, LruList::iterator> m_lruIndex;
+  std::uintmax_t m_cachedFileBytes = 0;
+  std::uintmax_t m_modelCacheFileBudget = 512 * 1024 * 1024;
+
+  // Keyed by path, size and last write time, so it stays valid across reset()
+  FileChecksumCache m_fileChecksums;
+  bool m_persistFileChecksums = false;
 };
 
 class MeasureManagerServer
@@ -134,6 +211,12 @@ class MeasureManagerServer
   // See commit message at https://github.com/NREL/OpenStudio/commit/3c4a1c32fd096ca183c5668e2aafe99ac6564fb4#diff-9785c162dbb96e5fdead1b101c7a2d639460e0bdb0d95c8ff21be7a451a8f377
   using memRequestHandlerFunPtr = ResponseType (MeasureManagerServer::*)(const web::json::value& body);
   void handle_request(const web::http::http_request& message, const web::json::value& body, memRequestHandlerFunPtr request_handler);
+  // For request handlers that only load models, which is thread-safe: runs it on the listener's thread, concurrently with other requests
+  void handle_request_concurrently(const web::http::http_request& message, const web::json::value& body, memRequestHandlerFunPtr request_handler);
+  void reply(const web::http::http_request& message, std::future<ResponseType>& future_result, std::chrono::steady_clock::time_point start);
+
+  // Starts loading the model of a /compute_arguments request before it gets its turn on the main thread
+  void prefetch_model(const web::json::value& body);
 
   void handle_get(web::http::http_request message);
   void handle_post(web::http::http_request message);
@@ -153,6 +236,10 @@ class MeasureManagerServer
 
   std::string m_url;
   openstudio::path my_measures_dir;
+
+  // Time from receiving each request to replying, by endpoint
+  mutable std::mutex m_requestStatsMutex;
+  std::map<std::string, LatencyStats> m_requestStats;
 };
 
 }  // namespace openstudio
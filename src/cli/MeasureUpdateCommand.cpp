@@ -70,6 +70,11 @@ namespace cli {
       ->needs(directoryPathOpt)
       ->excludes(updateOpt, updateAllOpt, computeArgsOpt);
 
+    measureCommand
+      ->add_flag("--checksum_cache", opt->checksum_cache,
+                 "Keep the file checksums of each measure in a .checksums.json beside its measure.xml, so unchanged files are not read again")
+      ->excludes(computeArgsOpt);
+
     [[maybe_unused]] auto* startServerOpt = measureCommand->add_option("-s,--start_server", opt->server_port, "Start a measure manager server")
                                               ->option_text("PORT")
                                               ->excludes(directoryPathOpt);
@@ -284,6 +289,7 @@ $ openstudio measure new --list-for-first-taxonomy-tag HVAC
       return;
     } else if (opt.update) {
       MeasureManager measureManager(rubyEngine, pythonEngine);
+      measureManager.setPersistFileChecksums(opt.checksum_cache);
       if (auto measure_ = measureManager.getMeasure(opt.directoryPath, true)) {
         // TODO: maybe I should write an OSMeasureInfo::toJSON() method, but that'd be duplicating the code in BCLMeasure (BCLXML to be exact).
         // So since the only thing that's different is the OSArgument (OSMeasureInfo) versus BCLMeasureArgument (BCLMeasure), we just override
@@ -296,6 +302,7 @@ $ openstudio measure new --list-for-first-taxonomy-tag HVAC
       return;
     } else if (opt.update_all) {
       MeasureManager measureManager(rubyEngine, pythonEngine);
+      measureManager.setPersistFileChecksums(opt.checksum_cache);
       std::vector<openstudio::path> subDirPaths;
       for (auto const& dir_entry : boost::filesystem::directory_iterator{opt.directoryPath}) {
         const auto& subDirPath = dir_entry.path();
@@ -425,6 +432,7 @@ end
     fmt::print("directoryPath={}\n", this->directoryPath.string());
     fmt::print("update={}\n", this->update);
     fmt::print("update_all={}\n", this->update_all);
+    fmt::print("checksum_cache={}\n", this->checksum_cache);
     fmt::print("compute_arguments_model={}\n", this->compute_arguments_model.string());
     fmt::print("run_tests={}\n", this->run_tests);
     fmt::print("server_port={}\n", this->server_port);
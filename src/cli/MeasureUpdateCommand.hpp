@@ -48,6 +48,8 @@ namespace cli {
 
     bool run_tests = false;
 
+    bool checksum_cache = false;
+
     unsigned server_port = 0;
 
     MeasureNewOptions newMeasureOpts;
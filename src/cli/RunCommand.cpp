@@ -45,6 +45,10 @@ namespace cli {
       "--export-epJSON", [opt](std::int64_t val) { (val != 0) && opt->runOptions.setEpjson((val == 1)); },
       "export epJSON file format. The default is IDF");
 
+    app->add_flag("--share-energyplus-install", opt->share_energyplus_install,
+                  "Link the EnergyPlus idd/ini/epJSON files into the run directory instead of copying them, and run EnergyPlus without "
+                  "changing the current directory (measures still run from their own directory)");
+
     app->add_option("-s,--socket", opt->socket_port, "Pipe status messages to a socket on localhost PORT")->option_text("PORT");
 
     auto* stdout_opt =
@@ -15,6 +15,7 @@ import signal
 import socket
 import subprocess
 import time
+from concurrent.futures import ThreadPoolExecutor
 from contextlib import closing
 from copy import deepcopy
 from pathlib import Path
@@ -66,10 +67,14 @@ class MeasureManagerClient(requests.Session):
         url = urljoin(self.base_url, url)
         return super().request(method, url, *args, **kwargs)
 
-    def internal_state(self):
+    def internal_state(self, with_stats: bool = False):
         r = self.get("/internal_state")
         r.raise_for_status()
-        return r.json()
+        state = r.json()
+        if not with_stats:
+            # Cache and request statistics, only reported by the C++ version
+            state.pop("stats", None)
+        return state
 
     def reset(self):
         r = self.post("/reset")
@@ -198,7 +203,11 @@ def _checksum_cli(osclipath: Path, osm_path: Path):
 def test_default_internal_state(measure_manager_client, expected_internal_state):
     r = measure_manager_client.get("/internal_state")
     r.raise_for_status()
-    assert r.json() == expected_internal_state
+    state = r.json()
+    if not measure_manager_client.is_classic:
+        assert "stats" in state
+        del state["stats"]
+    assert state == expected_internal_state
     # Equivalent
     assert measure_manager_client.internal_state() == expected_internal_state
 
@@ -300,6 +309,52 @@ def test_get_model(
     measure_manager_client.reset_and_assert_internal_state()
 
 
+def test_model_cache(
+    measure_manager_client: MeasureManagerClient,
+    expected_internal_state: Dict[str, Any],
+    tmp_path: Path,
+    osclipath: Path,
+):
+    if measure_manager_client.is_classic:
+        pytest.skip("Classic CLI does not have the POST /get_model")
+
+    osm_path = tmp_path / "model.osm"
+    osm_path2 = tmp_path / "model2.osm"
+    _write_example_model_cli(osclipath=osclipath, osm_path=osm_path)
+    _write_model_cli(osclipath=osclipath, osm_path=osm_path2)
+
+    # Concurrent requests for the same model only load it once. Not sharing the Session, it isn't thread-safe
+    n_requests = 8
+    url = urljoin(measure_manager_client.base_url, "/get_model")
+    with ThreadPoolExecutor(max_workers=n_requests) as executor:
+        responses = list(executor.map(lambda _: requests.post(url, json={"osm_path": str(osm_path)}), range(n_requests)))
+    for r in responses:
+        r.raise_for_status()
+
+    stats = measure_manager_client.internal_state(with_stats=True)["stats"]
+    assert stats["osms"]["misses"] == 1
+    assert stats["osms"]["loads"]["count"] == 1
+    assert stats["osms"]["hits"] + stats["osms"]["joined"] == n_requests - 1
+    assert stats["requests"]["/get_model"]["count"] == n_requests
+    assert stats["model_cache_file_bytes"] == osm_path.stat().st_size
+
+    # With no budget, only the last model loaded is kept
+    r = measure_manager_client.post("/set", json={"model_cache_file_budget_mb": 0})
+    r.raise_for_status()
+    r = measure_manager_client.post("/get_model", json={"osm_path": str(osm_path2)})
+    r.raise_for_status()
+
+    state = measure_manager_client.internal_state(with_stats=True)
+    assert [x["osm_path"] for x in state["osms"]] == [osm_path2.as_posix()]
+    assert state["stats"]["osms"]["evictions"] == 1
+    assert state["stats"]["model_cache_file_budget"] == 0
+
+    r = measure_manager_client.post("/set", json={"model_cache_file_budget_mb": -1})
+    assert r.status_code == 400
+
+    measure_manager_client.reset_and_assert_internal_state()
+
+
 def test_download_bcl_measures(measure_manager_client: MeasureManagerClient, expected_internal_state: Dict[str, Any]):
     r = measure_manager_client.post(url="/download_bcl_measure", json={"": ""})
     assert r.status_code == 400
@@ -110,6 +110,7 @@ namespace energyplus {
 
     // When m_forwardTranslatorOptions.excludeSpaceTranslation() is false, could we skip the (expensive) clone since we aren't combining spaces?
     // No, we are still doing stuff like removing orphan loads, spaces not part of a thermal zone, etc
+    // The clone shares the field values of every object with model until either side changes them, see IdfObject_Impl
     auto modelCopy = model.clone(true).cast<Model>();
 
     m_progressBar = progressBar;
@@ -13,10 +13,39 @@
 #include "../../utilities/core/FileLogSink.hpp"
 #include "../../utilities/idf/Workspace.hpp"
 
+#if defined(_WIN32)
+#  include <windows.h>
+#  include <psapi.h>
+#else
+#  include <sys/resource.h>
+#endif
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::energyplus;
 
+// Peak resident set size of the process so far, in MB. It never goes down, so benchmarks report how much they raised it:
+// run a single benchmark (--benchmark_filter) to see its own peak
+static double peakRSSInMB() {
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return static_cast<double>(counters.PeakWorkingSetSize) / (1024.0 * 1024.0);
+  }
+  return 0.0;
+#else
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+#  if defined(__APPLE__)
+  // bytes on macOS
+  return static_cast<double>(usage.ru_maxrss) / (1024.0 * 1024.0);
+#  else
+  // kilobytes on Linux
+  return static_cast<double>(usage.ru_maxrss) / 1024.0;
+#  endif
+#endif
+}
+
 static void BM_FT_ExampleModel_sameFT(benchmark::State& state) {
 
   FileLogSink logFile(toPath("./ForwardTranslator_Benchmark.log"));
@@ -28,6 +57,8 @@ static void BM_FT_ExampleModel_sameFT(benchmark::State& state) {
   ForwardTranslator forwardTranslator;
   forwardTranslator.setExcludeSpaceTranslation(state.range(1) == 0 ? false : true);
 
+  const double peakRSSAtStart = peakRSSInMB();
+
   // Code inside this loop is measured repeatedly
   for (auto _ : state) {
     for (auto i = 0; i <= state.range(0); ++i) {
@@ -35,6 +66,7 @@ static void BM_FT_ExampleModel_sameFT(benchmark::State& state) {
     }
   }
 
+  state.counters["PeakRSSIncrease_MB"] = peakRSSInMB() - peakRSSAtStart;
   state.SetComplexityN(state.range(0));
 }
 
@@ -46,6 +78,8 @@ static void BM_FT_ExampleModel_newFT(benchmark::State& state) {
 
   Model model = exampleModel();
 
+  const double peakRSSAtStart = peakRSSInMB();
+
   // Code inside this loop is measured repeatedly
   for (auto _ : state) {
     for (auto i = 0; i <= state.range(0); ++i) {
@@ -55,6 +89,26 @@ static void BM_FT_ExampleModel_newFT(benchmark::State& state) {
     }
   }
 
+  state.counters["PeakRSSIncrease_MB"] = peakRSSInMB() - peakRSSAtStart;
+  state.SetComplexityN(state.range(0));
+}
+
+// translateModel starts by cloning the whole model, this isolates that part
+static void BM_FT_ExampleModel_clone(benchmark::State& state) {
+
+  Model model = exampleModel();
+
+  const double peakRSSAtStart = peakRSSInMB();
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    for (auto i = 0; i <= state.range(0); ++i) {
+      Workspace modelCopy = model.clone(true);
+      benchmark::DoNotOptimize(modelCopy);
+    }
+  }
+
+  state.counters["PeakRSSIncrease_MB"] = peakRSSInMB() - peakRSSAtStart;
   state.SetComplexityN(state.range(0));
 }
 
@@ -71,3 +125,5 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_FT_ExampleModel_newFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
 
 BENCHMARK(BM_FT_ExampleModel_sameFT)->Unit(benchmark::kMillisecond)->Ranges({{1, 256}, {0, 1}})->Complexity();
+
+BENCHMARK(BM_FT_ExampleModel_clone)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(1, 64)->Complexity();
@@ -72,6 +72,7 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles, const std::vector<
                                   << "#include <utilities/core/Logger.hpp>" << '\n'
                                   << '\n'
                                   << "#include <map>" << '\n'
+                                  << "#include <mutex>" << '\n'
                                   << '\n'
                                   << "namespace openstudio{" << '\n'
                                   << '\n'
@@ -189,7 +190,9 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles, const std::vector<
                                   << "  typedef std::multimap<IddObjectType,IddFileType> IddObjectSourceFileMap;" << '\n'
                                   << "  IddObjectSourceFileMap m_sourceFileMap;" << '\n'
                                   << '\n'
+                                  << "  // IddFiles of older versions, loaded on first use. VersionTranslator can run on several threads" << '\n'
                                   << "  mutable std::map<VersionString,IddFile> m_osIddFiles;" << '\n'
+                                  << "  mutable std::mutex m_osIddFilesMutex;" << '\n'
                                   << "};" << '\n'
                                   << '\n'
                                   << "#if _WIN32 || _MSC_VER" << '\n'
@@ -237,6 +240,7 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles, const std::vector<
   for (const std::shared_ptr<IddFactoryOutFile>& cxxFile : outFiles.iddFactoryIddFileCxxs) {
     cxxFile->tempFile << "#include <utilities/idd/IddFactory.hxx>" << '\n'
                       << "#include <utilities/idd/IddEnums.hxx>" << '\n'
+                      << "#include <utilities/idd/IddTables.hpp>" << '\n'
                       << '\n'
                       << "#include <utilities/core/Assert.hpp>" << '\n'
                       << "#include <utilities/core/Compare.hpp>" << '\n'
@@ -707,6 +711,7 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles, GenerateIddFacto
     << "    return getIddFile(fileType);" << '\n'
     << "  }" << '\n'
     << "  else {" << '\n'
+    << "    std::lock_guard<std::mutex> lock(m_osIddFilesMutex);" << '\n'
     << "    std::map<VersionString, IddFile>::const_iterator it = m_osIddFiles.find(version);" << '\n'
     << "    if (it != m_osIddFiles.end()) {" << '\n'
     << "      return it->second;" << '\n'
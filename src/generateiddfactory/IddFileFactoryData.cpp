@@ -5,6 +5,7 @@
 
 #include "IddFileFactoryData.hpp"
 #include "WriteEnums.hpp"
+#include "WriteIddTables.hpp"
 
 #include "../utilities/idd/IddRegex.hpp"
 
@@ -168,16 +169,8 @@ void IddFileFactoryData::parseFile(const path& outPath, const std::string& outFi
     objectName.first = m_convertName(objectName.second);
     m_objectNames.push_back(objectName);
 
-    // start writing create function
-    cxxFile->tempFile << '\n'
-                      << "IddObject create" << objectName.first << "IddObject() {" << '\n'
-                      << '\n'
-                      << "  static const IddObject object = []{" << '\n'
-                      << '\n'
-                      << "    // Rely on C++11 static initialization and Initialize on First Use Idiom" << '\n'
-                      << "    // to make sure all statics are initialized properly, thread safely" << '\n'
-                      << "    std::stringstream ss;" << '\n'
-                      << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
+    // collect the object text, same as the text IddObject::load would be given
+    std::string objectText = trimLine + '\n';
 
     // start collecting field names
     // (requires \field tag, which is expected to occur one per line)
@@ -190,16 +183,19 @@ void IddFileFactoryData::parseFile(const path& outPath, const std::string& outFi
       trimLine = line;
       boost::trim(trimLine);
       if (trimLine.empty()) {
-        // finish writing create function
+        // write create function, the IddObject is built from static tables so that no IDD text
+        // has to be parsed at runtime
         cxxFile->tempFile << '\n'
+                          << "IddObject create" << objectName.first << "IddObject() {" << '\n'
                           << '\n'
+                          << "  static const IddObject object = []{" << '\n'
+                          << '\n'
+                          << "    // Rely on C++11 static initialization and Initialize on First Use Idiom" << '\n'
+                          << "    // to make sure all statics are initialized properly, thread safely" << '\n';
+        writeIddObjectTable(cxxFile->tempFile, "table", objectName.second, group, objectText);
+        cxxFile->tempFile << '\n'
                           << "    IddObjectType objType(IddObjectType::" << objectName.first << ");" << '\n'
-                          << "    OptionalIddObject oObj = IddObject::load(\"" << objectName.second << "\"," << '\n'
-                          << "                                             \"" << group << "\"," << '\n'
-                          << "                                             ss.str()," << '\n'
-                          << "                                             objType);" << '\n'
-                          << "    OS_ASSERT(oObj);" << '\n'
-                          << "    return *oObj;" << '\n'
+                          << "    return IddObject::load(table, objType);" << '\n'
                           << "  }(); // immediately invoked lambda" << '\n'
                           << '\n'
                           << "  OS_ASSERT(object.type() == IddObjectType::" << objectName.first << ");" << '\n'
@@ -293,8 +289,8 @@ void IddFileFactoryData::parseFile(const path& outPath, const std::string& outFi
         break;
       }
 
-      // continue writing create function
-      cxxFile->tempFile << '\n' << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
+      // continue collecting the object text
+      objectText += trimLine + '\n';
 
       // look for field name
       std::string fieldName;
@@ -0,0 +1,490 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "WriteIddTables.hpp"
+
+#include "../utilities/idd/IddFieldProperties.hpp"
+#include "../utilities/idd/IddPropertyParser.hpp"
+#include "../utilities/idd/IddRegex.hpp"
+
+#include <boost/regex.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/optional.hpp>
+
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+
+namespace {
+
+  // mirrors of IddKey_Impl, IddField_Impl and IddObject_Impl data, filled in at generation time
+
+  struct KeyData
+  {
+    std::string name;
+    std::string note;
+  };
+
+  struct FieldData
+  {
+    std::string fieldId;
+    std::string name;
+    IddFieldType type{IddFieldType::UnknownType};
+    std::string note;
+    bool required = false;
+    bool autosizable = false;
+    bool autocalculatable = false;
+    bool retaincase = false;
+    bool deprecated = false;
+    bool beginExtensible = false;
+    boost::optional<std::string> units;
+    boost::optional<std::string> ipUnits;
+    std::string minBoundType = "Unbounded";
+    double minBoundValue = 0.0;
+    boost::optional<std::string> minBoundText;
+    std::string maxBoundType = "Unbounded";
+    double maxBoundValue = 0.0;
+    boost::optional<std::string> maxBoundText;
+    boost::optional<std::string> stringDefault;
+    boost::optional<double> numericDefault;
+    std::vector<std::string> objectLists;
+    std::vector<std::string> references;
+    std::vector<std::string> referenceClassNames;
+    std::vector<std::string> externalLists;
+    std::vector<KeyData> keys;
+  };
+
+  struct ObjectData
+  {
+    std::string name;
+    std::string group;
+    std::string memo;
+    bool unique = false;
+    bool required = false;
+    bool obsolete = false;
+    bool hasURL = false;
+    bool extensible = false;
+    unsigned numExtensible = 0;
+    std::string format;
+    unsigned minFields = 0;
+    boost::optional<unsigned> maxFields;
+    std::vector<FieldData> fields;
+  };
+
+  [[noreturn]] void throwParseError(const std::string& objectName, const std::string& message) {
+    std::stringstream ss;
+    ss << "Unable to write IddObjectTable for '" << objectName << "': " << message;
+    throw std::runtime_error(ss.str().c_str());
+  }
+
+  std::string trimmed(std::string text) {
+    boost::trim(text);
+    return text;
+  }
+
+  double toDouble(const std::string& objectName, const std::string& text) {
+    double result = boost::lexical_cast<double>(text);
+    if (!std::isfinite(result)) {
+      throwParseError(objectName, "'" + text + "' is not a finite number.");
+    }
+    return result;
+  }
+
+  // IddObject_Impl::parseProperty
+  void parseObjectProperty(ObjectData& object, const std::string& text) {
+    using iddPropertyParser::ObjectPropertyKind;
+
+    boost::optional<iddPropertyParser::ObjectProperty> property = iddPropertyParser::parseObjectProperty(text);
+    if (!property) {
+      throwParseError(object.name, "unknown property text '" + text + "'.");
+    }
+
+    switch (property->kind) {
+      case ObjectPropertyKind::Memo:
+        object.memo += (object.memo.empty() ? "" : "\n") + property->value;
+        break;
+      case ObjectPropertyKind::Unique:
+        object.unique = true;
+        break;
+      case ObjectPropertyKind::Required:
+        object.required = true;
+        break;
+      case ObjectPropertyKind::Obsolete:
+        object.obsolete = true;
+        break;
+      case ObjectPropertyKind::HasURL:
+        object.hasURL = true;
+        break;
+      case ObjectPropertyKind::Extensible:
+        object.extensible = true;
+        object.numExtensible = boost::lexical_cast<unsigned>(property->value);
+        break;
+      case ObjectPropertyKind::Format:
+        object.format = property->value;
+        break;
+      case ObjectPropertyKind::MinFields:
+        object.minFields = boost::lexical_cast<unsigned>(property->value);
+        break;
+      case ObjectPropertyKind::MaxFields:
+        object.maxFields = boost::lexical_cast<unsigned>(property->value);
+        break;
+    }
+  }
+
+  // IddField_Impl::parseProperty
+  void parseFieldProperty(const std::string& objectName, FieldData& field, const std::string& text) {
+    if (text.empty()) {
+      return;
+    }
+
+    using iddPropertyParser::FieldPropertyKind;
+
+    boost::optional<iddPropertyParser::FieldProperty> property = iddPropertyParser::parseFieldProperty(text);
+    if (!property) {
+      throwParseError(objectName, "unknown field property text '" + text + "' detected in field '" + field.name + "'.");
+    }
+
+    const std::string& value = property->value;
+    switch (property->kind) {
+      case FieldPropertyKind::Autosizable:
+        field.autosizable = true;
+        break;
+      case FieldPropertyKind::Autocalculatable:
+        field.autocalculatable = true;
+        break;
+      case FieldPropertyKind::BeginExtensible:
+        field.beginExtensible = true;
+        break;
+      case FieldPropertyKind::Default:
+        field.stringDefault = value;
+        // numeric defaults depend on the type known at this point of the field text
+        if ((field.type == IddFieldType::RealType) || (field.type == IddFieldType::IntegerType)) {
+          field.numericDefault = property->automaticDefault ? -9999 : toDouble(objectName, value);
+        }
+        break;
+      case FieldPropertyKind::Deprecated:
+        field.deprecated = true;
+        break;
+      case FieldPropertyKind::ExternalList:
+        field.externalLists.push_back(value);
+        break;
+      case FieldPropertyKind::Field:
+        if (value != field.name) {
+          throwParseError(objectName, "field name '" + value + "' does not match expected '" + field.name + "'.");
+        }
+        break;
+      case FieldPropertyKind::IPUnits:
+        field.ipUnits = value;
+        break;
+      case FieldPropertyKind::Key:
+        field.keys.push_back(KeyData{value, property->keyNote});
+        break;
+      case FieldPropertyKind::MinimumExclusive:
+      case FieldPropertyKind::MinimumInclusive:
+        field.minBoundType = (property->kind == FieldPropertyKind::MinimumExclusive) ? "ExclusiveBound" : "InclusiveBound";
+        field.minBoundText = value;
+        field.minBoundValue = toDouble(objectName, value);
+        break;
+      case FieldPropertyKind::MaximumExclusive:
+      case FieldPropertyKind::MaximumInclusive:
+        field.maxBoundType = (property->kind == FieldPropertyKind::MaximumExclusive) ? "ExclusiveBound" : "InclusiveBound";
+        field.maxBoundText = value;
+        field.maxBoundValue = toDouble(objectName, value);
+        break;
+      case FieldPropertyKind::Memo:
+      case FieldPropertyKind::Note:
+        field.note += (field.note.empty() ? "" : "\n") + value;
+        break;
+      case FieldPropertyKind::ObjectList:
+        field.objectLists.push_back(value);
+        break;
+      case FieldPropertyKind::Required:
+        field.required = true;
+        break;
+      case FieldPropertyKind::ReferenceClassName:
+        field.referenceClassNames.push_back(value);
+        break;
+      case FieldPropertyKind::Reference:
+        field.references.push_back(value);
+        break;
+      case FieldPropertyKind::RetainCase:
+        field.retaincase = true;
+        break;
+      case FieldPropertyKind::Type:
+        // same conversion as IddField_Impl, accepts the value name or the description
+        field.type = IddFieldType(value);
+        break;
+      case FieldPropertyKind::Units:
+        field.units = value;
+        break;
+    }
+  }
+
+  // IddField_Impl::parse
+  FieldData parseField(const std::string& objectName, const std::string& fieldName, const std::string& text) {
+    FieldData result;
+    result.name = fieldName;
+
+    boost::smatch matches;
+    if (!boost::regex_search(text, matches, iddRegex::field())) {
+      throwParseError(objectName, "field text does not match expected pattern: '" + text + "'.");
+    }
+    std::string fieldTypeChar(matches[1].first, matches[1].second);
+    std::string fieldTypeNumber(matches[2].first, matches[2].second);
+    std::string fieldProperties(matches[3].first, matches[3].second);
+
+    result.fieldId = fieldTypeChar + fieldTypeNumber;
+    if (boost::iequals(fieldTypeChar, "A")) {
+      result.type = IddFieldType::AlphaType;
+    } else {
+      // default numerics to real, can be overwritten later
+      result.type = IddFieldType::RealType;
+    }
+
+    while (boost::regex_search(fieldProperties, matches, iddRegex::metaDataComment())) {
+      std::string thisProperty = trimmed(std::string(matches[1].first, matches[1].second));
+      parseFieldProperty(objectName, result, thisProperty);
+      fieldProperties = trimmed(std::string(matches[2].first, matches[2].second));
+    }
+
+    if (result.type == IddFieldType::UnknownType) {
+      throwParseError(objectName, "field '" + fieldName + "' is of unknown type after parsing.");
+    }
+
+    // If the field has a default then it is not required. This overrides the idd text.
+    if (result.stringDefault) {
+      result.required = false;
+    }
+
+    return result;
+  }
+
+  // IddObject_Impl::parseFields
+  void parseFields(ObjectData& object, const std::string& text) {
+    static const boost::regex field_start("[AN][0-9]+[\\s]*[,;]");
+
+    auto begin = text.begin();
+    const auto end = text.end();
+
+    boost::match_results<std::string::const_iterator> matches;
+    if (!boost::regex_search(begin, end, matches, field_start)) {
+      return;
+    }
+    if (matches[0].first != text.begin()) {
+      throwParseError(object.name, "field text does not start where expected, '" + text + "'.");
+    }
+
+    while (begin != end) {
+      auto fieldEnd = end;
+      if (boost::regex_search(begin + 1, end, matches, field_start)) {
+        fieldEnd = matches[0].first;
+      }
+      std::string fieldText(begin, fieldEnd);
+      begin = fieldEnd;
+
+      std::string fieldName;
+      boost::smatch nameMatches;
+      if (boost::regex_search(fieldText, nameMatches, iddRegex::name())) {
+        fieldName = trimmed(std::string(nameMatches[1].first, nameMatches[1].second));
+      } else if (boost::regex_search(fieldText, nameMatches, iddRegex::field())) {
+        // if no explicit field name, use the type and number
+        fieldName = trimmed(std::string(nameMatches[1].first, nameMatches[1].second)) + trimmed(std::string(nameMatches[2].first, nameMatches[2].second));
+      } else {
+        throwParseError(object.name, "cannot determine field name from text '" + fieldText + "'.");
+      }
+
+      object.fields.push_back(parseField(object.name, fieldName, fieldText));
+    }
+  }
+
+  // IddObject_Impl::parseObject
+  void parseObject(ObjectData& object, const std::string& text) {
+    boost::smatch matches;
+    if (!boost::regex_search(text, matches, iddRegex::line())) {
+      throwParseError(object.name, "could not determine object name from text '" + text + "'.");
+    }
+    if (trimmed(std::string(matches[1].first, matches[1].second)) != object.name) {
+      throwParseError(object.name, "object name does not match.");
+    }
+
+    std::string propertiesText = trimmed(std::string(matches[2].first, matches[2].second));
+    while (boost::regex_search(propertiesText, matches, iddRegex::metaDataComment())) {
+      parseObjectProperty(object, trimmed(std::string(matches[1].first, matches[1].second)));
+      propertiesText = trimmed(std::string(matches[2].first, matches[2].second));
+    }
+  }
+
+  // C++ string literal for text, split after each new line
+  std::string cppString(const std::string& text) {
+    std::string result("\"");
+    for (char c : text) {
+      switch (c) {
+        case '\\':
+          result += "\\\\";
+          break;
+        case '"':
+          result += "\\\"";
+          break;
+        case '\n':
+          result += "\\n\"\n      \"";
+          break;
+        case '\r':
+          result += "\\r";
+          break;
+        case '\t':
+          result += "\\t";
+          break;
+        default:
+          result += c;
+      }
+    }
+    result += "\"";
+    return result;
+  }
+
+  std::string cppString(const boost::optional<std::string>& text) {
+    return text ? cppString(*text) : std::string("nullptr");
+  }
+
+  std::string cppDouble(double value) {
+    std::stringstream ss;
+    ss << std::setprecision(17) << value;
+    return ss.str();
+  }
+
+  // writes a static array named arrayName holding values, and returns the designated initializers referring to it
+  std::string writeStringList(std::ostream& os, const std::string& arrayName, const std::string& memberName,
+                              const std::vector<std::string>& values) {
+    if (values.empty()) {
+      return std::string();
+    }
+    os << "    static constexpr const char* " << arrayName << "[] = {";
+    for (const std::string& value : values) {
+      os << cppString(value) << ", ";
+    }
+    os << "};" << '\n';
+
+    std::string capitalized = memberName;
+    capitalized[0] = static_cast<char>(std::toupper(static_cast<unsigned char>(capitalized[0])));
+    return ", ." + memberName + " = " + arrayName + ", .num" + capitalized + " = " + std::to_string(values.size());
+  }
+
+}  // namespace
+
+void writeIddObjectTable(std::ostream& os, const std::string& tableName, const std::string& objectName, const std::string& group,
+                         const std::string& text) {
+  ObjectData object;
+  object.name = objectName;
+  object.group = group;
+
+  // IddObject_Impl::parse
+  boost::smatch matches;
+  if (boost::regex_search(text, matches, iddRegex::objectAndFields())) {
+    parseObject(object, std::string(matches[1].first, matches[1].second));
+    parseFields(object, std::string(matches[2].first, matches[2].second));
+  } else if (boost::regex_match(text, iddRegex::objectNoFields())) {
+    parseObject(object, text);
+  } else {
+    throwParseError(objectName, "unexpected pattern '" + text + "'.");
+  }
+
+  // lists and keys have to be defined before the fields that point to them
+  std::vector<std::string> fieldListInitializers;
+  for (unsigned i = 0, n = object.fields.size(); i < n; ++i) {
+    const FieldData& field = object.fields[i];
+    std::string prefix = "field" + std::to_string(i) + "_";
+    std::string initializers = writeStringList(os, prefix + "objectLists", "objectLists", field.objectLists)
+                               + writeStringList(os, prefix + "references", "references", field.references)
+                               + writeStringList(os, prefix + "referenceClassNames", "referenceClassNames", field.referenceClassNames)
+                               + writeStringList(os, prefix + "externalLists", "externalLists", field.externalLists);
+    if (!field.keys.empty()) {
+      os << "    static constexpr IddKeyTable " << prefix << "keys[] = {" << '\n';
+      for (const KeyData& key : field.keys) {
+        os << "      {" << cppString(key.name) << ", " << cppString(key.note) << "}," << '\n';
+      }
+      os << "    };" << '\n';
+      initializers += ", .keys = " + prefix + "keys, .numKeys = " + std::to_string(field.keys.size());
+    }
+    fieldListInitializers.push_back(initializers);
+  }
+
+  std::string fieldsName = tableName + "_fields";
+  if (!object.fields.empty()) {
+    os << "    static constexpr IddFieldTable " << fieldsName << "[] = {" << '\n';
+    for (unsigned i = 0, n = object.fields.size(); i < n; ++i) {
+      const FieldData& field = object.fields[i];
+      os << "      {.fieldId = " << cppString(field.fieldId) << ", .name = " << cppString(field.name) << ", .type = IddFieldType::" << field.type.valueName();
+      if (!field.note.empty()) {
+        os << ", .note = " << cppString(field.note);
+      }
+      // only write what differs from the IddFieldTable defaults
+      for (const auto& [flag, memberName] : {std::pair(field.required, "required"), std::pair(field.autosizable, "autosizable"),
+                                             std::pair(field.autocalculatable, "autocalculatable"), std::pair(field.retaincase, "retaincase"),
+                                             std::pair(field.deprecated, "deprecated"), std::pair(field.beginExtensible, "beginExtensible")}) {
+        if (flag) {
+          os << ", ." << memberName << " = true";
+        }
+      }
+      if (field.units) {
+        os << ", .units = " << cppString(field.units);
+      }
+      if (field.ipUnits) {
+        os << ", .ipUnits = " << cppString(field.ipUnits);
+      }
+      if (field.minBoundText) {
+        os << ", .minBoundType = IddFieldProperties::" << field.minBoundType << ", .minBoundValue = " << cppDouble(field.minBoundValue)
+           << ", .minBoundText = " << cppString(field.minBoundText);
+      }
+      if (field.maxBoundText) {
+        os << ", .maxBoundType = IddFieldProperties::" << field.maxBoundType << ", .maxBoundValue = " << cppDouble(field.maxBoundValue)
+           << ", .maxBoundText = " << cppString(field.maxBoundText);
+      }
+      if (field.stringDefault) {
+        os << ", .stringDefault = " << cppString(field.stringDefault);
+      }
+      if (field.numericDefault) {
+        os << ", .hasNumericDefault = true, .numericDefault = " << cppDouble(*field.numericDefault);
+      }
+      os << fieldListInitializers[i] << "}," << '\n';
+    }
+    os << "    };" << '\n';
+  }
+
+  os << "    static constexpr IddObjectTable " << tableName << "{.name = " << cppString(object.name) << ", .group = " << cppString(object.group);
+  if (!object.memo.empty()) {
+    os << ", .memo = " << cppString(object.memo);
+  }
+  for (const auto& [flag, memberName] : {std::pair(object.unique, "unique"), std::pair(object.required, "required"),
+                                         std::pair(object.obsolete, "obsolete"), std::pair(object.hasURL, "hasURL")}) {
+    if (flag) {
+      os << ", ." << memberName << " = true";
+    }
+  }
+  if (object.extensible) {
+    os << ", .extensible = true, .numExtensible = " << object.numExtensible;
+  }
+  if (!object.format.empty()) {
+    os << ", .format = " << cppString(object.format);
+  }
+  if (object.minFields > 0) {
+    os << ", .minFields = " << object.minFields;
+  }
+  if (object.maxFields) {
+    os << ", .hasMaxFields = true, .maxFields = " << *object.maxFields;
+  }
+  if (!object.fields.empty()) {
+    os << ", .fields = " << fieldsName << ", .numFields = " << object.fields.size();
+  }
+  os << "};" << '\n';
+}
+
+}  // namespace openstudio
@@ -0,0 +1,24 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef GENERATEIDDFACTORY_WRITEIDDTABLES_HPP
+#define GENERATEIDDFACTORY_WRITEIDDTABLES_HPP
+
+#include <ostream>
+#include <string>
+
+namespace openstudio {
+
+/** Parses text, the full IDD text of object objectName, the same way IddObject::load does and writes
+ *  static constexpr IddObjectTable, IddFieldTable and IddKeyTable definitions (see
+ *  utilities/idd/IddTables.hpp) describing the result to os. The last definition written is an
+ *  IddObjectTable named tableName. Throws std::runtime_error if text cannot be parsed, which would
+ *  also make IddObject::load fail. */
+void writeIddObjectTable(std::ostream& os, const std::string& tableName, const std::string& objectName, const std::string& group,
+                         const std::string& text);
+
+}  // namespace openstudio
+
+#endif  // GENERATEIDDFACTORY_WRITEIDDTABLES_HPP
@@ -0,0 +1,479 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "GltfBinaryWriter.hpp"
+
+#include <tiny_gltf.h>
+
+#include <fmt/format.h>
+
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+namespace gltf {
+
+  namespace detail {
+
+    namespace {
+
+      constexpr uint32_t glbMagic = 0x46546C67;      // "glTF"
+      constexpr uint32_t glbVersion = 2;
+      constexpr uint32_t glbChunkJson = 0x4E4F534A;  // "JSON"
+      constexpr uint32_t glbChunkBin = 0x004E4942;   // "BIN\0"
+
+      // Appends compact JSON to a string, keeping track of where commas go
+      class JsonWriter
+      {
+       public:
+        explicit JsonWriter(std::string& out) : m_out(out) {}
+
+        void beginObject() {
+          prefix();
+          m_out += '{';
+          m_first.push_back(true);
+        }
+
+        void endObject() {
+          m_out += '}';
+          m_first.pop_back();
+        }
+
+        void beginArray() {
+          prefix();
+          m_out += '[';
+          m_first.push_back(true);
+        }
+
+        void endArray() {
+          m_out += ']';
+          m_first.pop_back();
+        }
+
+        void key(const std::string& name) {
+          separator();
+          writeString(name);
+          m_out += ':';
+          m_afterKey = true;
+        }
+
+        void null() {
+          prefix();
+          m_out += "null";
+        }
+
+        void value(bool b) {
+          prefix();
+          m_out += b ? "true" : "false";
+        }
+
+        void value(int i) {
+          prefix();
+          m_out += std::to_string(i);
+        }
+
+        void value(size_t i) {
+          prefix();
+          m_out += std::to_string(i);
+        }
+
+        // always written with a decimal point or exponent, so that tinygltf reads it back as a real
+        void value(double d) {
+          if (!std::isfinite(d)) {
+            null();
+            return;
+          }
+          prefix();
+          std::string s = fmt::format("{}", d);
+          if (s.find_first_of(".e") == std::string::npos) {
+            s += ".0";
+          }
+          m_out += s;
+        }
+
+        void value(const std::string& s) {
+          prefix();
+          writeString(s);
+        }
+
+        void value(const char* s) {
+          value(std::string(s));
+        }
+
+        template <typename T>
+        void array(const std::vector<T>& values) {
+          beginArray();
+          for (const auto& v : values) {
+            value(v);
+          }
+          endArray();
+        }
+
+        template <typename T>
+        void member(const std::string& name, const T& v) {
+          key(name);
+          value(v);
+        }
+
+        template <typename T>
+        void arrayMember(const std::string& name, const std::vector<T>& values) {
+          key(name);
+          array(values);
+        }
+
+       private:
+        void separator() {
+          if (!m_first.empty()) {
+            if (!m_first.back()) {
+              m_out += ',';
+            }
+            m_first.back() = false;
+          }
+        }
+
+        void prefix() {
+          if (m_afterKey) {
+            m_afterKey = false;
+          } else {
+            separator();
+          }
+        }
+
+        void writeString(const std::string& s) {
+          m_out += '"';
+          for (char c : s) {
+            switch (c) {
+              case '"':
+                m_out += "\\\"";
+                break;
+              case '\\':
+                m_out += "\\\\";
+                break;
+              case '\b':
+                m_out += "\\b";
+                break;
+              case '\f':
+                m_out += "\\f";
+                break;
+              case '\n':
+                m_out += "\\n";
+                break;
+              case '\r':
+                m_out += "\\r";
+                break;
+              case '\t':
+                m_out += "\\t";
+                break;
+              default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                  m_out += fmt::format("\\u{:04x}", static_cast<unsigned>(c));
+                } else {
+                  m_out += c;
+                }
+            }
+          }
+          m_out += '"';
+        }
+
+        std::string& m_out;
+        std::vector<bool> m_first;
+        bool m_afterKey = false;
+      };
+
+      void writeValue(JsonWriter& writer, const tinygltf::Value& v) {
+        if (v.IsBool()) {
+          writer.value(v.Get<bool>());
+        } else if (v.IsInt()) {
+          writer.value(v.Get<int>());
+        } else if (v.IsReal()) {
+          writer.value(v.Get<double>());
+        } else if (v.IsString()) {
+          writer.value(v.Get<std::string>());
+        } else if (v.IsArray()) {
+          writer.beginArray();
+          for (const auto& item : v.Get<tinygltf::Value::Array>()) {
+            writeValue(writer, item);
+          }
+          writer.endArray();
+        } else if (v.IsObject()) {
+          writer.beginObject();
+          for (const auto& [name, item] : v.Get<tinygltf::Value::Object>()) {
+            writer.key(name);
+            writeValue(writer, item);
+          }
+          writer.endObject();
+        } else {
+          // null and binary values
+          writer.null();
+        }
+      }
+
+      void writeExtras(JsonWriter& writer, const tinygltf::Value& extras) {
+        if (extras.Type() != tinygltf::NULL_TYPE) {
+          writer.key("extras");
+          writeValue(writer, extras);
+        }
+      }
+
+      void writeName(JsonWriter& writer, const std::string& name) {
+        if (!name.empty()) {
+          writer.member("name", name);
+        }
+      }
+
+      std::string accessorType(int type) {
+        switch (type) {
+          case TINYGLTF_TYPE_VEC2:
+            return "VEC2";
+          case TINYGLTF_TYPE_VEC3:
+            return "VEC3";
+          case TINYGLTF_TYPE_VEC4:
+            return "VEC4";
+          case TINYGLTF_TYPE_MAT2:
+            return "MAT2";
+          case TINYGLTF_TYPE_MAT3:
+            return "MAT3";
+          case TINYGLTF_TYPE_MAT4:
+            return "MAT4";
+          default:
+            return "SCALAR";
+        }
+      }
+
+      void writeNode(JsonWriter& writer, const tinygltf::Node& node) {
+        writer.beginObject();
+        writeName(writer, node.name);
+        if (node.mesh >= 0) {
+          writer.member("mesh", node.mesh);
+        }
+        if (!node.children.empty()) {
+          writer.arrayMember("children", node.children);
+        }
+        if (!node.matrix.empty()) {
+          writer.arrayMember("matrix", node.matrix);
+        }
+        if (!node.translation.empty()) {
+          writer.arrayMember("translation", node.translation);
+        }
+        if (!node.rotation.empty()) {
+          writer.arrayMember("rotation", node.rotation);
+        }
+        if (!node.scale.empty()) {
+          writer.arrayMember("scale", node.scale);
+        }
+        writeExtras(writer, node.extras);
+        writer.endObject();
+      }
+
+      void writeMesh(JsonWriter& writer, const tinygltf::Mesh& mesh) {
+        writer.beginObject();
+        writeName(writer, mesh.name);
+        writer.key("primitives");
+        writer.beginArray();
+        for (const auto& primitive : mesh.primitives) {
+          writer.beginObject();
+          writer.key("attributes");
+          writer.beginObject();
+          for (const auto& [name, accessor] : primitive.attributes) {
+            writer.member(name, accessor);
+          }
+          writer.endObject();
+          if (primitive.indices >= 0) {
+            writer.member("indices", primitive.indices);
+          }
+          if (primitive.material >= 0) {
+            writer.member("material", primitive.material);
+          }
+          if (primitive.mode >= 0) {
+            writer.member("mode", primitive.mode);
+          }
+          writeExtras(writer, primitive.extras);
+          writer.endObject();
+        }
+        writer.endArray();
+        writeExtras(writer, mesh.extras);
+        writer.endObject();
+      }
+
+      // properties equal to their default in the glTF schema are left out
+      void writeMaterial(JsonWriter& writer, const tinygltf::Material& material) {
+        writer.beginObject();
+        writeName(writer, material.name);
+        const tinygltf::PbrMetallicRoughness& pbr = material.pbrMetallicRoughness;
+        writer.key("pbrMetallicRoughness");
+        writer.beginObject();
+        if (pbr.baseColorFactor != std::vector<double>{1.0, 1.0, 1.0, 1.0}) {
+          writer.arrayMember("baseColorFactor", pbr.baseColorFactor);
+        }
+        if (pbr.metallicFactor != 1.0) {
+          writer.member("metallicFactor", pbr.metallicFactor);
+        }
+        if (pbr.roughnessFactor != 1.0) {
+          writer.member("roughnessFactor", pbr.roughnessFactor);
+        }
+        writer.endObject();
+        if (material.emissiveFactor != std::vector<double>{0.0, 0.0, 0.0}) {
+          writer.arrayMember("emissiveFactor", material.emissiveFactor);
+        }
+        if (material.alphaMode != "OPAQUE") {
+          writer.member("alphaMode", material.alphaMode);
+        }
+        // alphaCutoff is only valid with the MASK alpha mode
+        if ((material.alphaMode == "MASK") && (material.alphaCutoff != 0.5)) {
+          writer.member("alphaCutoff", material.alphaCutoff);
+        }
+        if (material.doubleSided) {
+          writer.member("doubleSided", true);
+        }
+        writeExtras(writer, material.extras);
+        writer.endObject();
+      }
+
+      void writeAccessor(JsonWriter& writer, const tinygltf::Accessor& accessor) {
+        writer.beginObject();
+        writeName(writer, accessor.name);
+        if (accessor.bufferView >= 0) {
+          writer.member("bufferView", accessor.bufferView);
+        }
+        writer.member("byteOffset", accessor.byteOffset);
+        writer.member("componentType", accessor.componentType);
+        if (accessor.normalized) {
+          writer.member("normalized", true);
+        }
+        writer.member("count", accessor.count);
+        writer.member("type", accessorType(accessor.type));
+        if (!accessor.minValues.empty()) {
+          writer.arrayMember("min", accessor.minValues);
+        }
+        if (!accessor.maxValues.empty()) {
+          writer.arrayMember("max", accessor.maxValues);
+        }
+        writer.endObject();
+      }
+
+      void writeBufferView(JsonWriter& writer, const tinygltf::BufferView& bufferView) {
+        writer.beginObject();
+        writeName(writer, bufferView.name);
+        writer.member("buffer", bufferView.buffer);
+        writer.member("byteOffset", bufferView.byteOffset);
+        writer.member("byteLength", bufferView.byteLength);
+        if (bufferView.byteStride > 0) {
+          writer.member("byteStride", bufferView.byteStride);
+        }
+        if (bufferView.target > 0) {
+          writer.member("target", bufferView.target);
+        }
+        writer.endObject();
+      }
+
+      template <typename T, typename F>
+      void writeArrayMember(JsonWriter& writer, const std::string& name, const std::vector<T>& items, F writeItem) {
+        if (items.empty()) {
+          return;
+        }
+        writer.key(name);
+        writer.beginArray();
+        for (const auto& item : items) {
+          writeItem(writer, item);
+        }
+        writer.endArray();
+      }
+
+      std::string toJson(const tinygltf::Model& model) {
+        std::string result;
+        JsonWriter writer(result);
+        writer.beginObject();
+
+        writer.key("asset");
+        writer.beginObject();
+        writer.member("version", model.asset.version);
+        if (!model.asset.generator.empty()) {
+          writer.member("generator", model.asset.generator);
+        }
+        writer.endObject();
+
+        if (model.defaultScene >= 0) {
+          writer.member("scene", model.defaultScene);
+        }
+        writeArrayMember(writer, "scenes", model.scenes, [](JsonWriter& w, const tinygltf::Scene& scene) {
+          w.beginObject();
+          writeName(w, scene.name);
+          w.arrayMember("nodes", scene.nodes);
+          writeExtras(w, scene.extras);
+          w.endObject();
+        });
+        writeArrayMember(writer, "nodes", model.nodes, writeNode);
+        writeArrayMember(writer, "meshes", model.meshes, writeMesh);
+        writeArrayMember(writer, "materials", model.materials, writeMaterial);
+        writeArrayMember(writer, "accessors", model.accessors, writeAccessor);
+        writeArrayMember(writer, "bufferViews", model.bufferViews, writeBufferView);
+        // the only buffer is the BIN chunk, it has no uri
+        writeArrayMember(writer, "buffers", model.buffers, [](JsonWriter& w, const tinygltf::Buffer& buffer) {
+          w.beginObject();
+          w.member("byteLength", buffer.data.size());
+          w.endObject();
+        });
+        writeExtras(writer, model.extras);
+
+        writer.endObject();
+        return result;
+      }
+
+      void writeUInt32(std::ostream& os, uint32_t value) {
+        const char bytes[4] = {static_cast<char>(value & 0xFF), static_cast<char>((value >> 8) & 0xFF), static_cast<char>((value >> 16) & 0xFF),
+                               static_cast<char>((value >> 24) & 0xFF)};
+        os.write(bytes, 4);
+      }
+
+      size_t paddedSize(size_t size) {
+        return (size + 3) & ~size_t(3);
+      }
+
+    }  // namespace
+
+    bool writeGlb(const tinygltf::Model& model, std::ostream& os) {
+      if (model.buffers.size() > 1) {
+        return false;
+      }
+
+      // the JSON chunk is padded with spaces, the BIN chunk with zeros, both to 4 bytes
+      std::string json = toJson(model);
+      const size_t jsonSize = paddedSize(json.size());
+      json.resize(jsonSize, ' ');
+
+      const std::vector<unsigned char>* bin = model.buffers.empty() ? nullptr : &model.buffers.front().data;
+      const size_t binSize = bin ? paddedSize(bin->size()) : 0;
+
+      size_t totalSize = 12 + 8 + jsonSize;
+      if (bin) {
+        totalSize += 8 + binSize;
+      }
+
+      writeUInt32(os, glbMagic);
+      writeUInt32(os, glbVersion);
+      writeUInt32(os, static_cast<uint32_t>(totalSize));
+
+      writeUInt32(os, static_cast<uint32_t>(jsonSize));
+      writeUInt32(os, glbChunkJson);
+      os.write(json.data(), json.size());
+
+      if (bin) {
+        writeUInt32(os, static_cast<uint32_t>(binSize));
+        writeUInt32(os, glbChunkBin);
+        os.write(reinterpret_cast<const char*>(bin->data()), bin->size());
+        const char zeros[3] = {0, 0, 0};
+        os.write(zeros, binSize - bin->size());
+      }
+
+      return static_cast<bool>(os);
+    }
+
+  }  // namespace detail
+
+}  // namespace gltf
+}  // namespace openstudio
@@ -0,0 +1,31 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef GLTF_GLTFBINARYWRITER_HPP
+#define GLTF_GLTFBINARYWRITER_HPP
+
+#include <ostream>
+
+namespace tinygltf {
+class Model;
+}
+
+namespace openstudio {
+namespace gltf {
+
+  namespace detail {
+
+    /** Writes the subset of a tinygltf::Model produced by GltfForwardTranslator as a binary glTF (.glb) container: the JSON
+     *  chunk is written field by field and the first buffer is copied as is to the BIN chunk, without going through a JSON
+     *  document or base64 encoding the buffer. Textures, images, samplers, skins, animations, cameras and extensions are
+     *  not written. Returns false if the stream fails. */
+    bool writeGlb(const tinygltf::Model& model, std::ostream& os);
+
+  }  // namespace detail
+
+}  // namespace gltf
+}  // namespace openstudio
+
+#endif  // GLTF_GLTFBINARYWRITER_HPP
@@ -10,6 +10,7 @@
 #include "GltfModelObjectMetaData.hpp"
 #include "GltfBoundingBox.hpp"
 #include "GltfMaterialData.hpp"
+#include "GltfBinaryWriter.hpp"
 
 #include "../model/Model.hpp"
 
@@ -48,15 +49,18 @@
 #include "../model/DefaultConstructionSet_Impl.hpp"
 #include "../model/ShadingSurfaceGroup.hpp"
 #include "../model/InteriorPartitionSurfaceGroup.hpp"
+#include "../model/PlanarSurfaceFaces.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
+#include "../utilities/core/Filesystem.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Polygon3d.hpp"
+#include "../utilities/geometry/TriangulationCache.hpp"
 
 #define TINYGLTF_IMPLEMENTATION
 #define STB_IMAGE_IMPLEMENTATION
@@ -236,7 +240,12 @@ namespace gltf {
     // TODO: make it deterministic by sorting!
     // std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
 
-    for (const auto& planarSurface : planarSurfaces) {
+    // triangulate all surfaces in one pass, the cache is shared with the ThreeJS forward translator and across exports
+    std::vector<model::PlanarSurfaceFace> faces = model::planarSurfaceFaces(planarSurfaces, triangulateSurfaces, TriangulationCache::shared());
+
+    for (size_t surfaceIndex = 0; surfaceIndex < planarSurfaces.size(); ++surfaceIndex) {
+      const model::PlanarSurface& planarSurface = planarSurfaces[surfaceIndex];
+      model::PlanarSurfaceFace& face = faces[surfaceIndex];
       // Start Region MAIN LOOP
       //
       // TODO: MOVE THAT ENTIRE LOGIC TO THE GltfUserData file? (and rename to GltfPlanarSurfaceData and make it export a Node directly)
@@ -250,11 +259,8 @@ namespace gltf {
       if (boost::optional<model::PlanarSurfaceGroup> planarSurfaceGroup_ = planarSurface.planarSurfaceGroup()) {
         buildingTransformation = planarSurfaceGroup_->buildingTransformation();
       }
-      // get the vertices
-      Point3dVector vertices = planarSurface.vertices();
-      Transformation& t = transformStack.emplace_back(Transformation::alignFace(vertices));
-      Transformation tInv = t.inverse();
-      Point3dVector faceVertices = reverse(tInv * vertices);
+      // the face vertices and triangulation come from planarSurfaceFaces
+      Transformation& t = transformStack.emplace_back(face.faceTransformation);
       std::vector<double> matrix = openstudio::toStandardVector(buildingTransformation.vector());
 
       // Adding a check to avoid warning "NODE_MATRIX_DEFAULT"  <Do not specify default transform matrix>.
@@ -290,23 +296,15 @@ namespace gltf {
         materials.emplace_back(it2->toGltf());
       }
 
-      // get vertices of all sub surfaces
-      Point3dVectorVector faceSubVertices;
-      if (auto surface_ = planarSurface.optionalCast<model::Surface>()) {
-        for (const auto& subSurface : surface_->subSurfaces()) {
-          faceSubVertices.push_back(reverse(tInv * subSurface.vertices()));
-        }
-      }
-
       Point3dVectorVector finalFaceVertices;
       if (triangulateSurfaces) {
-        finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+        finalFaceVertices = std::move(face.triangulation);
         if (finalFaceVertices.empty()) {
           LOG_FREE(Error, "modelToGLTF",
-                   "Failed to triangulate surface " << planarSurfaceName << " with " << faceSubVertices.size() << " sub surfaces");
+                   "Failed to triangulate surface " << planarSurfaceName << " with " << face.faceSubVertices.size() << " sub surfaces");
         }
       } else {
-        finalFaceVertices.push_back(faceVertices);
+        finalFaceVertices.push_back(face.faceVertices);
       }
 
       Point3dVector allVertices;
@@ -357,16 +355,14 @@ namespace gltf {
       indicesBuffer.push_back(0x00);  // padding bytes
     }
 
-    std::vector<unsigned char> allBuffer = indicesBuffer;  //std::move(_indicesBuffer);
-    allBuffer.insert(allBuffer.end(), coordinatesBuffer.begin(), coordinatesBuffer.end());
-
-    buffer.data = allBuffer;
-
     indicesBv.byteLength = indicesBuffer.size();
     indicesBv.byteOffset = 0;
 
     coordinatesBv.byteLength = coordinatesBuffer.size();
     coordinatesBv.byteOffset = indicesBuffer.size();
+
+    buffer.data = std::move(indicesBuffer);
+    buffer.data.insert(buffer.data.end(), coordinatesBuffer.begin(), coordinatesBuffer.end());
     // End Region BUILD SCENE | ELEMENT
 
     // Other tie ups
@@ -439,6 +435,36 @@ namespace gltf {
     return ret;
   }
 
+  bool GltfForwardTranslator::modelToGLB(const model::Model& model, const path& outputPath) {
+    return modelToGLB(model, [](double percentage) {}, outputPath);
+  }
+
+  bool GltfForwardTranslator::modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath) {
+
+    boost::optional<tinygltf::Model> gltfModel_ = toGltfModel(model, updatePercentage);
+    if (!gltfModel_) {
+      LOG(Error, "Failed to prepare GLTF model");
+      return false;
+    }
+
+    openstudio::filesystem::ofstream file(outputPath, std::ios_base::trunc | std::ios_base::binary);
+    if (!file.is_open()) {
+      LOG(Error, "Cannot open file '" << toString(outputPath) << "' for writing");
+      return false;
+    }
+
+    // The JSON chunk is written straight from the scene description and the buffer goes to the BIN chunk as it is, rather than
+    // through the JSON document and buffer copies of WriteGltfSceneToStream
+    bool ret = detail::writeGlb(*gltfModel_, file);
+    if (!ret) {
+      LOG(Error, "Writing GLB failed");
+    }
+
+    updatePercentage(100.0);
+
+    return ret;
+  }
+
   // TODO: either rename, or properly populate the model...
   // To populate a GLTF Model from an existing GLTF file.
   // also exports a gltf file with a .bin file (non embeded version).
@@ -43,6 +43,10 @@ namespace gltf {
     bool modelToGLTF(const model::Model& model, const path& outputPath);
     bool modelToGLTF(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputpath);
 
+    /** Convert an OpenStudio Model to binary Gltf format (.glb), the geometry buffers are written directly to the file */
+    bool modelToGLB(const model::Model& model, const path& outputPath);
+    bool modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath);
+
     /** Convert an OpenStudio Model to Gltf format but as a JSON string */
     std::string modelToGLTFString(const model::Model& model);
 
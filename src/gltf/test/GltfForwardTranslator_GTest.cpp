@@ -515,6 +515,115 @@ TEST_F(GltfFixture, GltfForwardTranslator_ExampleModel) {
   ASSERT_TRUE(glTFUserData->boundaryMaterialName() == "Boundary_Ground");
 }
 
+static std::string decodeBase64(const std::string& text) {
+  static const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string result;
+  uint32_t bits = 0;
+  int numBits = 0;
+  for (char c : text) {
+    size_t value = alphabet.find(c);
+    if (value == std::string::npos) {
+      break;  // '=' padding
+    }
+    bits = (bits << 6) | static_cast<uint32_t>(value);
+    numBits += 6;
+    if (numBits >= 8) {
+      numBits -= 8;
+      result += static_cast<char>((bits >> numBits) & 0xFF);
+    }
+  }
+  return result;
+}
+
+TEST_F(GltfFixture, GltfForwardTranslator_ExampleModel_GLB) {
+  GltfForwardTranslator ft;
+  Model model = exampleModel();
+
+  openstudio::path outputPath = resourcesPath() / toPath("utilities/Geometry/exampleModel.glb");
+  ASSERT_TRUE(ft.modelToGLB(model, outputPath));
+
+  openstudio::filesystem::ifstream file(outputPath, std::ios_base::binary);
+  ASSERT_TRUE(file.is_open());
+  std::string glb((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  auto readUInt32 = [&glb](size_t offset) {
+    uint32_t result = 0;
+    for (size_t i = 0; i < 4; ++i) {
+      result |= static_cast<uint32_t>(static_cast<unsigned char>(glb[offset + i])) << (8 * i);
+    }
+    return result;
+  };
+
+  // Header, then the JSON and BIN chunks
+  ASSERT_GE(glb.size(), 28);
+  EXPECT_EQ(0x46546C67u, readUInt32(0));
+  EXPECT_EQ(2u, readUInt32(4));
+  EXPECT_EQ(glb.size(), readUInt32(8));
+  uint32_t jsonLength = readUInt32(12);
+  EXPECT_EQ(0x4E4F534Au, readUInt32(16));
+  EXPECT_EQ(0u, jsonLength % 4);
+  ASSERT_LE(20 + jsonLength + 8, glb.size());
+  uint32_t binLength = readUInt32(20 + jsonLength);
+  EXPECT_EQ(0x004E4942u, readUInt32(24 + jsonLength));
+  EXPECT_EQ(0u, binLength % 4);
+  EXPECT_EQ(glb.size(), 28 + jsonLength + binLength);
+
+  // The JSON chunk describes the same model as the .gltf file
+  Json::Value glbJson;
+  Json::CharReaderBuilder rbuilder;
+  std::istringstream ss(glb.substr(20, jsonLength));
+  std::string formattedErrors;
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, ss, &glbJson, &formattedErrors)) << formattedErrors;
+
+  Json::Value gltfJson;
+  std::istringstream ss2(ft.modelToGLTFString(model));
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, ss2, &gltfJson, &formattedErrors)) << formattedErrors;
+
+  EXPECT_EQ("2.0", glbJson["asset"]["version"].asString());
+  EXPECT_EQ("OpenStudio", glbJson["asset"]["generator"].asString());
+  for (const std::string& key : {"nodes", "meshes", "materials", "accessors", "bufferViews"}) {
+    EXPECT_EQ(gltfJson[key].size(), glbJson[key].size()) << key;
+  }
+  ASSERT_EQ(31, glbJson["nodes"].size());
+  for (Json::ArrayIndex i = 0; i < glbJson["nodes"].size(); ++i) {
+    const Json::Value& gltfNode = gltfJson["nodes"][i];
+    const Json::Value& glbNode = glbJson["nodes"][i];
+    EXPECT_EQ(gltfNode["name"], glbNode["name"]);
+    EXPECT_EQ(gltfNode["mesh"], glbNode["mesh"]);
+    EXPECT_EQ(gltfNode["children"], glbNode["children"]);
+    EXPECT_EQ(gltfNode["extras"], glbNode["extras"]);
+  }
+  for (Json::ArrayIndex i = 0; i < glbJson["accessors"].size(); ++i) {
+    const Json::Value& gltfAccessor = gltfJson["accessors"][i];
+    const Json::Value& glbAccessor = glbJson["accessors"][i];
+    EXPECT_EQ(gltfAccessor["bufferView"].asInt(), glbAccessor["bufferView"].asInt());
+    EXPECT_EQ(gltfAccessor["byteOffset"].asUInt(), glbAccessor["byteOffset"].asUInt());
+    EXPECT_EQ(gltfAccessor["componentType"].asInt(), glbAccessor["componentType"].asInt());
+    EXPECT_EQ(gltfAccessor["count"].asUInt(), glbAccessor["count"].asUInt());
+    EXPECT_EQ(gltfAccessor["type"].asString(), glbAccessor["type"].asString());
+  }
+  for (Json::ArrayIndex i = 0; i < glbJson["bufferViews"].size(); ++i) {
+    EXPECT_EQ(gltfJson["bufferViews"][i]["byteOffset"].asUInt(), glbJson["bufferViews"][i]["byteOffset"].asUInt());
+    EXPECT_EQ(gltfJson["bufferViews"][i]["byteLength"].asUInt(), glbJson["bufferViews"][i]["byteLength"].asUInt());
+  }
+  EXPECT_EQ(gltfJson["scenes"][0]["extras"], glbJson["scenes"][0]["extras"]);
+  ASSERT_EQ(1, glbJson["buffers"].size());
+  EXPECT_EQ(gltfJson["buffers"][0]["byteLength"], glbJson["buffers"][0]["byteLength"]);
+  EXPECT_FALSE(glbJson["buffers"][0].isMember("uri"));
+  EXPECT_LE(glbJson["buffers"][0]["byteLength"].asUInt(), binLength);
+
+  // The BIN chunk holds the same bytes as the base64 buffer of the .gltf file, padded with zeros
+  const std::string uri = gltfJson["buffers"][0]["uri"].asString();
+  const std::string prefix = "data:application/octet-stream;base64,";
+  ASSERT_EQ(0u, uri.rfind(prefix, 0));
+  const std::string buffer = decodeBase64(uri.substr(prefix.size()));
+  ASSERT_EQ(glbJson["buffers"][0]["byteLength"].asUInt(), buffer.size());
+  EXPECT_TRUE(glb.compare(28 + jsonLength, buffer.size(), buffer) == 0);
+  for (size_t i = 28 + jsonLength + buffer.size(); i < glb.size(); ++i) {
+    EXPECT_EQ('\0', glb[i]);
+  }
+}
+
 TEST_F(GltfFixture, GltfForwardTranslator_ParkUnder_Retail_Office_C2) {
   GltfForwardTranslator ft;
   openstudio::path output;
@@ -5,6 +5,8 @@
 
 #include "SimModel.hpp"
 
+#include "../utilities/core/ParallelFor.hpp"
+
 #include <cmath>
 #include <array>
 
@@ -250,6 +252,11 @@ namespace isomodel {
     return va;
   }
 
+  /// scalar division, with the same divide by zero convention as div
+  static inline double safeDiv(double v1, double v2) {
+    return (v2 == 0) ? std::numeric_limits<double>::max() : v1 / v2;
+  }
+
   //End Utility Functions
   constexpr double daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
   constexpr double hoursInMonth[] = {744, 672, 744, 720, 744, 720, 744, 744, 720, 744, 720, 744};
@@ -320,8 +327,9 @@ namespace isomodel {
                                          const Vector& clockHourOccupied, const Vector& clockHourUnoccupied, Vector& v_hrs_sun_down_mo,
                                          Vector& frac_Pgh_wk_nt, Vector& frac_Pgh_wke_day, Vector& frac_Pgh_wke_nt, Vector& v_Tdbt_nt) const {
 
-    Matrix m_mhEgh = location->weather()->mhEgh();
-    Matrix m_mhdbt = location->weather()->mhdbt();
+    // the weather is shared between variants, read it in place
+    const Matrix& m_mhEgh = location->weather()->mhEgh();
+    const Matrix& m_mhdbt = location->weather()->mhdbt();
 
     // TODO: unreadVariable
     // Vector v_Tdbt_Day = prod(m_mhdbt, clockHourOccupied);
@@ -1310,31 +1318,6 @@ tot_env_A=sum(In.wall_area)+sum(In.win_area);
     double h_stack = n_zone_frac * vent_zone_height;
     double n_stack_exp = 0.667;  //% reset the pressure exponent to 0.667 for this part of the calc
     double n_stack_coeff = 0.0146;
-    Vector dbtDiff = dif(location->weather()->mdbt(), v_Th_avg);
-    printVector("dbtDiff", dbtDiff);
-    Vector dbtDiffAbs = abs(dbtDiff);
-    printVector("dbtDiffAbs", dbtDiffAbs);
-    Vector dbtHStack = mult(dbtDiffAbs, h_stack);
-    printVector("dbtHstack", dbtHStack);
-    Vector dbtPowered = pow(dbtHStack, n_stack_exp);
-    printVector("dbtPowered", dbtPowered);
-    Vector dbtMultQ4 = mult(dbtPowered, n_stack_coeff * v_Q4pa);
-    printVector("dbtMultQ4", dbtMultQ4);
-
-    Vector v_qv_stack_ht = maximum(dbtMultQ4, 0.001);  //%qv_stack_heating m3/h/m2
-    dbtDiff = dif(location->weather()->mdbt(), v_Tc_avg);
-    printVector("dbtDiff", dbtDiff);
-    dbtDiffAbs = abs(dbtDiff);
-    printVector("dbtDiffAbs", dbtDiffAbs);
-    dbtHStack = mult(dbtDiffAbs, h_stack);
-    printVector("dbtHstack", dbtHStack);
-    dbtPowered = pow(dbtHStack, n_stack_exp);
-    printVector("dbtPowered", dbtPowered);
-    dbtMultQ4 = mult(dbtPowered, n_stack_coeff * v_Q4pa);
-    printVector("dbtMultQ4", dbtMultQ4);
-    Vector v_qv_stack_cl = maximum(dbtMultQ4, 0.001);  //%qv_stack_cooling
-    printVector("v_qv_stack_ht", v_qv_stack_ht);
-    printVector("v_qv_stack_cl", v_qv_stack_cl);
 
     /*
 % infiltration data from
@@ -1360,32 +1343,7 @@ v_qv_stack_cl=max(n_stack_coeff.*v_Q4pa*(h_stack.*abs(W.mdbt-v_Tc_avg)).^n_stack
     double n_wind_coeff = 0.0769;
     double n_dCp = 0.75;  // % conventional value for cp difference between windward and leeward sides for low rise buildings as per 15242
 
-    Vector v_qv_wind_ht =
-      mult(mult(pow(mult(mult(location->weather()->mwind(), location->weather()->mwind()), n_dCp * location->terrain()), n_wind_exp), v_Q4pa),
-           n_wind_coeff);  // % qv_wind_heating
-    Vector v_qv_wind_cl =
-      mult(mult(pow(mult(mult(location->weather()->mwind(), location->weather()->mwind()), n_dCp * location->terrain()), n_wind_exp), v_Q4pa),
-           n_wind_coeff);  // % qv_wind_cooling
-
-    printVector("v_qv_wind_ht", v_qv_wind_ht);
-    printVector("v_qv_wind_cl", v_qv_wind_cl);
-
     double n_sw_coeff = 0.14;
-    Vector v_qv_ht_max = maximum(v_qv_stack_ht, v_qv_wind_ht);
-    Vector v_qv_cl_max = maximum(v_qv_stack_cl, v_qv_wind_cl);
-    printVector("v_qv_ht_max", v_qv_ht_max);
-    printVector("v_qv_cl_max", v_qv_cl_max);
-
-    Vector v_qv_sw_ht = sum(v_qv_ht_max, div(mult(mult(v_qv_stack_ht, v_qv_wind_ht), n_sw_coeff), v_Q4pa));  // %qv_sw_heat m3/h/m2
-    Vector v_qv_sw_cl = sum(v_qv_cl_max, div(mult(mult(v_qv_stack_cl, v_qv_wind_cl), n_sw_coeff), v_Q4pa));  // %qv_sw_cool m3/h/m2
-
-    printVector("v_qv_sw_ht", v_qv_sw_ht);
-    printVector("v_qv_sw_cl", v_qv_sw_cl);
-
-    Vector v_qv_inf_ht = sum(v_qv_sw_ht, std::max(0.0, -qv_diff));  // %q_inf_heat m3/h/m2
-    Vector v_qv_inf_cl = sum(v_qv_sw_cl, std::max(0.0, -qv_diff));  // %q_inf_cool m3/h/m2
-    printVector("v_qv_inf_ht", v_qv_inf_ht);
-    printVector("v_qv_inf_cl", v_qv_inf_cl);
 
     /*
 % calculate infiltration from wind
@@ -1443,20 +1401,29 @@ else
 end
 */
     double initVal = ventilation->type() == 3 ? 0 : (vent_op_frac * qv_supp * vent_outdoor_frac * (1 - vent_ht_recov));
-    Vector v_qv_mve_ht(12);
-    Vector v_qv_mve_cl(12);
-    for (size_t i = 0; i < v_qv_mve_ht.size(); i++) {
-      v_qv_mve_cl[i] = v_qv_mve_ht[i] = initVal;
-    }
-    Vector v_qve_ht = sum(v_qv_inf_ht, v_qv_mve_ht);
-    Vector v_qve_cl = sum(v_qv_inf_cl, v_qv_mve_cl);
-    printVector("v_qve_ht", v_qve_ht);
-    printVector("v_qve_cl", v_qve_cl);
 
     double n_rhoc_air = 1200;
 
-    v_Hve_ht = div(mult(v_qve_ht, n_rhoc_air), 3600.0);
-    v_Hve_cl = div(mult(v_qve_cl, n_rhoc_air), 3600.0);
+    // stack, wind and mechanical ventilation are computed month by month in a single pass, without temporary vectors.
+    // The operations are done in the same order as the vector expressions in the comments, so results are unchanged
+    const Vector& mdbt = location->weather()->mdbt();
+    const Vector& mwind = location->weather()->mwind();
+    const double stackFactor = n_stack_coeff * v_Q4pa;
+    const double windFactor = n_dCp * location->terrain();
+    const double qv_inf_min = std::max(0.0, -qv_diff);
+    v_Hve_ht.resize(12, false);
+    v_Hve_cl.resize(12, false);
+    for (size_t i = 0; i < 12; i++) {
+      double v_qv_stack_ht = std::max(std::pow(std::fabs(mdbt[i] - v_Th_avg[i]) * h_stack, n_stack_exp) * stackFactor, 0.001);
+      double v_qv_stack_cl = std::max(std::pow(std::fabs(mdbt[i] - v_Tc_avg[i]) * h_stack, n_stack_exp) * stackFactor, 0.001);
+      double v_qv_wind = std::pow((mwind[i] * mwind[i]) * windFactor, n_wind_exp) * v_Q4pa * n_wind_coeff;
+      double v_qv_sw_ht = std::max(v_qv_stack_ht, v_qv_wind) + safeDiv(v_qv_stack_ht * v_qv_wind * n_sw_coeff, v_Q4pa);
+      double v_qv_sw_cl = std::max(v_qv_stack_cl, v_qv_wind) + safeDiv(v_qv_stack_cl * v_qv_wind * n_sw_coeff, v_Q4pa);
+      double v_qve_ht = (v_qv_sw_ht + qv_inf_min) + initVal;
+      double v_qve_cl = (v_qv_sw_cl + qv_inf_min) + initVal;
+      v_Hve_ht[i] = v_qve_ht * n_rhoc_air / 3600.0;
+      v_Hve_cl[i] = v_qve_cl * n_rhoc_air / 3600.0;
+    }
     /*
 if In.vent_type==3
     v_qv_mve_ht=zeros(12,1); %qv_me_heating for calc
@@ -1484,16 +1451,19 @@ v_Hve_cl = n_rhoc_air*v_qve_cl/3600; % Hve (W/K/m2)  cooling
   void SimModel::heatingAndCooling(const Vector& v_E_sol, const Vector& v_Th_avg, const Vector& v_Hve_ht, const Vector& v_Tc_avg,
                                    const Vector& v_Hve_cl, double tau, double H_tr, double phi_I_tot, double frac_hrs_wk_day, Vector& v_Qfan_tot,
                                    Vector& v_Qneed_ht, Vector& v_Qneed_cl, double& Qneed_ht_yr, double& Qneed_cl_yr) const {
-    Vector temp = mult(megasecondsInMonth, phi_I_tot, 12);
-    Vector v_tot_mo_ht_gain = sum(temp, v_E_sol);
+    // the monthly needs are computed month by month in a single pass, without temporary vectors.
+    // The operations are done in the same order as the vector expressions in the comments, so results are unchanged
+    const Vector& mdbt = location->weather()->mdbt();
+    const double floorArea = structure->floorArea();
+
+    std::array<double, 12> v_tot_mo_ht_gain;
+    for (size_t i = 0; i < 12; i++) {
+      v_tot_mo_ht_gain[i] = megasecondsInMonth[i] * phi_I_tot + v_E_sol[i];
+    }
 
     double a_H0 = 1;
     double tau_H0 = 15;
     double a_H = a_H0 + tau / tau_H0;
-
-    Vector v_QT_ht = mult(mult(dif(v_Th_avg, location->weather()->mdbt()), megasecondsInMonth), H_tr);
-    Vector v_QV_ht = mult(mult(mult(v_Hve_ht, structure->floorArea()), dif(v_Th_avg, location->weather()->mdbt())), megasecondsInMonth);
-    Vector v_Qtot_ht = sum(v_QT_ht, v_QV_ht);
     /*
   %% Heating and Cooling Needs
 
@@ -1512,13 +1482,16 @@ v_QT_ht = H_tr.*(v_Th_avg-v_mdbt).*v_Msec_ina_mo;  %QT = transmission loss (MJ)
 v_QV_ht = v_Hve_ht*In.cond_flr_area.*(v_Th_avg-v_mdbt).*v_Msec_ina_mo; % QV in MJ
 v_Qtot_ht = v_QT_ht+v_QV_ht ; %QL_total total heat loss in MJ
 */
-    Vector v_gamma_H_ht = div(v_tot_mo_ht_gain, sum(v_Qtot_ht, std::numeric_limits<double>::min()));
-    Vector v_eta_g_H(12);
-    for (size_t i = 0; i < v_eta_g_H.size(); i++) {
-      v_eta_g_H[i] = v_gamma_H_ht(i) > 0 ? (1 - std::pow(v_gamma_H_ht[i], a_H)) / (1 - std::pow(v_gamma_H_ht[i], (a_H + 1)))
-                                         : 1 / (v_gamma_H_ht(i) + std::numeric_limits<double>::min());
+    v_Qneed_ht.resize(12, false);
+    for (size_t i = 0; i < 12; i++) {
+      double v_QT_ht = (v_Th_avg[i] - mdbt[i]) * megasecondsInMonth[i] * H_tr;
+      double v_QV_ht = v_Hve_ht[i] * floorArea * (v_Th_avg[i] - mdbt[i]) * megasecondsInMonth[i];
+      double v_Qtot_ht = v_QT_ht + v_QV_ht;
+      double v_gamma_H_ht = safeDiv(v_tot_mo_ht_gain[i], v_Qtot_ht + std::numeric_limits<double>::min());
+      double v_eta_g_H = v_gamma_H_ht > 0 ? (1 - std::pow(v_gamma_H_ht, a_H)) / (1 - std::pow(v_gamma_H_ht, (a_H + 1)))
+                                          : 1 / (v_gamma_H_ht + std::numeric_limits<double>::min());
+      v_Qneed_ht[i] = v_Qtot_ht - v_eta_g_H * v_tot_mo_ht_gain[i];
     }
-    v_Qneed_ht = dif(v_Qtot_ht, mult(v_eta_g_H, v_tot_mo_ht_gain));
     Qneed_ht_yr = sum(v_Qneed_ht);
 
     /*
@@ -1540,27 +1513,27 @@ v_Qneed_ht = v_Qtot_ht - v_eta_g_H.*v_tot_mo_ht_gain; %QNH = QL,H - eta_G_H.*Q_G
 Qneed_ht_yr = sum(v_Qneed_ht);
    */
 
-    Vector v_QT_cl = mult(mult(dif(v_Tc_avg, location->weather()->mdbt()), H_tr), megasecondsInMonth);  // % QT for cooling in MJ
-    Vector v_QV_cl =
-      mult(mult(mult(v_Hve_cl, structure->floorArea()), dif(v_Tc_avg, location->weather()->mdbt())), megasecondsInMonth);  // % QT for coolin in MJ
-    Vector v_Qtot_cl = sum(v_QT_cl, v_QV_cl);  // % QL = QT + QV for cooling = total cooling heat loss in MJ
+    v_Qneed_cl.resize(12, false);
+    for (size_t i = 0; i < 12; i++) {
+      double v_QT_cl = (v_Tc_avg[i] - mdbt[i]) * H_tr * megasecondsInMonth[i];                   // % QT for cooling in MJ
+      double v_QV_cl = v_Hve_cl[i] * floorArea * (v_Tc_avg[i] - mdbt[i]) * megasecondsInMonth[i];  // % QT for coolin in MJ
+      double v_Qtot_cl = v_QT_cl + v_QV_cl;  // % QL = QT + QV for cooling = total cooling heat loss in MJ
 
-    Vector v_gamma_H_cl = div(v_Qtot_cl, sum(v_tot_mo_ht_gain, std::numeric_limits<double>::min()));  //  %gamma_C = heat loss ratio Qloss/Qgain
+      double v_gamma_H_cl =
+        safeDiv(v_Qtot_cl, v_tot_mo_ht_gain[i] + std::numeric_limits<double>::min());  //  %gamma_C = heat loss ratio Qloss/Qgain
 
-    //% compute the cooling gain utilization factor eta_g_cl
-    Vector v_eta_g_CL(12);
-    for (size_t i = 0; i < v_eta_g_CL.size(); i++) {
+      //% compute the cooling gain utilization factor eta_g_cl
 #ifdef DEBUG_ISO_MODEL_SIMULATION
-      double numer = (1.0 - std::pow(v_gamma_H_cl[i], a_H));
-      //double denom = (1.0-std::pow(v_gamma_H_cl[i],(a_H+1.0)));
-      LOG(Trace, numer << " = 1.0 - " << v_gamma_H_cl[i] << "^" << a_H);
-      LOG(Trace, numer << " = 1.0 - " << v_gamma_H_cl[i] << "^" << (a_H + 1.0));
+      double numer = (1.0 - std::pow(v_gamma_H_cl, a_H));
+      //double denom = (1.0-std::pow(v_gamma_H_cl,(a_H+1.0)));
+      LOG(Trace, numer << " = 1.0 - " << v_gamma_H_cl << "^" << a_H);
+      LOG(Trace, numer << " = 1.0 - " << v_gamma_H_cl << "^" << (a_H + 1.0));
 #endif
 
-      v_eta_g_CL[i] = v_gamma_H_cl(i) > 0.0 ? (1.0 - std::pow(v_gamma_H_cl[i], a_H)) / (1.0 - std::pow(v_gamma_H_cl[i], (a_H + 1.0))) : 1.0;
-    }
+      double v_eta_g_CL = v_gamma_H_cl > 0.0 ? (1.0 - std::pow(v_gamma_H_cl, a_H)) / (1.0 - std::pow(v_gamma_H_cl, (a_H + 1.0))) : 1.0;
 
-    v_Qneed_cl = dif(v_tot_mo_ht_gain, mult(v_eta_g_CL, v_Qtot_cl));  // % QNC = Q_G_C - eta*Q_L_C = total cooling need
+      v_Qneed_cl[i] = v_tot_mo_ht_gain[i] - v_eta_g_CL * v_Qtot_cl;  // % QNC = Q_G_C - eta*Q_L_C = total cooling need
+    }
     Qneed_cl_yr = sum(v_Qneed_cl);
     /*
 % n_a_C0 = 1; %a_C_0 building cooling reference constant
@@ -1602,19 +1575,8 @@ T_sup_cl = In.cl_tset_occ-n_dT_supp_cl;  %cool air supply temp - assume 7C lower
 n_rhoC_a = 1.22521.*0.001012; % rho*Cp for air (MJ/m3/K)
 */
 
-    Vector v_Vair_ht = div(v_Qneed_ht, sum(mult(dif(T_sup_ht, v_Th_avg), n_rhoC_a), std::numeric_limits<double>::min()));
-    Vector v_Vair_cl = div(v_Qneed_cl, sum(mult(dif(v_Tc_avg, T_sup_cl), n_rhoC_a), std::numeric_limits<double>::min()));
-    ventilation->fanPower();
-    ventilation->fanControlFactor();
-    structure->floorArea();
-    printVector("v_Vair_ht", v_Vair_ht);
-    printVector("v_Vair_cl", v_Vair_cl);
-
-    Vector v_Vair_tot = maximum(sum(v_Vair_ht, v_Vair_cl),
-                                div(mult(megasecondsInMonth, ventilation->supplyRate() * frac_hrs_wk_day, 12), 1000));  //% compute air flow in m3
-    printVector("v_Vair_tot", v_Vair_tot);
-    Vector fanPower = mult(v_Vair_tot, ventilation->fanPower() * ventilation->fanControlFactor());
-    printVector("fanPower", fanPower);
+    const double supplyRate = ventilation->supplyRate() * frac_hrs_wk_day;
+    const double fanFactor = ventilation->fanPower() * ventilation->fanControlFactor();
 
 #ifdef DEBUG_ISO_MODEL_SIMULATION
     LOG(Trace, "ventilation->fanPower() = " << ventilation->fanPower());
@@ -1622,7 +1584,14 @@ n_rhoC_a = 1.22521.*0.001012; % rho*Cp for air (MJ/m3/K)
     LOG(Trace, "structure->floorArea() = " << structure->floorArea());
 #endif
 
-    v_Qfan_tot = div(div(fanPower, structure->floorArea()), 3600);  //% compute fan energy in kWh/m2
+    v_Qfan_tot.resize(12, false);
+    for (size_t i = 0; i < 12; i++) {
+      double v_Vair_ht = safeDiv(v_Qneed_ht[i], (T_sup_ht - v_Th_avg[i]) * n_rhoC_a + std::numeric_limits<double>::min());
+      double v_Vair_cl = safeDiv(v_Qneed_cl[i], (v_Tc_avg[i] - T_sup_cl) * n_rhoC_a + std::numeric_limits<double>::min());
+      double v_Vair_tot = std::max(v_Vair_ht + v_Vair_cl, megasecondsInMonth[i] * supplyRate / 1000.0);  //% compute air flow in m3
+      double fanPower = v_Vair_tot * fanFactor;
+      v_Qfan_tot[i] = safeDiv(fanPower, floorArea) / 3600.0;  //% compute fan energy in kWh/m2
+    }
 
     /*
 v_Vair_ht = v_Qneed_ht./(n_rhoC_a.*(T_sup_ht -v_Th_avg)+eps);  %compute volume of air moved for heating
@@ -2209,6 +2178,18 @@ end
                             v_Qcl_gas_tot, v_Q_dhw_gas, frac_hrs_wk_day);
   }
 
+  std::vector<ISOResults> SimModel::simulateBatch(const std::vector<SimModel>& models, unsigned numThreads) {
+    std::vector<ISOResults> results(models.size());
+    if (models.empty()) {
+      return results;
+    }
+
+    // each variant is independent, a failure in one is rethrown here
+    parallelFor(models.size(), [&models, &results](size_t k) { results[k] = models[k].simulate(); }, numThreads);
+
+    return results;
+  }
+
   ISOResults SimModel::outputGeneration(const Vector& v_Qelec_ht, const Vector& v_Qcl_elec_tot, const Vector& v_Q_illum_tot,
                                         const Vector& v_Q_illum_ext_tot, const Vector& v_Qfan_tot, const Vector& v_Q_pump_tot,
                                         const Vector& v_Q_dhw_elec, const Vector& v_Qgas_ht, const Vector& v_Qcl_gas_tot, const Vector& v_Q_dhw_gas,
@@ -89,6 +89,14 @@ namespace isomodel {
      *  returns ISOResults which is a vector of EndUses, one EndUses per month of the year
      */
     ISOResults simulate() const;
+
+    /*
+     *  Runs the ISO Model calculations for a batch of models, e.g. the variants of a parametric sweep, spread over numThreads
+     *  threads (0 uses one thread per processor). Models may share their Location and WeatherData, which are only read.
+     *  returns one ISOResults per model, in the same order, identical to calling simulate() on each model
+     */
+    static std::vector<ISOResults> simulateBatch(const std::vector<SimModel>& models, unsigned numThreads = 0);
+
     REGISTER_LOGGER("openstudio.isomodel.SimModel");
 
    private:
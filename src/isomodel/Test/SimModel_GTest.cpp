@@ -302,3 +302,43 @@ TEST_F(ISOModelFixture, SimModel) {
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
 }
+
+TEST_F(ISOModelFixture, SimModel_Batch) {
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  std::vector<SimModel> models;
+  for (int i = 0; i < 10; ++i) {
+    UserModel variant = userModel;
+    variant.setFloorArea(userModel.floorArea() * (1.0 + 0.1 * i));
+    variant.setHeatingOccupiedSetpoint(userModel.heatingOccupiedSetpoint() - 0.5 * i);
+    models.push_back(variant.toSimModel());
+  }
+
+  std::vector<ISOResults> batchResults = SimModel::simulateBatch(models, 4);
+  ASSERT_EQ(models.size(), batchResults.size());
+
+  const EndUseFuelType::domain fuels[] = {EndUseFuelType::Electricity, EndUseFuelType::Gas};
+  const EndUseCategoryType::domain categories[] = {EndUseCategoryType::Heating,        EndUseCategoryType::Cooling, EndUseCategoryType::InteriorLights,
+                                                   EndUseCategoryType::ExteriorLights, EndUseCategoryType::Fans,    EndUseCategoryType::Pumps,
+                                                   EndUseCategoryType::InteriorEquipment, EndUseCategoryType::WaterSystems};
+  for (size_t i = 0; i < models.size(); ++i) {
+    ISOResults results = models[i].simulate();
+    ASSERT_EQ(results.monthlyResults.size(), batchResults[i].monthlyResults.size());
+    for (size_t month = 0; month < results.monthlyResults.size(); ++month) {
+      for (const auto& fuel : fuels) {
+        for (const auto& category : categories) {
+          // each variant runs through the same code, the results must match exactly
+          EXPECT_EQ(results.monthlyResults[month].getEndUse(fuel, category), batchResults[i].monthlyResults[month].getEndUse(fuel, category));
+        }
+      }
+    }
+  }
+
+  // variants differ from each other
+  EXPECT_NE(batchResults[0].monthlyResults[0].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::Heating),
+            batchResults[9].monthlyResults[0].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::Heating));
+
+  EXPECT_TRUE(SimModel::simulateBatch({}).empty());
+}
@@ -28,6 +28,7 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/ContainersMove.hpp"
@@ -37,6 +38,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <set>
 
 namespace openstudio {
 
@@ -180,10 +182,11 @@ namespace model {
     }
 
     // Recursive depth first search
-    // start algorithm with one source node in the visited vector
+    // start algorithm with one source node in the visited vector and its handle in visitedHandles
     // when complete, paths will be populated with all nodes between the source node and sink
-    void findModelObjects(const HVACComponent& sink, std::vector<HVACComponent>& visited, std::vector<HVACComponent>& paths,
-                          bool isDemandComponents) {
+    // the handle sets mirror visited and paths so membership tests do not scan the vectors
+    void findModelObjects(const HVACComponent& sink, std::vector<HVACComponent>& visited, std::set<Handle>& visitedHandles,
+                          std::vector<HVACComponent>& paths, std::set<Handle>& pathHandles) {
       boost::optional<HVACComponent> prev;
       if (visited.size() >= 2u) {
         prev = visited.rbegin()[1];
@@ -193,48 +196,88 @@ namespace model {
 
       for (const auto& node : nodes) {
         // if it node has already been visited then continue
-        if (std::find(visited.begin(), visited.end(), node) != visited.end()) {
+        if (visitedHandles.count(node.handle()) != 0) {
           continue;
         }
         if (node == sink) {
-          visited.push_back(node);
           // Avoid pushing duplicate nodes into paths
-          if (paths.empty()) {
-            paths.insert(paths.end(), visited.begin(), visited.end());
-          } else {
-            for (const auto& visitedit : visited) {
-              if (std::find(paths.begin(), paths.end(), visitedit) == paths.end()) {
-                paths.push_back(visitedit);
-              }
+          for (const auto& visitedit : visited) {
+            if (pathHandles.insert(visitedit.handle()).second) {
+              paths.push_back(visitedit);
             }
           }
-          visited.pop_back();
+          if (pathHandles.insert(node.handle()).second) {
+            paths.push_back(node);
+          }
         }
       }
 
       for (const auto& node : nodes) {
         // if it node has already been visited or node is sink then continue
-        if (std::find(visited.begin(), visited.end(), node) != visited.end() || node == sink) {
+        if (visitedHandles.count(node.handle()) != 0 || node == sink) {
           continue;
         }
         visited.push_back(node);
-        findModelObjects(sink, visited, paths, isDemandComponents);
+        visitedHandles.insert(node.handle());
+        findModelObjects(sink, visited, visitedHandles, paths, pathHandles);
+        visitedHandles.erase(node.handle());
         visited.pop_back();
       }
     }
 
-    std::vector<ModelObject> Loop_Impl::demandComponents(const HVACComponent& inletComp, const HVACComponent& outletComp,
-                                                         openstudio::IddObjectType type) const {
-      std::vector<HVACComponent> visited;
-      visited.push_back(inletComp);
-      std::vector<HVACComponent> allPaths;
+    std::vector<ModelObject> Loop_Impl::componentsBetween(const HVACComponent& inletComp, const HVACComponent& outletComp) const {
+      Model m = model();
+      const unsigned long long version = m.getImpl<Model_Impl>()->loopTopologyVersion();
+      auto key = std::make_pair(inletComp.handle(), outletComp.handle());
+
+      boost::optional<std::vector<Handle>> cachedHandles;
+      {
+        std::lock_guard<std::mutex> lock(m_cachedComponentsMutex);
+        if (m_cachedComponentsVersion != version) {
+          m_cachedComponents.clear();
+          m_cachedComponentsVersion = version;
+        }
+        auto it = m_cachedComponents.find(key);
+        if (it != m_cachedComponents.end()) {
+          cachedHandles = it->second;
+        }
+      }
+      if (cachedHandles) {
+        std::vector<ModelObject> result = m.getModelObjects<ModelObject>(*cachedHandles);
+        // otherwise a component was removed without any change to the objects pointing at it
+        if (result.size() == cachedHandles->size()) {
+          return result;
+        }
+      }
 
+      std::vector<HVACComponent> allPaths;
       if (inletComp == outletComp) {
         allPaths.push_back(inletComp);
       } else {
-        findModelObjects(outletComp, visited, allPaths, true);
+        std::vector<HVACComponent> visited{inletComp};
+        std::set<Handle> visitedHandles{inletComp.handle()};
+        std::set<Handle> pathHandles;
+        findModelObjects(outletComp, visited, visitedHandles, allPaths, pathHandles);
       }
-      std::vector<ModelObject> modelObjects = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
+
+      std::vector<Handle> handles;
+      handles.reserve(allPaths.size());
+      for (const auto& comp : allPaths) {
+        handles.push_back(comp.handle());
+      }
+      {
+        std::lock_guard<std::mutex> lock(m_cachedComponentsMutex);
+        if (m_cachedComponentsVersion == version) {
+          m_cachedComponents.insert_or_assign(key, std::move(handles));
+        }
+      }
+
+      return {allPaths.begin(), allPaths.end()};
+    }
+
+    std::vector<ModelObject> Loop_Impl::demandComponents(const HVACComponent& inletComp, const HVACComponent& outletComp,
+                                                         openstudio::IddObjectType type) const {
+      std::vector<ModelObject> modelObjects = componentsBetween(inletComp, outletComp);
 
       // Filter modelObjects for type
       if (type != IddObjectType::Catchall) {
@@ -304,16 +347,7 @@ namespace model {
 
     std::vector<ModelObject> Loop_Impl::supplyComponents(const HVACComponent& inletComp, const HVACComponent& outletComp,
                                                          openstudio::IddObjectType type) const {
-      std::vector<HVACComponent> visited;
-      visited.push_back(inletComp);
-      std::vector<HVACComponent> allPaths;
-
-      if (inletComp == outletComp) {
-        allPaths.push_back(inletComp);
-      } else {
-        findModelObjects(outletComp, visited, allPaths, false);
-      }
-      std::vector<ModelObject> modelObjects = std::vector<ModelObject>(allPaths.begin(), allPaths.end());
+      std::vector<ModelObject> modelObjects = componentsBetween(inletComp, outletComp);
 
       // Filter modelObjects for type
       if (type != IddObjectType::Catchall) {
@@ -8,6 +8,10 @@
 
 #include "ParentObject_Impl.hpp"
 
+#include <map>
+#include <mutex>
+#include <utility>
+
 namespace openstudio {
 
 class AppGFuelType;
@@ -109,6 +113,15 @@ namespace model {
      private:
       REGISTER_LOGGER("openstudio.model.Loop");
 
+      // components on the paths from inletComp to outletComp, from m_cachedComponents if possible
+      std::vector<ModelObject> componentsBetween(const HVACComponent& inletComp, const HVACComponent& outletComp) const;
+
+      // handles of the components between (inlet, outlet), valid while Model_Impl::loopTopologyVersion is
+      // m_cachedComponentsVersion. Filled from const getters, which may run on several threads at once
+      mutable std::map<std::pair<Handle, Handle>, std::vector<Handle>> m_cachedComponents;
+      mutable unsigned long long m_cachedComponentsVersion = 0;
+      mutable std::mutex m_cachedComponentsMutex;
+
       boost::optional<ModelObject> supplyInletNodeAsModelObject() const;
       boost::optional<ModelObject> supplyOutletNodeAsModelObject() const;
       boost::optional<ModelObject> demandInletNodeAsModelObject() const;
@@ -44,6 +44,8 @@
 
 #include <boost/regex.hpp>
 
+#include <algorithm>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -157,7 +159,7 @@ namespace model {
 
       if (!result) {
         LOG(Warn, "Creating GenericModelObject for IddObjectType '" << object.iddObject().type().valueName() << "'.");
-        result = std::shared_ptr<GenericModelObject_Impl>(new GenericModelObject_Impl(object, this, keepHandle));
+        result = makeObjectImpl<GenericModelObject_Impl>(object, this, keepHandle);
       }
 
       return result;
@@ -173,8 +175,7 @@ namespace model {
       if (!result) {
         LOG(Warn, "Creating GenericModelObject for IddObjectType '" << originalObjectImplPtr->iddObject().type().valueName() << "'.");
         if (dynamic_pointer_cast<GenericModelObject_Impl>(originalObjectImplPtr)) {
-          result = std::shared_ptr<GenericModelObject_Impl>(
-            new GenericModelObject_Impl(*dynamic_pointer_cast<GenericModelObject_Impl>(originalObjectImplPtr), this, keepHandle));
+          result = makeObjectImpl<GenericModelObject_Impl>(*dynamic_pointer_cast<GenericModelObject_Impl>(originalObjectImplPtr), this, keepHandle);
         } else {
           if (dynamic_pointer_cast<ModelObject_Impl>(originalObjectImplPtr)) {
             std::cout << "Please register copy constructors for IddObjectType '" << originalObjectImplPtr->iddObject().type().valueName() << "'."
@@ -182,13 +183,36 @@ namespace model {
             LOG_AND_THROW("Trying to copy a ModelObject, but the copy constructors are not "
                           << "registered for IddObjectType '" << originalObjectImplPtr->iddObject().type().valueName() << "'.");
           }
-          result = std::shared_ptr<GenericModelObject_Impl>(new GenericModelObject_Impl(*originalObjectImplPtr, this, keepHandle));
+          result = makeObjectImpl<GenericModelObject_Impl>(*originalObjectImplPtr, this, keepHandle);
         }
       }
 
       return result;
     }
 
+    void Model_Impl::objectFieldsChange(const openstudio::detail::WorkspaceObject_Impl& object,
+                                        const std::vector<std::tuple<unsigned, Handle, Handle>>& relationshipChanges) {
+      // components are linked through Connection objects, and loops point at their own nodes
+      IddObjectType type = object.iddObject().type();
+      if ((type == IddObjectType::OS_Connection) || (type == IddObjectType::OS_PlantLoop) || (type == IddObjectType::OS_AirLoopHVAC)) {
+        ++m_loopTopologyVersion;
+        return;
+      }
+      // ports of components, nodes, splitters and mixers refer to Connection objects
+      for (const auto& [index, newHandle, oldHandle] : relationshipChanges) {
+        boost::optional<IddField> field = object.iddObject().getField(index);
+        if (field && (std::find(field->properties().objectLists.begin(), field->properties().objectLists.end(), "ConnectionNames")
+                      != field->properties().objectLists.end())) {
+          ++m_loopTopologyVersion;
+          return;
+        }
+      }
+    }
+
+    unsigned long long Model_Impl::loopTopologyVersion() const {
+      return m_loopTopologyVersion;
+    }
+
     Model Model_Impl::model() const {
       // const cast looks pretty bad but is justified here as this operation does not
       // modify the model, this is similar to a copy constructor, don't abuse it though
@@ -1808,6 +1832,53 @@ namespace model {
       }
     }
 
+    std::vector<WorkspaceObject> Model_Impl::objectsOfImplType(const std::type_info& implType,
+                                                               const std::function<bool(const WorkspaceObject&)>& isOfImplType) const {
+      std::lock_guard<std::mutex> lock(m_implTypeIddObjectTypesMutex);
+      std::map<IddObjectType, bool>& isOfImplTypeByIddObjectType = m_implTypeIddObjectTypes[std::type_index(implType)];
+
+      std::vector<WorkspaceObject> result;
+      for (const IddObjectType& iddObjectType : iddObjectTypes()) {
+        auto it = isOfImplTypeByIddObjectType.find(iddObjectType);
+        if (it != isOfImplTypeByIddObjectType.end() && !it->second) {
+          continue;
+        }
+        std::vector<WorkspaceObject> objects = getObjectsByType(iddObjectType);
+        if (objects.empty()) {
+          continue;
+        }
+        if ((iddObjectType == IddObjectType::UserCustom) || (iddObjectType == IddObjectType::Catchall)) {
+          // objects of different IddObjects share these types, so check each of them
+          std::copy_if(objects.begin(), objects.end(), std::back_inserter(result), isOfImplType);
+          continue;
+        }
+        if (it == isOfImplTypeByIddObjectType.end()) {
+          it = isOfImplTypeByIddObjectType.emplace(iddObjectType, isOfImplType(objects.front())).first;
+          if (!it->second) {
+            continue;
+          }
+        }
+        result.insert(result.end(), objects.begin(), objects.end());
+      }
+      return result;
+    }
+
+    bool Model_Impl::objectIsOfType(const std::type_info& type, const WorkspaceObject& object,
+                                    const std::function<bool(const WorkspaceObject&)>& isOfType) const {
+      IddObjectType iddObjectType = object.iddObject().type();
+      if ((iddObjectType == IddObjectType::UserCustom) || (iddObjectType == IddObjectType::Catchall)) {
+        // objects of different IddObjects share these types, the answer for one does not hold for the others
+        return isOfType(object);
+      }
+      std::lock_guard<std::mutex> lock(m_implTypeIddObjectTypesMutex);
+      std::map<IddObjectType, bool>& isOfTypeByIddObjectType = m_implTypeIddObjectTypes[std::type_index(type)];
+      auto it = isOfTypeByIddObjectType.find(iddObjectType);
+      if (it == isOfTypeByIddObjectType.end()) {
+        it = isOfTypeByIddObjectType.emplace(iddObjectType, isOfType(object)).first;
+      }
+      return it->second;
+    }
+
     void Model_Impl::applySizingValues() {
       for (auto& optModelObj : objects()) {
         if (auto modelObj = optModelObj.optionalCast<HVACComponent>()) {  // HVACComponent
@@ -3443,6 +3514,11 @@ namespace model {
     return getImpl<detail::Model_Impl>()->applySizingValues();
   }
 
+  std::vector<WorkspaceObject> Model::objectsOfImplType(const std::type_info& implType,
+                                                        const std::function<bool(const WorkspaceObject&)>& isOfImplType) const {
+    return getImpl<detail::Model_Impl>()->objectsOfImplType(implType, isOfImplType);
+  }
+
   // Template specializations for getUniqueModelObject to use caching
   template <>
   Building Model::getUniqueModelObject<Building>() {
@@ -3902,7 +3978,7 @@ namespace model {
   detail::Model_Impl::ModelObjectCreator::ModelObjectCreator() {
 #define REGISTER_CONSTRUCTOR(_className)                                                                                           \
   m_newMap[_className::iddObjectType()] = [](openstudio::model::detail::Model_Impl* m, const IdfObject& object, bool keepHandle) { \
-    return std::make_shared<_className##_Impl>(object, m, keepHandle);                                                             \
+    return m->makeObjectImpl<_className##_Impl>(object, m, keepHandle);                                                            \
   };
 
     REGISTER_CONSTRUCTOR(AdditionalProperties);
@@ -4478,10 +4554,10 @@ namespace model {
   m_copyMap[_className::iddObjectType()] = [](openstudio::model::detail::Model_Impl* m,                                                \
                                               const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& ptr, bool keepHandle) { \
     if (dynamic_pointer_cast<_className##_Impl>(ptr)) {                                                                                \
-      return std::make_shared<_className##_Impl>(*dynamic_pointer_cast<_className##_Impl>(ptr), m, keepHandle);                        \
+      return m->makeObjectImpl<_className##_Impl>(*dynamic_pointer_cast<_className##_Impl>(ptr), m, keepHandle);                       \
     } else {                                                                                                                           \
       OS_ASSERT(!dynamic_pointer_cast<openstudio::model::detail::ModelObject_Impl>(ptr));                                              \
-      return std::make_shared<_className##_Impl>(*ptr, m, keepHandle);                                                                 \
+      return m->makeObjectImpl<_className##_Impl>(*ptr, m, keepHandle);                                                                \
     }                                                                                                                                  \
   };
     REGISTER_COPYCONSTRUCTORS(AdditionalProperties);
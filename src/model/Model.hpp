@@ -13,6 +13,8 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/core/Assert.hpp"
 
+#include <functional>
+#include <typeinfo>
 #include <vector>
 
 namespace openstudio {
@@ -474,7 +476,14 @@ namespace model {
     template <typename T>
     std::vector<T> getModelObjects(bool sorted = false) const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> objects = this->objects(sorted);
+      std::vector<WorkspaceObject> objects;
+      if (sorted) {
+        objects = this->objects(true);
+      } else {
+        // only look at the IddObjectTypes whose objects are Ts, rather than casting every object in the model
+        objects = this->objectsOfImplType(typeid(typename T::ImplType),
+                                          [](const WorkspaceObject& wo) { return wo.getImpl<typename T::ImplType>() != nullptr; });
+      }
       result.reserve(objects.size());
       for (const auto& wo : objects) {
         std::shared_ptr<typename T::ImplType> p = wo.getImpl<typename T::ImplType>();
@@ -677,6 +686,9 @@ namespace model {
     /// @endcond
    private:
     REGISTER_LOGGER("openstudio.model.Model");
+
+    std::vector<WorkspaceObject> objectsOfImplType(const std::type_info& implType,
+                                                   const std::function<bool(const WorkspaceObject&)>& isOfImplType) const;
   };
 
   /** \relates Model */
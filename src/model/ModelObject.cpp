@@ -768,6 +768,16 @@ SELECT Value FROM ComponentSizes
     return getImpl<detail::ModelObject_Impl>()->lifeCycleCosts();
   }
 
+  std::vector<WorkspaceObject> ModelObject::sourcesOfType(const std::type_info& type,
+                                                          const std::function<bool(const WorkspaceObject&)>& isOfType) const {
+    if (!initialized()) {
+      return {};
+    }
+    std::shared_ptr<detail::Model_Impl> modelImpl = model().getImpl<detail::Model_Impl>();
+    return getImpl<openstudio::detail::WorkspaceObject_Impl>()->getSourcesOfTypes(
+      [&](const WorkspaceObject& source) { return modelImpl->objectIsOfType(type, source, isOfType); });
+  }
+
   std::vector<IdfObject> ModelObject::removeLifeCycleCosts() {
     return getImpl<detail::ModelObject_Impl>()->removeLifeCycleCosts();
   }
@@ -17,6 +17,8 @@
 #include <boost/optional.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <functional>
+#include <typeinfo>
 #include <vector>
 #include <set>
 
@@ -110,13 +112,12 @@ namespace model {
     template <typename T>
     std::vector<T> getModelObjectSources() const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> wos = sources();
+      // sources are grouped by IddObjectType, only one source of each type needs to be cast
+      std::vector<WorkspaceObject> wos =
+        sourcesOfType(typeid(T), [](const WorkspaceObject& wo) { return static_cast<bool>(wo.optionalCast<T>()); });
       result.reserve(wos.size());
       for (const WorkspaceObject& wo : wos) {
-        boost::optional<T> oSource = wo.optionalCast<T>();
-        if (oSource) {
-          result.emplace_back(*oSource);
-        }
+        result.emplace_back(wo.cast<T>());
       }
       return result;
     }
@@ -280,6 +281,8 @@ namespace model {
 
    private:
     REGISTER_LOGGER("openstudio.model.ModelObject");
+
+    std::vector<WorkspaceObject> sourcesOfType(const std::type_info& type, const std::function<bool(const WorkspaceObject&)>& isOfType) const;
   };
 
   class MODEL_API EMSActuatorNames
@@ -67,6 +67,13 @@
 
 #include <boost/optional.hpp>
 
+#include <atomic>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
 #include <vector>
 
 namespace openstudio {
@@ -397,6 +404,13 @@ namespace model {
       virtual std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>
         createObject(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& originalObjectImplPtr, bool keepHandle) override;
 
+      // Bumps loopTopologyVersion when a connection between components, or a loop's own fields, change
+      virtual void objectFieldsChange(const openstudio::detail::WorkspaceObject_Impl& object,
+                                      const std::vector<std::tuple<unsigned, Handle, Handle>>& relationshipChanges) override;
+
+      /** Changes whenever the components on a loop may have changed, Loop_Impl caches its component paths against it. */
+      unsigned long long loopTopologyVersion() const;
+
       /// Set the WorkflowJSON
       bool setWorkflowJSON(const WorkflowJSON& workflowJSON);
 
@@ -430,6 +444,19 @@ namespace model {
 
       void disconnect(ModelObject object, unsigned port);
 
+      /** Returns the objects of every IddObjectType whose implementation is of the class implType, as decided by
+     *  isOfImplType on one object of that type. Objects of a given IddObjectType always share an implementation class,
+     *  so the answer is remembered and each IddObjectType is only tested once per class. UserCustom and Catchall
+     *  objects do not share an IddObject and are tested one by one. Used by Model::getModelObjects to avoid casting
+     *  every object in the model. */
+      std::vector<WorkspaceObject> objectsOfImplType(const std::type_info& implType,
+                                                     const std::function<bool(const WorkspaceObject&)>& isOfImplType) const;
+
+      /** Returns true if object, and so every object of its IddObjectType, is of the class type, as decided by isOfType.
+     *  The answer is remembered per IddObjectType like in objectsOfImplType, except for UserCustom and Catchall objects
+     *  which are checked one by one. Used by ModelObject::getModelObjectSources. */
+      bool objectIsOfType(const std::type_info& type, const WorkspaceObject& object, const std::function<bool(const WorkspaceObject&)>& isOfType) const;
+
       //@}
       /** @name Nano Signals */
       //@{
@@ -470,6 +497,13 @@ namespace model {
 
       WorkflowJSON m_workflowJSON;
 
+      // for each implementation (or wrapper) class, whether the objects of each IddObjectType seen so far are of that class.
+      // Filled from const getters, which may run on several threads at once, so guarded by m_implTypeIddObjectTypesMutex.
+      mutable std::unordered_map<std::type_index, std::map<IddObjectType, bool>> m_implTypeIddObjectTypes;
+      mutable std::mutex m_implTypeIddObjectTypesMutex;
+
+      std::atomic<unsigned long long> m_loopTopologyVersion{0};
+
      private:
       mutable boost::optional<Building> m_cachedBuilding;
       mutable boost::optional<FoundationKivaSettings> m_cachedFoundationKivaSettings;
@@ -0,0 +1,57 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "PlanarSurfaceFaces.hpp"
+
+#include "PlanarSurface.hpp"
+#include "PlanarSurface_Impl.hpp"
+#include "Surface.hpp"
+#include "Surface_Impl.hpp"
+#include "SubSurface.hpp"
+#include "SubSurface_Impl.hpp"
+
+#include "../utilities/geometry/Geometry.hpp"
+#include "../utilities/geometry/TriangulationCache.hpp"
+
+namespace openstudio {
+namespace model {
+
+  std::vector<PlanarSurfaceFace> planarSurfaceFaces(const std::vector<PlanarSurface>& planarSurfaces, bool triangulate, TriangulationCache& cache) {
+    std::vector<PlanarSurfaceFace> result;
+    result.reserve(planarSurfaces.size());
+
+    // the model is only read from this thread, the cache triangulates the plain vertices on the others
+    std::vector<TriangulationCache::Face> faces;
+    for (const auto& planarSurface : planarSurfaces) {
+      PlanarSurfaceFace& face = result.emplace_back();
+
+      Point3dVector vertices = planarSurface.vertices();
+      face.faceTransformation = Transformation::alignFace(vertices);
+      Transformation tInv = face.faceTransformation.inverse();
+      face.faceVertices = reverse(tInv * vertices);
+
+      if (auto surface = planarSurface.optionalCast<Surface>()) {
+        for (const auto& subSurface : surface->subSurfaces()) {
+          face.faceSubVertices.push_back(reverse(tInv * subSurface.vertices()));
+        }
+      }
+
+      if (triangulate) {
+        faces.push_back(TriangulationCache::Face{face.faceVertices, face.faceSubVertices});
+      }
+    }
+
+    if (triangulate) {
+      std::vector<std::vector<std::vector<Point3d>>> triangulations = cache.triangulate(faces);
+      for (size_t i = 0; i < result.size(); ++i) {
+        result[i].triangulation = std::move(triangulations[i]);
+      }
+    }
+
+    return result;
+  }
+
+}  // namespace model
+}  // namespace openstudio
@@ -0,0 +1,45 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef MODEL_PLANARSURFACEFACES_HPP
+#define MODEL_PLANARSURFACEFACES_HPP
+
+#include "ModelAPI.hpp"
+
+#include "../utilities/geometry/Point3d.hpp"
+#include "../utilities/geometry/Transformation.hpp"
+
+#include <vector>
+
+namespace openstudio {
+
+class TriangulationCache;
+
+namespace model {
+
+  class PlanarSurface;
+
+  /** A PlanarSurface in face coordinates, the way the ThreeJS and glTF forward translators draw it. */
+  struct MODEL_API PlanarSurfaceFace
+  {
+    /// Transformation::alignFace of the vertices of the surface
+    Transformation faceTransformation;
+    /// vertices of the surface in face coordinates, in reverse order
+    std::vector<Point3d> faceVertices;
+    /// vertices of the sub surfaces of a Surface, in the same coordinates and order
+    std::vector<std::vector<Point3d>> faceSubVertices;
+    /// faceVertices minus faceSubVertices as triangles, empty if no triangulation was requested or if it failed
+    std::vector<std::vector<Point3d>> triangulation;
+  };
+
+  /** Computes the faces of planarSurfaces, in the same order. If triangulate is true they are also triangulated through cache, which
+   *  only triangulates the faces it has not seen before and does so on all processors. */
+  MODEL_API std::vector<PlanarSurfaceFace> planarSurfaceFaces(const std::vector<PlanarSurface>& planarSurfaces, bool triangulate,
+                                                              TriangulationCache& cache);
+
+}  // namespace model
+}  // namespace openstudio
+
+#endif  // MODEL_PLANARSURFACEFACES_HPP
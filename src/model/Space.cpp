@@ -104,12 +104,16 @@
 #include "../utilities/geometry/Vector3d.hpp"
 #include "../utilities/geometry/EulerAngles.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
+#include "../utilities/geometry/BoundingBoxIndex.hpp"
+#include "../utilities/geometry/Intersection.hpp"
+#include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/Polygon3d.hpp"
 #include "../utilities/geometry/Polyhedron.hpp"
 
 #include "../utilities/core/ContainersMove.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 
 #undef BOOST_UBLAS_TYPE_CHECK
 #if defined(_MSC_VER)
@@ -2412,6 +2416,20 @@ namespace model {
       // transform from other to this coordinates
       Transformation transformation = this->transformation().inverse() * other.transformation();
 
+      // matching surfaces have the same vertices, so only surfaces with intersecting bounding boxes need to be compared
+      std::vector<Surface> otherSurfaces = other.surfaces();
+      std::vector<std::vector<Point3d>> otherSurfaceVertices;
+      std::vector<BoundingBox> otherBounds;
+      otherSurfaceVertices.reserve(otherSurfaces.size());
+      otherBounds.reserve(otherSurfaces.size());
+      for (const Surface& otherSurface : otherSurfaces) {
+        otherSurfaceVertices.push_back(transformation * otherSurface.vertices());
+        BoundingBox otherBound;
+        otherBound.addPoints(otherSurfaceVertices.back());
+        otherBounds.push_back(otherBound);
+      }
+      BoundingBoxIndex otherIndex(otherBounds);
+
       for (Surface& surface : this->surfaces()) {
         if (surface.adjacentSurface()) {
           continue;
@@ -2422,11 +2440,15 @@ namespace model {
           continue;
         }
 
-        for (Surface& otherSurface : other.surfaces()) {
+        BoundingBox bound;
+        bound.addPoints(vertices);
+
+        for (size_t otherIndexValue : otherIndex.intersecting(bound, tol)) {
+          Surface& otherSurface = otherSurfaces[otherIndexValue];
           if (otherSurface.adjacentSurface()) {
             continue;
           }
-          std::vector<Point3d> otherVertices = transformation * otherSurface.vertices();
+          std::vector<Point3d> otherVertices = otherSurfaceVertices[otherIndexValue];
           boost::optional<Vector3d> otherOutwardNormal = getOutwardNormal(otherVertices);
           if (!otherOutwardNormal) {
             continue;
@@ -2470,6 +2492,11 @@ namespace model {
     }
 
     void Space_Impl::intersectSurfaces(Space& other) {
+      IntersectSurfacesState state;
+      intersectSurfaces(other, state);
+    }
+
+    void Space_Impl::intersectSurfaces(Space& other, IntersectSurfacesState& state) {
       if (this->handle() == other.handle()) {
         return;
       }
@@ -2528,12 +2555,36 @@ namespace model {
             }
             completedIntersections.insert(intersectionKey);
 
+            // precomputed intersections only hold while neither surface has changed since they were computed
+            auto precomputed = state.precomputedIntersections.end();
+            if (!state.changedSurfaces.contains(surface.handle()) && !state.changedSurfaces.contains(otherSurface.handle())) {
+              precomputed = state.precomputedIntersections.find(std::make_pair(surface.handle(), otherSurface.handle()));
+            }
+            if ((precomputed != state.precomputedIntersections.end()) && !precomputed->second.intersection) {
+              continue;
+            }
+
             // number of surfaces in each space will only increase in intersect
-            boost::optional<SurfaceIntersection> intersection = surface.computeIntersection(otherSurface);
+            boost::optional<SurfaceIntersection> intersection;
+            if (precomputed != state.precomputedIntersections.end()) {
+              intersection = surface.getImpl<detail::Surface_Impl>()->applyIntersection(otherSurface, *precomputed->second.intersection,
+                                                                                         precomputed->second.faceTransformation);
+            } else {
+              intersection = surface.computeIntersection(otherSurface);
+            }
             if (intersection) {
               std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
               std::vector<Surface> newSurfaces2 = intersection->newSurfaces2();
 
+              state.changedSurfaces.insert(surface.handle());
+              state.changedSurfaces.insert(otherSurface.handle());
+              for (const Surface& newSurface : newSurfaces1) {
+                state.changedSurfaces.insert(newSurface.handle());
+              }
+              for (const Surface& newSurface : newSurfaces2) {
+                state.changedSurfaces.insert(newSurface.handle());
+              }
+
               // surfaces involved in this intersection are ineligible to be re-intersected with other surfaces in this intersection
               std::vector<Surface> ineligibleSurfaces;
               ineligibleSurfaces.reserve(newSurfaces1.size() + 1);
@@ -3759,6 +3810,110 @@ namespace model {
   Space::Space(std::shared_ptr<detail::Space_Impl> impl) : PlanarSurfaceGroup(std::move(impl)) {}
   /// @endcond
 
+  namespace {
+
+    // Geometry of a surface in building coordinates, copied out of the model so it can be used from other threads
+    struct SurfaceGeometry
+    {
+      Handle handle;
+      bool eligible;
+      std::vector<Point3d> vertices;
+      BoundingBox boundingBox;
+      boost::optional<Plane> plane;
+    };
+
+    // Intersects two surfaces' polygons the same way Surface_Impl::computeIntersection does, without changing the model.
+    // The result has no intersection only if the polygons are valid and do not overlap at all. Returns none if intersect()
+    // failed for any other reason, computeIntersection then repeats the work and reports the problem.
+    boost::optional<detail::PrecomputedIntersection> precomputeIntersection(const SurfaceGeometry& surface, const SurfaceGeometry& otherSurface) {
+      double tol = 0.01;
+
+      if ((surface.vertices.size() < 3) || (otherSurface.vertices.size() < 3)) {
+        return boost::none;
+      }
+
+      detail::PrecomputedIntersection result;
+      Transformation faceTransformationInverse;
+      try {
+        result.faceTransformation = Transformation::alignFace(surface.vertices);
+        faceTransformationInverse = result.faceTransformation.inverse();
+      } catch (const std::exception&) {
+        return boost::none;
+      }
+
+      std::vector<Point3d> faceVertices = faceTransformationInverse * surface.vertices;
+      std::vector<Point3d> otherFaceVertices = faceTransformationInverse * otherSurface.vertices;
+      std::reverse(faceVertices.begin(), faceVertices.end());
+
+      result.intersection = openstudio::intersect(faceVertices, otherFaceVertices, tol);
+      if (!result.intersection) {
+        // intersect() also returns none when it fails part way through, only trust it if the polygons really are disjoint
+        if (selfIntersects(faceVertices, tol) || selfIntersects(otherFaceVertices, tol) || intersects(faceVertices, otherFaceVertices, tol)) {
+          return boost::none;
+        }
+      }
+      return result;
+    }
+
+    // Intersects the original surfaces in the given pairs of spaces. Only reads the model, the polygon intersections are
+    // spread over all processors.
+    std::map<std::pair<Handle, Handle>, detail::PrecomputedIntersection>
+      precomputeIntersections(const std::vector<Space>& spaces, const std::vector<std::pair<size_t, size_t>>& spacePairs) {
+      std::vector<std::vector<SurfaceGeometry>> geometries;
+      geometries.reserve(spaces.size());
+      for (const Space& space : spaces) {
+        Transformation transformation = space.transformation();
+        std::vector<SurfaceGeometry>& spaceGeometries = geometries.emplace_back();
+        for (const Surface& surface : space.surfaces()) {
+          SurfaceGeometry geometry{surface.handle(), surface.subSurfaces().empty() && !surface.adjacentSurface(), {}, {}, boost::none};
+          if (geometry.eligible) {
+            geometry.vertices = transformation * surface.vertices();
+            geometry.boundingBox.addPoints(geometry.vertices);
+            try {
+              geometry.plane = transformation * surface.plane();
+            } catch (const std::exception&) {
+            }
+          }
+          spaceGeometries.push_back(std::move(geometry));
+        }
+      }
+
+      std::map<std::pair<Handle, Handle>, detail::PrecomputedIntersection> result;
+      std::vector<std::pair<const SurfaceGeometry*, const SurfaceGeometry*>> candidates;
+      for (const auto& [i, j] : spacePairs) {
+        for (const SurfaceGeometry& surface : geometries[i]) {
+          if (!surface.eligible || !surface.plane) {
+            continue;
+          }
+          for (const SurfaceGeometry& otherSurface : geometries[j]) {
+            if (!otherSurface.eligible || !otherSurface.plane || !surface.plane->reverseEqual(*otherSurface.plane)) {
+              continue;
+            }
+            if (!surface.boundingBox.intersects(otherSurface.boundingBox)) {
+              result.emplace(std::make_pair(surface.handle, otherSurface.handle), detail::PrecomputedIntersection{});
+            } else {
+              candidates.emplace_back(&surface, &otherSurface);
+            }
+          }
+        }
+      }
+
+      std::vector<boost::optional<detail::PrecomputedIntersection>> intersections(candidates.size());
+      parallelFor(candidates.size(), [&candidates, &intersections](size_t k) {
+        intersections[k] = precomputeIntersection(*candidates[k].first, *candidates[k].second);
+      });
+
+      for (size_t k = 0; k < candidates.size(); ++k) {
+        if (intersections[k]) {
+          result.emplace(std::make_pair(candidates[k].first->handle, candidates[k].second->handle), std::move(*intersections[k]));
+        }
+      }
+
+      return result;
+    }
+
+  }  // namespace
+
   void intersectSurfaces(std::vector<Space>& t_spaces) {
     std::vector<Space> spaces(t_spaces);
     std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) -> bool { return a.floorArea() < b.floorArea(); });
@@ -3768,13 +3923,15 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
-        }
-        spaces[i].intersectSurfaces(spaces[j]);
-      }
+    // pairs come out in the same order as testing every i < j pair would visit them
+    std::vector<std::pair<size_t, size_t>> spacePairs = BoundingBoxIndex(bounds).intersectingPairs();
+
+    // first intersect the original surfaces on all processors, then split surfaces one space pair at a time exactly as
+    // the serial algorithm does, applying the precomputed intersections to surfaces that have not changed since
+    detail::IntersectSurfacesState state;
+    state.precomputedIntersections = precomputeIntersections(spaces, spacePairs);
+    for (const auto& [i, j] : spacePairs) {
+      spaces[i].getImpl<detail::Space_Impl>()->intersectSurfaces(spaces[j], state);
     }
   }
 
@@ -3784,13 +3941,8 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
-        }
-        spaces[i].matchSurfaces(spaces[j]);
-      }
+    for (const auto& [i, j] : BoundingBoxIndex(bounds).intersectingPairs()) {
+      spaces[i].matchSurfaces(spaces[j]);
     }
   }
 
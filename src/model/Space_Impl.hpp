@@ -10,9 +10,16 @@
 #include "PlanarSurfaceGroup_Impl.hpp"
 #include "Surface.hpp"
 
+#include "../utilities/geometry/Intersection.hpp"
+#include "../utilities/geometry/Transformation.hpp"
+
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
 
+#include <map>
+#include <set>
+#include <utility>
+
 namespace openstudio {
 
 class Polygon3d;
@@ -57,6 +64,23 @@ namespace model {
 
   namespace detail {
 
+    /** Intersection of two surfaces computed ahead of time from their vertices in building coordinates. An unset
+     *  intersection means the surfaces are disjoint. */
+    struct PrecomputedIntersection
+    {
+      Transformation faceTransformation;
+      boost::optional<IntersectionResult> intersection;
+    };
+
+    /** State shared by the space pairs intersected by openstudio::model::intersectSurfaces. */
+    struct IntersectSurfacesState
+    {
+      // intersections of the original surfaces keyed by (surface, other surface) handles
+      std::map<std::pair<Handle, Handle>, PrecomputedIntersection> precomputedIntersections;
+      // surfaces changed or created by an intersection, precomputed intersections do not apply to them
+      std::set<Handle> changedSurfaces;
+    };
+
     /** Space_Impl is a PlanarSurfaceGroup_Impl that is the implementation class for Space.*/
     class MODEL_API Space_Impl : public PlanarSurfaceGroup_Impl
     {
@@ -467,6 +491,10 @@ namespace model {
       /** Intersect surfaces in this space with those in the other. */
       void intersectSurfaces(Space& other);
 
+      /** Intersect surfaces in this space with those in the other, sharing state with the other space pairs intersected
+       *  by openstudio::model::intersectSurfaces. */
+      void intersectSurfaces(Space& other, IntersectSurfacesState& state);
+
       /** Find surfaces within angular range, specified in degrees and in the site coordinate system, an unset optional means no limit.
         Values for degrees from North are between 0 and 360 and for degrees tilt they are between 0 and 180.
         Note that maxDegreesFromNorth may be less than minDegreesFromNorth,
@@ -992,8 +992,7 @@ namespace model {
     }
 
     boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface) {
-      double tol = 0.01;       //  1 cm tolerance
-      double areaTol = 0.001;  // 10 cm2 tolerance
+      double tol = 0.01;  //  1 cm tolerance
 
       constexpr bool extraLogging = false;
 
@@ -1068,11 +1067,35 @@ namespace model {
         return boost::none;
       }
 
+      return applyIntersection(otherSurface, *intersection, faceTransformation);
+    }
+
+    boost::optional<SurfaceIntersection> Surface_Impl::applyIntersection(Surface& otherSurface, const IntersectionResult& intersection,
+                                                                         const Transformation& faceTransformation) {
+      double areaTol = 0.001;  // 10 cm2 tolerance
+
+      constexpr bool extraLogging = false;
+
+      boost::optional<Space> space = this->space();
+      boost::optional<Space> otherSpace = otherSurface.space();
+      OS_ASSERT(space);
+      OS_ASSERT(otherSpace);
+
+      // goes from local system to building coordinates
+      Transformation spaceTransformation = space->transformation();
+      Transformation otherSpaceTransformation = otherSpace->transformation();
+
+      // put building vertices into face coordinates
+      Transformation faceTransformationInverse = faceTransformation.inverse();
+      std::vector<Point3d> faceVertices = faceTransformationInverse * (spaceTransformation * this->vertices());
+      std::vector<Point3d> otherFaceVertices = faceTransformationInverse * (otherSpaceTransformation * otherSurface.vertices());
+      std::reverse(faceVertices.begin(), faceVertices.end());
+
       if constexpr (extraLogging) {
         Point3dVectorVector tmp;
-        Point3dVectorVector newPolys = intersection->newPolygons2();
+        Point3dVectorVector newPolys = intersection.newPolygons2();
         tmp.reserve(newPolys.size() + 1);
-        tmp.push_back(intersection->polygon2());
+        tmp.push_back(intersection.polygon2());
         tmp.insert(tmp.end(), std::make_move_iterator(newPolys.begin()), std::make_move_iterator(newPolys.end()));
         LOG(Debug, tmp);
       }
@@ -1083,30 +1106,30 @@ namespace model {
       boost::optional<double> area1 = getArea(faceVertices);
       boost::optional<double> area2 = getArea(otherFaceVertices);
       if (area1) {
-        if (std::abs(area1.get() - intersection->area1()) > areaTol) {
+        if (std::abs(area1.get() - intersection.area1()) > areaTol) {
           LOG(Error, "Initial area of surface '" << this->nameString() << "' " << area1.get() << " does not equal post intersection area "
-                                                 << intersection->area1());
+                                                 << intersection.area1());
           if constexpr (extraLogging) {
             Point3dVectorVector tmp1{faceVertices, otherFaceVertices};
             LOG(Debug, tmp1);
             Point3dVectorVector tmp;
-            tmp.push_back(intersection->polygon1());
-            for (auto& x : intersection->newPolygons1())
+            tmp.push_back(intersection.polygon1());
+            for (auto& x : intersection.newPolygons1())
               tmp.push_back(x);
             LOG(Debug, tmp);
           }
         }
       }
       if (area2) {
-        if (std::abs(area2.get() - intersection->area2()) > areaTol) {
+        if (std::abs(area2.get() - intersection.area2()) > areaTol) {
           LOG(Error, "Initial area of other surface '" << otherSurface.nameString() << "' " << area2.get()
-                                                       << " does not equal post intersection area " << intersection->area2());
+                                                       << " does not equal post intersection area " << intersection.area2());
           if constexpr (extraLogging) {
             Point3dVectorVector tmp1{faceVertices, otherFaceVertices};
             LOG(Debug, tmp1);
             Point3dVectorVector tmp;
-            tmp.push_back(intersection->polygon2());
-            for (auto& x : intersection->newPolygons2())
+            tmp.push_back(intersection.polygon2());
+            for (auto& x : intersection.newPolygons2())
               tmp.push_back(x);
             LOG(Debug, tmp);
           }
@@ -1127,11 +1150,11 @@ namespace model {
       Transformation spaceTransformationInverse = spaceTransformation.inverse();
       Transformation otherSpaceTransformationInverse = otherSpaceTransformation.inverse();
 
-      std::vector<std::vector<Point3d>> newPolygons1 = intersection->newPolygons1();
-      std::vector<std::vector<Point3d>> newPolygons2 = intersection->newPolygons2();
+      std::vector<std::vector<Point3d>> newPolygons1 = intersection.newPolygons1();
+      std::vector<std::vector<Point3d>> newPolygons2 = intersection.newPolygons2();
 
       // modify vertices for surface in this space
-      std::vector<Point3d> newBuildingVertices = faceTransformation * intersection->polygon1();
+      std::vector<Point3d> newBuildingVertices = faceTransformation * intersection.polygon1();
       std::vector<Point3d> newVertices = spaceTransformationInverse * newBuildingVertices;
       std::reverse(newVertices.begin(), newVertices.end());
       newVertices = reorderULC(newVertices);
@@ -1139,7 +1162,7 @@ namespace model {
       //this->setAdjacentSurface(otherSurface);
 
       // modify vertices for surface in other space
-      std::vector<Point3d> newOtherBuildingVertices = faceTransformation * intersection->polygon2();
+      std::vector<Point3d> newOtherBuildingVertices = faceTransformation * intersection.polygon2();
       std::vector<Point3d> newOtherVertices = otherSpaceTransformationInverse * newOtherBuildingVertices;
       newOtherVertices = reorderULC(newOtherVertices);
       otherSurface.setVertices(newOtherVertices);
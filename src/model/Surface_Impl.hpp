@@ -11,6 +11,8 @@
 
 namespace openstudio {
 class Polygon3d;
+class IntersectionResult;
+class Transformation;
 namespace model {
 
   class AirflowNetworkSurface;
@@ -202,6 +204,12 @@ namespace model {
       bool intersect(Surface& otherSurface);
       boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface);
 
+      /** Applies an intersection with otherSurface computed by openstudio::intersect, faceTransformation goes from the face
+       *  coordinates the intersection was computed in to building coordinates. Used to apply intersections that were computed
+       *  ahead of time, the surfaces must not have changed since. */
+      boost::optional<SurfaceIntersection> applyIntersection(Surface& otherSurface, const IntersectionResult& intersection,
+                                                             const Transformation& faceTransformation);
+
       boost::optional<Surface> createAdjacentSurface(const Space& otherSpace);
 
       bool isPartOfEnvelope() const;
@@ -39,6 +39,7 @@
 #include "DefaultConstructionSet_Impl.hpp"
 #include "ShadingSurfaceGroup.hpp"
 #include "InteriorPartitionSurfaceGroup.hpp"
+#include "PlanarSurfaceFaces.hpp"
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
@@ -48,6 +49,7 @@
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/ThreeJS.hpp"
+#include "../utilities/geometry/TriangulationCache.hpp"
 
 #include <thread>
 
@@ -323,10 +325,9 @@ namespace model {
     }
   }
 
-  void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas,
-                      bool triangulateSurfaces, bool includeGeometryDiagnostics) {
+  void makeGeometries(const PlanarSurface& planarSurface, const PlanarSurfaceFace& face, std::vector<ThreeGeometry>& geometries,
+                      std::vector<ThreeUserData>& userDatas, bool triangulateSurfaces, bool includeGeometryDiagnostics) {
     std::string name = planarSurface.nameString();
-    boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
     boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
 
     // get the transformation to site coordinates
@@ -335,30 +336,20 @@ namespace model {
       buildingTransformation = planarSurfaceGroup->buildingTransformation();
     }
 
-    // get the vertices
+    // the surface's own vertices, in space coordinates, to compare with an adjacent surface; the face and sub surface
+    // vertices in face coordinates come from planarSurfaceFaces
     Point3dVector vertices = planarSurface.vertices();
-    Transformation t = Transformation::alignFace(vertices);
-    //Transformation r = t.rotationMatrix();
-    Transformation tInv = t.inverse();
-    Point3dVector faceVertices = reverse(tInv * vertices);
-
-    // get vertices of all sub surfaces
-    Point3dVectorVector faceSubVertices;
-    if (surface) {
-      for (const auto& subSurface : surface->subSurfaces()) {
-        faceSubVertices.push_back(reverse(tInv * subSurface.vertices()));
-      }
-    }
+    const Transformation& t = face.faceTransformation;
 
     Point3dVectorVector finalFaceVertices;
     if (triangulateSurfaces) {
-      finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+      finalFaceVertices = face.triangulation;
       if (finalFaceVertices.empty()) {
-        LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
+        LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << face.faceSubVertices.size() << " sub surfaces");
         return;
       }
     } else {
-      finalFaceVertices.push_back(faceVertices);
+      finalFaceVertices.push_back(face.faceVertices);
     }
 
     Point3dVector allVertices;
@@ -499,11 +490,15 @@ namespace model {
       }
     }
 
+    // triangulate all surfaces in one pass, the cache is shared with the glTF forward translator and across exports
+    std::vector<PlanarSurfaceFace> faces = planarSurfaceFaces(planarSurfaces, triangulateSurfaces, TriangulationCache::shared());
+
     // loop over all surfaces
-    for (const auto& planarSurface : planarSurfaces) {
+    for (size_t surfaceIndex = 0; surfaceIndex < planarSurfaces.size(); ++surfaceIndex) {
+      const PlanarSurface& planarSurface = planarSurfaces[surfaceIndex];
       std::vector<ThreeGeometry> geometries;
       std::vector<ThreeUserData> userDatas;
-      makeGeometries(planarSurface, geometries, userDatas, triangulateSurfaces, m_includeGeometryDiagnostics);
+      makeGeometries(planarSurface, faces[surfaceIndex], geometries, userDatas, triangulateSurfaces, m_includeGeometryDiagnostics);
       OS_ASSERT(geometries.size() == userDatas.size());
 
       size_t n = geometries.size();
@@ -88,6 +88,11 @@ static void BM_SetUpPlantLoop(benchmark::State& state) {
         CoilHeatingWater coil(m, alwaysOn);
         p.addDemandBranchForComponent(coil);
       }
+
+      // The kind of queries ForwardTranslator makes once the loop is set up
+      benchmark::DoNotOptimize(p.supplyComponents());
+      benchmark::DoNotOptimize(p.demandComponents());
+      benchmark::DoNotOptimize(p.demandComponents(IddObjectType::OS_Coil_Heating_Water));
     }
   }
 
@@ -95,6 +100,33 @@ static void BM_SetUpPlantLoop(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// Repeated topology queries on one plant loop with n demand branches, without modifying the model in between
+static void BM_PlantLoopComponentQueries(benchmark::State& state) {
+
+  Model m;
+  Schedule alwaysOn = m.alwaysOnDiscreteSchedule();
+
+  PlantLoop p(m);
+  BoilerHotWater b(m);
+  p.addSupplyBranchForComponent(b);
+  ChillerElectricEIR ch(m);
+  p.addSupplyBranchForComponent(ch);
+  for (auto i = 0; i < state.range(0); ++i) {
+    CoilHeatingWater coil(m, alwaysOn);
+    p.addDemandBranchForComponent(coil);
+  }
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(p.supplyComponents());
+    benchmark::DoNotOptimize(p.demandComponents());
+    benchmark::DoNotOptimize(p.demandComponents(IddObjectType::OS_Coil_Heating_Water));
+    benchmark::DoNotOptimize(p.component(b.handle()));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -110,3 +142,5 @@ BENCHMARK(BM_AddObjects)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Ran
 // 128 takes 14secs,  512 takes about 300 seconds, 1024 takes 20 minutes. By interpolation, 4096 would take 636 minutes, 8192 = 2567 minutes = 42 h
 // 'y[ms] = 1.156580334046908*x**2 + -72.31709114930806*x + 1397.3555792110117'
 BENCHMARK(BM_SetUpPlantLoop)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(1, 128)->Complexity();
+
+BENCHMARK(BM_PlantLoopComponentQueries)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(4, 256)->Complexity();
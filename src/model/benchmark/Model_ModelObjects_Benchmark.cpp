@@ -11,6 +11,18 @@
 #include "../Surface_Impl.hpp"
 #include "../ModelObject.hpp"
 #include "../ModelObject_Impl.hpp"
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
+#include "../Lights.hpp"
+#include "../Lights_Impl.hpp"
+#include "../LightsDefinition.hpp"
+#include "../LightsDefinition_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
+#include "../SpaceLoad.hpp"
+#include "../SpaceLoad_Impl.hpp"
+#include "../ResourceObject.hpp"
+#include "../ResourceObject_Impl.hpp"
 
 #include "../../utilities/idf/WorkspaceObject.hpp"
 #include "../../utilities/geometry/Point3d.hpp"
@@ -35,6 +47,63 @@ model::Model makeModelWithNSurfaces(size_t nSurfaces) {
   return m;
 }
 
+// Roughly nObjects objects, a mix of Spaces, Surfaces, Lights and LightsDefinitions
+static model::Model makeModelWithNMixedObjects(size_t nObjects) {
+  Model m;
+  Point3dVector pts{{0, 0, 0}, {0, 1, 0}, {1, 1, 0}, {1, 0, 0}};
+
+  for (size_t i = 0; i < nObjects / 4; ++i) {
+    Space space(m);
+    Surface surface(pts, m);
+    surface.setSpace(space);
+    LightsDefinition definition(m);
+    Lights lights(definition);
+    lights.setSpace(space);
+  }
+
+  return m;
+}
+
+// What getModelObjects<T> used to do for abstract T: cast every object in the model
+template <typename T>
+std::vector<T> getModelObjectsByCastingAll(const Model& m) {
+  std::vector<T> result;
+  for (const auto& wo : m.objects()) {
+    if (auto t_ = wo.optionalCast<T>()) {
+      result.push_back(std::move(*t_));
+    }
+  }
+  return result;
+}
+
+static void BM_GetAbstractModelObjectsByCastingAll(benchmark::State& state) {
+
+  Model m = makeModelWithNMixedObjects(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(getModelObjectsByCastingAll<PlanarSurface>(m));
+    benchmark::DoNotOptimize(getModelObjectsByCastingAll<SpaceLoad>(m));
+    benchmark::DoNotOptimize(getModelObjectsByCastingAll<ResourceObject>(m));
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_GetAbstractModelObjects(benchmark::State& state) {
+
+  Model m = makeModelWithNMixedObjects(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.getModelObjects<PlanarSurface>());
+    benchmark::DoNotOptimize(m.getModelObjects<SpaceLoad>());
+    benchmark::DoNotOptimize(m.getModelObjects<ResourceObject>());
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
 static void Current(benchmark::State& state) {
 
   Model m = makeModelWithNSurfaces(state.range(0));
@@ -145,3 +214,7 @@ BENCHMARK(ProposedEmplace)
   ->RangeMultiplier(2)
   ->Range(4, 1024)
   ->Complexity();
+
+BENCHMARK(BM_GetAbstractModelObjectsByCastingAll)->Unit(benchmark::kMillisecond)->RangeMultiplier(10)->Range(1000, 100000)->Complexity();
+
+BENCHMARK(BM_GetAbstractModelObjects)->Unit(benchmark::kMillisecond)->RangeMultiplier(10)->Range(1000, 100000)->Complexity();
@@ -0,0 +1,114 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
+#include "../Surface.hpp"
+#include "../Surface_Impl.hpp"
+#include "../SpaceLoad.hpp"
+#include "../SpaceLoad_Impl.hpp"
+#include "../Lights.hpp"
+#include "../Lights_Impl.hpp"
+#include "../LightsDefinition.hpp"
+#include "../LightsDefinition_Impl.hpp"
+#include "../People.hpp"
+#include "../People_Impl.hpp"
+#include "../PeopleDefinition.hpp"
+#include "../PeopleDefinition_Impl.hpp"
+#include "../ThermalZone.hpp"
+#include "../ThermalZone_Impl.hpp"
+#include "../ZoneHVACBaseboardConvectiveElectric.hpp"
+#include "../ZoneHVACBaseboardConvectiveElectric_Impl.hpp"
+
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/core/Assert.hpp"
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// One Space pointed to by n Surfaces, n Lights and n People
+static Space makeSpaceWithNSources(Model& m, size_t n) {
+  Space space(m);
+  Point3dVector pts{{0, 0, 0}, {0, 1, 0}, {1, 1, 0}, {1, 0, 0}};
+  LightsDefinition lightsDefinition(m);
+  PeopleDefinition peopleDefinition(m);
+  for (size_t i = 0; i < n; ++i) {
+    Surface surface(pts, m);
+    surface.setSpace(space);
+    Lights lights(lightsDefinition);
+    lights.setSpace(space);
+    People people(peopleDefinition);
+    people.setSpace(space);
+  }
+  return space;
+}
+
+static void BM_SpaceSurfaces(benchmark::State& state) {
+  Model m;
+  Space space = makeSpaceWithNSources(m, state.range(0));
+  OS_ASSERT(space.surfaces().size() == static_cast<size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(space.surfaces());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// getModelObjectSources without an IddObjectType, on an abstract type
+static void BM_SpaceSpaceLoadSources(benchmark::State& state) {
+  Model m;
+  Space space = makeSpaceWithNSources(m, state.range(0));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(space.getModelObjectSources<SpaceLoad>());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// Set and reset the Space of every Surface, exercising the forward and reverse pointer updates
+static void BM_SurfaceSetSpace(benchmark::State& state) {
+  Model m;
+  Space space = makeSpaceWithNSources(m, state.range(0));
+  Space otherSpace(m);
+  std::vector<Surface> surfaces = space.surfaces();
+
+  for (auto _ : state) {
+    for (auto& surface : surfaces) {
+      surface.setSpace(otherSpace);
+    }
+    for (auto& surface : surfaces) {
+      surface.setSpace(space);
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_ThermalZoneEquipment(benchmark::State& state) {
+  Model m;
+  ThermalZone zone(m);
+  for (int i = 0; i < state.range(0); ++i) {
+    ZoneHVACBaseboardConvectiveElectric baseboard(m);
+    baseboard.addToThermalZone(zone);
+  }
+  OS_ASSERT(zone.equipment().size() == static_cast<size_t>(state.range(0)));
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(zone.equipment());
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_SpaceSurfaces)->RangeMultiplier(4)->Range(4, 1024)->Complexity();
+BENCHMARK(BM_SpaceSpaceLoadSources)->RangeMultiplier(4)->Range(4, 1024)->Complexity();
+BENCHMARK(BM_SurfaceSetSpace)->RangeMultiplier(4)->Range(4, 1024)->Complexity();
+BENCHMARK(BM_ThermalZoneEquipment)->RangeMultiplier(4)->Range(4, 256)->Complexity();
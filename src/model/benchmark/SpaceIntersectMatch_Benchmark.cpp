@@ -0,0 +1,89 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/core/Assert.hpp"
+
+#include <cmath>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// A building made of roughly nSpaces 10 m x 10 m spaces, laid out on a square grid on 4 stories
+model::Model makeModelWithNSpacesOnAGrid(size_t nSpaces) {
+
+  Model m;
+
+  constexpr size_t nStories = 4;
+  constexpr double floorHeight = 3.0;
+  constexpr double width = 10.0;
+
+  const auto nSpacesPerSide = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nSpaces) / nStories)));
+
+  size_t n = 0;
+  for (size_t story = 0; story < nStories; ++story) {
+    double z = story * floorHeight;
+    for (size_t i = 0; i < nSpacesPerSide; ++i) {
+      for (size_t j = 0; j < nSpacesPerSide; ++j) {
+        if (n == nSpaces) {
+          break;
+        }
+        double x = i * width;
+        double y = j * width;
+        Point3dVector pts{{x, y, z}, {x, y + width, z}, {x + width, y + width, z}, {x + width, y, z}};
+        auto space_ = Space::fromFloorPrint(pts, floorHeight, m);
+        OS_ASSERT(space_);
+        ++n;
+      }
+    }
+  }
+
+  OS_ASSERT(m.getConcreteModelObjects<Space>().size() == nSpaces);
+
+  return m;
+}
+
+static void BM_MatchSurfaces(benchmark::State& state) {
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    Model m = makeModelWithNSpacesOnAGrid(state.range(0));
+    std::vector<Space> spaces = m.getConcreteModelObjects<Space>();
+    state.ResumeTiming();
+
+    matchSurfaces(spaces);
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_IntersectAndMatchSurfaces(benchmark::State& state) {
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+
+    state.PauseTiming();
+    Model m = makeModelWithNSpacesOnAGrid(state.range(0));
+    std::vector<Space> spaces = m.getConcreteModelObjects<Space>();
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces);
+    matchSurfaces(spaces);
+  };
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_MatchSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+
+BENCHMARK(BM_IntersectAndMatchSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
@@ -19,6 +19,14 @@
 #include "../OutputVariable.hpp"
 #include "../OutputVariable_Impl.hpp"
 #include "../ParentObject_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
+#include "../SpaceLoad.hpp"
+#include "../SpaceLoad_Impl.hpp"
+#include "../HVACComponent.hpp"
+#include "../HVACComponent_Impl.hpp"
+#include "../ResourceObject.hpp"
+#include "../ResourceObject_Impl.hpp"
 #include "../RunPeriod.hpp"
 #include "../RunPeriod_Impl.hpp"
 
@@ -1203,3 +1211,48 @@ TEST_F(ModelFixture, Model_load) {
   ASSERT_TRUE(workflowJSON.seedFile());
   EXPECT_EQ(workflowJSON.seedFile().get(), openstudio::toPath("../empty361.osm"));
 }
+
+template <typename T>
+size_t countByCasting(const Model& m) {
+  size_t result = 0;
+  for (const auto& object : m.objects()) {
+    if (object.optionalCast<T>()) {
+      ++result;
+    }
+  }
+  return result;
+}
+
+TEST_F(ModelFixture, Model_getModelObjects_AbstractTypes) {
+  Model m = exampleModel();
+
+  auto checkAll = [&m]() {
+    EXPECT_EQ(countByCasting<PlanarSurface>(m), m.getModelObjects<PlanarSurface>().size());
+    EXPECT_EQ(countByCasting<SpaceLoad>(m), m.getModelObjects<SpaceLoad>().size());
+    EXPECT_EQ(countByCasting<HVACComponent>(m), m.getModelObjects<HVACComponent>().size());
+    EXPECT_EQ(countByCasting<ParentObject>(m), m.getModelObjects<ParentObject>().size());
+    EXPECT_EQ(countByCasting<ResourceObject>(m), m.getModelObjects<ResourceObject>().size());
+    EXPECT_EQ(m.getModelObjects<ModelObject>(true).size(), m.getModelObjects<ModelObject>().size());
+    // like objects(), the version object is left out
+    EXPECT_EQ(m.objects().size(), m.getModelObjects<ModelObject>().size());
+  };
+
+  EXPECT_FALSE(m.getModelObjects<PlanarSurface>().empty());
+  EXPECT_FALSE(m.getModelObjects<SpaceLoad>().empty());
+  checkAll();
+
+  // The IddObjectTypes already looked at are remembered, types that appear later must still be found
+  EXPECT_TRUE(m.getConcreteModelObjects<FanConstantVolume>().empty());
+  size_t nHVACComponents = m.getModelObjects<HVACComponent>().size();
+  FanConstantVolume fan(m);
+  EXPECT_EQ(nHVACComponents + 1, m.getModelObjects<HVACComponent>().size());
+  checkAll();
+
+  // Types whose last object was removed are not returned
+  // (removing a surface also removes its sub surfaces, so go one at a time)
+  for (auto surfaces = m.getModelObjects<PlanarSurface>(); !surfaces.empty(); surfaces = m.getModelObjects<PlanarSurface>()) {
+    surfaces.front().remove();
+  }
+  EXPECT_TRUE(m.getModelObjects<PlanarSurface>().empty());
+  checkAll();
+}
@@ -7,6 +7,7 @@
 #include "ModelFixture.hpp"
 #include "../PlantLoop.hpp"
 #include "../PlantLoop_Impl.hpp"
+#include "../Model_Impl.hpp"
 #include "../Node.hpp"
 #include "../Node_Impl.hpp"
 #include "../Loop.hpp"
@@ -50,6 +51,8 @@
 #include "../AvailabilityManagerHybridVentilation.hpp"
 #include "../AvailabilityManagerNightVentilation.hpp"
 
+#include "../../utilities/idf/WorkspaceTransaction.hpp"
+
 #include <utilities/idd/IddEnums.hxx>
 
 using namespace openstudio::model;
@@ -172,6 +175,87 @@ TEST_F(ModelFixture, PlantLoop_demandComponents) {
   ASSERT_EQ(3u, plantLoop.demandComponents(coil2, mixer).size());
 }
 
+TEST_F(ModelFixture, PlantLoop_components_AfterTopologyChanges) {
+  // supplyComponents / demandComponents are cached until the connections between components change
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+
+  CoilHeatingWater coil(m, s);
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+  std::vector<ModelObject> demandComponents = plantLoop.demandComponents();
+  ASSERT_EQ(7u, demandComponents.size());
+  EXPECT_EQ(demandComponents, plantLoop.demandComponents());
+  EXPECT_EQ(1u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+
+  ChillerElectricEIR chiller(m);
+  EXPECT_TRUE(plantLoop.addSupplyBranchForComponent(chiller));
+  EXPECT_TRUE(plantLoop.supplyComponent(chiller.handle()));
+  EXPECT_EQ(7u, plantLoop.demandComponents().size());
+
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(coil));
+  EXPECT_EQ(5u, plantLoop.demandComponents().size());
+  EXPECT_TRUE(plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).empty());
+
+  chiller.remove();
+  EXPECT_FALSE(plantLoop.supplyComponent(chiller.handle()));
+
+  // The cache is not carried over to a clone of the model
+  Model m2 = m.clone(true).cast<Model>();
+  auto plantLoop2 = m2.getModelObject<PlantLoop>(plantLoop.handle());
+  ASSERT_TRUE(plantLoop2);
+  std::vector<ModelObject> supplyComponents2 = plantLoop2->supplyComponents();
+  ASSERT_EQ(plantLoop.supplyComponents().size(), supplyComponents2.size());
+  for (const auto& mo : supplyComponents2) {
+    EXPECT_EQ(m2, mo.model());
+  }
+}
+
+TEST_F(ModelFixture, PlantLoop_loopTopologyVersion) {
+  // only changes to connections or loops invalidate the cached component paths
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+  CoilHeatingWater coil(m, s);
+  auto modelImpl = m.getImpl<Model_Impl>();
+
+  unsigned long long version = modelImpl->loopTopologyVersion();
+  EXPECT_TRUE(coil.setRatedInletWaterTemperature(80.0));
+  EXPECT_TRUE(coil.setName("Heating Coil"));
+  EXPECT_EQ(version, modelImpl->loopTopologyVersion());
+
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+  EXPECT_LT(version, modelImpl->loopTopologyVersion());
+
+  version = modelImpl->loopTopologyVersion();
+  EXPECT_TRUE(plantLoop.setMaximumLoopTemperature(90.0));
+  EXPECT_LT(version, modelImpl->loopTopologyVersion());
+}
+
+TEST_F(ModelFixture, PlantLoop_components_InWorkspaceTransaction) {
+  // the model's onChange is held back in a transaction, the cached paths must still follow every edit
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+  EXPECT_EQ(5u, plantLoop.demandComponents().size());
+
+  WorkspaceTransaction transaction(m);
+  CoilHeatingWater coil(m, s);
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+  EXPECT_EQ(7u, plantLoop.demandComponents().size());
+  EXPECT_EQ(1u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+
+  CoilHeatingWater coil2(m, s);
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil2));
+  EXPECT_EQ(2u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(coil));
+  EXPECT_EQ(1u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+  transaction.commit();
+
+  EXPECT_EQ(1u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+}
+
 TEST_F(ModelFixture, PlantLoop_addDemandBranchForComponent) {
   Model m;
   ScheduleCompact s(m);
@@ -3827,3 +3827,147 @@ TEST_F(ModelFixture, Space_Convexity_2) {
   // Roof and floor
   EXPECT_TRUE(s_->findNonConvexSurfaces().empty());
 }
+
+TEST_F(ModelFixture, Space_intersectSurfaces_MatchesSerialIntersection) {
+
+  // two stories of spaces that do not line up, so walls, floors and ceilings all get split
+  auto makeModel = []() {
+    Model model;
+    for (int i = 0; i < 4; ++i) {
+      for (int j = 0; j < 2; ++j) {
+        double x = i * 10.0;
+        double y = j * 10.0;
+        Point3dVector pts{{x, y, 0}, {x, y + 10.0, 0}, {x + 10.0, y + 10.0, 0}, {x + 10.0, y, 0}};
+        EXPECT_TRUE(Space::fromFloorPrint(pts, 3.0, model));
+      }
+    }
+    for (int i = 0; i < 3; ++i) {
+      Point3dVector pts{{i * 13.0 + 1.0, 1.0, 3.0}, {i * 13.0 + 1.0, 18.0, 3.0}, {i * 13.0 + 14.0, 18.0, 3.0}, {i * 13.0 + 14.0, 1.0, 3.0}};
+      EXPECT_TRUE(Space::fromFloorPrint(pts, 3.0, model));
+    }
+    return model;
+  };
+
+  auto surfaceAreas = [](const Model& model) {
+    std::vector<std::pair<std::string, std::vector<double>>> result;
+    for (const Space& space : model.getConcreteModelObjects<Space>()) {
+      std::vector<double> areas;
+      for (const Surface& surface : space.surfaces()) {
+        areas.push_back(surface.grossArea());
+      }
+      std::sort(areas.begin(), areas.end());
+      result.emplace_back(space.nameString(), areas);
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  Model model = makeModel();
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  intersectSurfaces(spaces);
+
+  // intersect every pair of spaces one by one, in the order intersectSurfaces uses
+  Model serialModel = makeModel();
+  std::vector<Space> serialSpaces = serialModel.getConcreteModelObjects<Space>();
+  std::sort(serialSpaces.begin(), serialSpaces.end(), [](const Space& a, const Space& b) { return a.floorArea() < b.floorArea(); });
+  for (size_t i = 0; i < serialSpaces.size(); ++i) {
+    for (size_t j = i + 1; j < serialSpaces.size(); ++j) {
+      BoundingBox bounds = serialSpaces[i].transformation() * serialSpaces[i].boundingBox();
+      BoundingBox otherBounds = serialSpaces[j].transformation() * serialSpaces[j].boundingBox();
+      if (bounds.intersects(otherBounds)) {
+        serialSpaces[i].intersectSurfaces(serialSpaces[j]);
+      }
+    }
+  }
+
+  auto areas = surfaceAreas(model);
+  auto serialAreas = surfaceAreas(serialModel);
+  EXPECT_GT(model.getConcreteModelObjects<Surface>().size(), 11u * 6u);
+  ASSERT_EQ(serialModel.getConcreteModelObjects<Surface>().size(), model.getConcreteModelObjects<Surface>().size());
+  ASSERT_EQ(serialAreas.size(), areas.size());
+  for (size_t i = 0; i < areas.size(); ++i) {
+    EXPECT_EQ(serialAreas[i].first, areas[i].first);
+    ASSERT_EQ(serialAreas[i].second.size(), areas[i].second.size());
+    for (size_t k = 0; k < areas[i].second.size(); ++k) {
+      EXPECT_DOUBLE_EQ(serialAreas[i].second[k], areas[i].second[k]);
+    }
+  }
+}
+
+TEST_F(ModelFixture, Space_intersectSurfaces_PrecomputedIntersectionOnlyAppliesToOriginalSurfaces) {
+
+  // ceiling of space 1 from x = 0 to 10 under two floors of space 2, from x = 0 to 5 and from x = 5 to 15
+  auto makeModel = []() {
+    Model model;
+    Point3dVector pts{{0, 0, 0}, {0, 10, 0}, {10, 10, 0}, {10, 0, 0}};
+    EXPECT_TRUE(Space::fromFloorPrint(pts, 3.0, model));
+    Point3dVector otherPts{{0, 0, 3}, {0, 10, 3}, {15, 10, 3}, {15, 0, 3}};
+    boost::optional<Space> otherSpace = Space::fromFloorPrint(otherPts, 3.0, model);
+    EXPECT_TRUE(otherSpace);
+    for (Surface& surface : otherSpace->surfaces()) {
+      if (istringEqual("Floor", surface.surfaceType())) {
+        Point3dVector vertices = surface.vertices();
+        Point3dVector otherVertices = vertices;
+        for (size_t i = 0; i < vertices.size(); ++i) {
+          if (vertices[i].x() > 10.0) {
+            vertices[i] = Point3d(5, vertices[i].y(), vertices[i].z());
+          } else {
+            otherVertices[i] = Point3d(5, otherVertices[i].y(), otherVertices[i].z());
+          }
+        }
+        EXPECT_TRUE(surface.setVertices(vertices));
+        Surface otherSurface(otherVertices, model);
+        EXPECT_TRUE(otherSurface.setSpace(*otherSpace));
+      }
+    }
+    return model;
+  };
+
+  auto surfacesOfType = [](const Space& space, const std::string& surfaceType) {
+    std::vector<Surface> result;
+    for (const Surface& surface : space.surfaces()) {
+      if (istringEqual(surfaceType, surface.surfaceType())) {
+        result.push_back(surface);
+      }
+    }
+    std::sort(result.begin(), result.end(), [](const Surface& a, const Surface& b) { return a.grossArea() < b.grossArea(); });
+    return result;
+  };
+
+  auto spacesOf = [](const Model& model) {
+    std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+    std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) { return a.floorArea() < b.floorArea(); });
+    return spaces;
+  };
+
+  Model serialModel = makeModel();
+  std::vector<Space> serialSpaces = spacesOf(serialModel);
+  serialSpaces[0].intersectSurfaces(serialSpaces[1]);
+
+  // pretend intersect() failed for the original ceiling and the larger floor, the piece of the ceiling split off by the
+  // smaller floor must still be intersected with the larger floor
+  Model model = makeModel();
+  std::vector<Space> spaces = spacesOf(model);
+  std::vector<Surface> ceilings = surfacesOfType(spaces[0], "RoofCeiling");
+  std::vector<Surface> floors = surfacesOfType(spaces[1], "Floor");
+  ASSERT_EQ(1u, ceilings.size());
+  ASSERT_EQ(2u, floors.size());
+  detail::IntersectSurfacesState state;
+  state.precomputedIntersections.emplace(std::make_pair(ceilings[0].handle(), floors[1].handle()), detail::PrecomputedIntersection{});
+  spaces[0].getImpl<detail::Space_Impl>()->intersectSurfaces(spaces[1], state);
+
+  std::vector<Surface> serialCeilings = surfacesOfType(serialSpaces[0], "RoofCeiling");
+  std::vector<Surface> serialFloors = surfacesOfType(serialSpaces[1], "Floor");
+  ceilings = surfacesOfType(spaces[0], "RoofCeiling");
+  floors = surfacesOfType(spaces[1], "Floor");
+  ASSERT_EQ(2u, serialCeilings.size());
+  ASSERT_EQ(3u, serialFloors.size());
+  ASSERT_EQ(serialCeilings.size(), ceilings.size());
+  ASSERT_EQ(serialFloors.size(), floors.size());
+  for (size_t i = 0; i < ceilings.size(); ++i) {
+    EXPECT_NEAR(serialCeilings[i].grossArea(), ceilings[i].grossArea(), 0.001);
+  }
+  for (size_t i = 0; i < floors.size(); ++i) {
+    EXPECT_NEAR(serialFloors[i].grossArea(), floors[i].grossArea(), 0.001);
+  }
+}
@@ -482,37 +482,28 @@ namespace osversion {
 
       bool is_component_update_needed = false;  // To avoid constantly comparing VersionString
 
-      std::string translatedIdf;
+      OptionalIdfFile oIdfFile;
+      bool foundUpdateMethod = false;
       VersionString lastVersion("0.0.0");
-      boost::optional<IddFileAndFactoryWrapper> oIddFile;
       for (auto it = m_updateMethods.begin(), itEnd = m_updateMethods.end(); it != itEnd; ++it) {
         // make sure map iteration is behaving as expected
         OS_ASSERT(lastVersion < it->first);
         lastVersion = it->first;
         if (startVersion < it->first) {
-          oIddFile = getIddFile(it->first);
-          translatedIdf = it->second(this, start->second, *oIddFile);
+          oIdfFile = it->second(this, start->second, getIddFile(it->first));
+          foundUpdateMethod = true;
           break;
         }
       }
 
-      if (translatedIdf.empty()) {
+      if (!foundUpdateMethod) {
         LOG(Error, "Unable to complete translation from " << startVersion.str() << " to " << lastVersion.str()
                                                           << ". Unable to find and execute the appropriate update method.");
         return;
       }
-      std::stringstream ss(translatedIdf);
-      OptionalIdfFile oIdfFile;
-      if (oIddFile->iddFileType() == IddFileType::UserCustom) {
-        oIdfFile = IdfFile::load(ss, oIddFile->iddFile());
-      } else {
-        oIdfFile = IdfFile::load(ss, oIddFile->iddFileType());
-      }
       if (!oIdfFile) {
         LOG(Error, "Unable to complete translation from " << startVersion.str() << " to " << lastVersion.str()
-                                                          << ". Could not load translated IDF using the "
-                                                          << "latter version's IddFile. Translated text: " << '\n'
-                                                          << translatedIdf);
+                                                          << ". Could not load translated IDF using the latter version's IddFile.");
         return;
       }
       IdfFile idfFile = *oIdfFile;
@@ -566,33 +557,42 @@ namespace osversion {
     }
   }
 
-  std::string VersionTranslator::defaultUpdate(const IdfFile& idf, const IddFileAndFactoryWrapper& targetIdd) {
-    // use for version increments with no IDD changes
-    std::stringstream ss;
+  IdfFile VersionTranslator::createTargetIdf(const IdfFile& idf, const IddFileAndFactoryWrapper& targetIdd) {
+    // same IddFileAndFactoryWrapper as IdfFile::load would use, the version object comes with it
+    IdfFile result = (targetIdd.iddFileType() == IddFileType::UserCustom) ? IdfFile(targetIdd.iddFile()) : IdfFile(targetIdd.iddFileType());
+    result.setHeader(idf.header());
+    return result;
+  }
 
-    ss << idf.header() << '\n' << '\n';
+  OptionalIdfFile VersionTranslator::loadTranslatedIdf(const std::string& text, const IddFileAndFactoryWrapper& targetIdd) {
+    std::stringstream ss(text);
+    OptionalIdfFile result;
+    if (targetIdd.iddFileType() == IddFileType::UserCustom) {
+      result = IdfFile::load(ss, targetIdd.iddFile());
+    } else {
+      result = IdfFile::load(ss, targetIdd.iddFileType());
+    }
+    if (!result) {
+      LOG(Error, "Could not load translated IDF using the " << targetIdd.version() << " IddFile. Translated text: " << '\n' << text);
+    }
+    return result;
+  }
 
-    // new version object
-    IdfFile targetIdf(targetIdd.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::defaultUpdate(const IdfFile& idf, const IddFileAndFactoryWrapper& targetIdd) {
+    // use for version increments with no IDD changes
+    IdfFile targetIdf = createTargetIdf(idf, targetIdd);
 
     // all other objects
     for (const IdfObject& object : idf.objects()) {
-      ss << object;
+      targetIdf.addObjectCopy(object);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1, const IddFileAndFactoryWrapper& idd_0_7_2) {
+  OptionalIdfFile VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1, const IddFileAndFactoryWrapper& idd_0_7_2) {
     // Url field refinements
-    std::stringstream ss;
-
-    ss << idf_0_7_1.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_0_7_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_0_7_1, idd_0_7_2);
 
     // all other objects
     for (const IdfObject& object : idf_0_7_1.objects()) {
@@ -605,10 +605,10 @@ namespace osversion {
         toPrint = updateUrlField_0_7_1_to_0_7_2(object, 1);
       }
 
-      ss << toPrint;
+      targetIdf.addObjectCopy(toPrint);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
   IdfObject VersionTranslator::updateUrlField_0_7_1_to_0_7_2(const IdfObject& object, unsigned index) {
@@ -630,15 +630,9 @@ namespace osversion {
     return result;
   }
 
-  std::string VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2, const IddFileAndFactoryWrapper& idd_0_7_3) {
+  OptionalIdfFile VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2, const IddFileAndFactoryWrapper& idd_0_7_3) {
     // use for version increments with no IDD changes
-    std::stringstream ss;
-
-    ss << idf_0_7_2.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_0_7_3.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_0_7_2, idd_0_7_3);
 
     // all other objects
     for (const IdfObject& object : idf_0_7_2.objects()) {
@@ -647,13 +641,13 @@ namespace osversion {
         LOG(Warn, "This model contains an out-of-date " << object.iddObject().name() << " object. "
                                                         << "In particular, it needs a bypass branch added in order to run properly in EnergyPlus.");
       }
-      ss << object;
+      targetIdf.addObjectCopy(object);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3, const IddFileAndFactoryWrapper& idd_0_7_4) {
+  OptionalIdfFile VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3, const IddFileAndFactoryWrapper& idd_0_7_4) {
     std::stringstream ss;
     IddObject componentDataIdd = idd_0_7_4.getObject("OS:ComponentData").get();
     IdfObject componentDataIdf(componentDataIdd);
@@ -860,7 +854,7 @@ namespace osversion {
       ss << objectSS.str();
     }
 
-    return ss.str();
+    return loadTranslatedIdf(ss.str(), idd_0_7_4);
   }
 
   std::vector<std::shared_ptr<VersionTranslator::InterobjectIssueInformation>>
@@ -1235,15 +1229,9 @@ namespace osversion {
     }
   }
 
-  std::string VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1, const IddFileAndFactoryWrapper& idd_0_9_2) {
+  OptionalIdfFile VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1, const IddFileAndFactoryWrapper& idd_0_9_2) {
     // use for version increments with no IDD changes
-    std::stringstream ss;
-
-    ss << idf_0_9_1.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_0_9_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_0_9_1, idd_0_9_2);
 
     // Fixup all thermal zone objects
     for (const IdfObject& object : idf_0_9_1.objects()) {
@@ -1399,31 +1387,31 @@ namespace osversion {
           }
         }
 
-        ss << newThermalZone;
-        ss << newInletPortList;
-        ss << newExhaustPortList;
-        ss << newZoneHVACEquipmentList;
+        targetIdf.addObjectCopy(newThermalZone);
+        targetIdf.addObjectCopy(newInletPortList);
+        targetIdf.addObjectCopy(newExhaustPortList);
+        targetIdf.addObjectCopy(newZoneHVACEquipmentList);
 
         m_new.push_back(newInletPortList);
         m_new.push_back(newExhaustPortList);
         m_new.push_back(newZoneHVACEquipmentList);
 
         if (newFPTSecondaryInletConn) {
-          ss << newFPTSecondaryInletConn.get();
+          targetIdf.addObjectCopy(newFPTSecondaryInletConn.get());
         }
       }
     }
 
     for (const IdfObject& object : idf_0_9_1.objects()) {
       if (object.iddObject().name() != "OS:ThermalZone") {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, const IddFileAndFactoryWrapper& idd_0_9_6) {
+  OptionalIdfFile VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, const IddFileAndFactoryWrapper& idd_0_9_6) {
     // if multiple OS:RunPeriod objects remove them all
     bool skipRunPeriods = false;
     unsigned numRunPeriods = 0;
@@ -1440,13 +1428,7 @@ namespace osversion {
     }
 
     // use for version increments with no IDD changes
-    std::stringstream ss;
-
-    ss << idf_0_9_5.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_0_9_6.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_0_9_5, idd_0_9_6);
 
     for (const IdfObject& object : idf_0_9_5.objects()) {
       if (object.iddObject().name() == "OS:PlantLoop") {
@@ -1462,11 +1444,11 @@ namespace osversion {
 
         newSizingPlant.setDouble(4, 0.001);
 
-        ss << newSizingPlant;
+        targetIdf.addObjectCopy(newSizingPlant);
 
         m_new.push_back(newSizingPlant);
 
-        ss << object;
+        targetIdf.addObjectCopy(object);
       } else if (object.iddObject().name() == "OS:Sizing:Parameters") {
         IdfObject newSizingParameters = object.clone(true);
 
@@ -1478,30 +1460,24 @@ namespace osversion {
           newSizingParameters.setDouble(2, 1.15);
         }
 
-        ss << newSizingParameters;
+        targetIdf.addObjectCopy(newSizingParameters);
       } else if (object.iddObject().name() == "OS:RunPeriod") {
         if (skipRunPeriods) {
           // put the object in the untranslated list
           m_untranslated.push_back(object);
         } else {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_9_6_to_0_10_0(const IdfFile& idf_0_9_6, const IddFileAndFactoryWrapper& idd_0_10_0) {
-    std::stringstream ss;
-
-    ss << idf_0_9_6.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_0_10_0.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_0_9_6_to_0_10_0(const IdfFile& idf_0_9_6, const IddFileAndFactoryWrapper& idd_0_10_0) {
+    IdfFile targetIdf = createTargetIdf(idf_0_9_6, idd_0_10_0);
 
     for (IdfObject& object : idf_0_9_6.objects()) {
 
@@ -1509,23 +1485,23 @@ namespace osversion {
         boost::optional<std::string> value = object.getString(14);
 
         if (!value || *value == "146" || *value == "581" || *value == "2321") {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         } else {
           IdfObject newParameters = object.clone(true);
           newParameters.setString(14, "");
 
-          ss << newParameters;
+          targetIdf.addObjectCopy(newParameters);
           m_refactored.emplace_back(std::move(object), std::move(newParameters));
         }
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0, const IddFileAndFactoryWrapper& idd_0_11_1) {
+  OptionalIdfFile VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0, const IddFileAndFactoryWrapper& idd_0_11_1) {
     // use for version increments with no IDD changes
     std::stringstream ss;
 
@@ -1601,10 +1577,10 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return loadTranslatedIdf(ss.str(), idd_0_11_1);
   }
 
-  std::string VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1, const IddFileAndFactoryWrapper& idd_0_11_2) {
+  OptionalIdfFile VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1, const IddFileAndFactoryWrapper& idd_0_11_2) {
     // This version update has two things to do.
     // Make updates for new control related objects.
     // Make updates for component costs.
@@ -1837,10 +1813,10 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return loadTranslatedIdf(ss.str(), idd_0_11_2);
   }
 
-  std::string VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4, const IddFileAndFactoryWrapper& idd_0_11_5) {
+  OptionalIdfFile VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4, const IddFileAndFactoryWrapper& idd_0_11_5) {
     // Make updates for component costs.
 
     std::stringstream ss;
@@ -1937,19 +1913,13 @@ namespace osversion {
       }
     }
 
-    return ss.str();
+    return loadTranslatedIdf(ss.str(), idd_0_11_5);
   }
 
-  std::string VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5, const IddFileAndFactoryWrapper& idd_0_11_6) {
+  OptionalIdfFile VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5, const IddFileAndFactoryWrapper& idd_0_11_6) {
     // Update the OS:PortList object to point back to the OS:ThermalZone
 
-    std::stringstream ss;
-
-    ss << idf_0_11_5.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_0_11_6.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_0_11_5, idd_0_11_6);
 
     for (const IdfObject& object : idf_0_11_5.objects()) {
 
@@ -1992,14 +1962,14 @@ namespace osversion {
                   }
                 }
 
-                ss << newPortList;
+                targetIdf.addObjectCopy(newPortList);
                 m_refactored.emplace_back(std::move(object2), std::move(newPortList));
               }
             }
           }
         }
 
-        ss << object;
+        targetIdf.addObjectCopy(object);
 
       } else if (object.iddObject().name() == "OS:PortList") {
 
@@ -2007,21 +1977,15 @@ namespace osversion {
 
       } else {
 
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1, const IddFileAndFactoryWrapper& idd_1_0_2) {
-    std::stringstream ss;
-
-    ss << idf_1_0_1.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_0_2.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1, const IddFileAndFactoryWrapper& idd_1_0_2) {
+    IdfFile targetIdf = createTargetIdf(idf_1_0_1, idd_1_0_2);
 
     for (IdfObject& object : idf_1_0_1.objects()) {
 
@@ -2034,12 +1998,12 @@ namespace osversion {
 
           newBoiler.setString(15, "LeavingSetpointModulated");
 
-          ss << newBoiler;
+          targetIdf.addObjectCopy(newBoiler);
           m_refactored.emplace_back(std::move(object), std::move(newBoiler));
 
         } else {
 
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
       } else if (object.iddObject().name() == "OS:Boiler:HotWater") {
 
@@ -2050,31 +2014,25 @@ namespace osversion {
 
           newChiller.setString(15, "LeavingSetpointModulated");
 
-          ss << newChiller;
+          targetIdf.addObjectCopy(newChiller);
           m_refactored.emplace_back(std::move(object), std::move(newChiller));
 
         } else {
 
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else {
 
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2, const IddFileAndFactoryWrapper& idd_1_0_3) {
-    std::stringstream ss;
-
-    ss << idf_1_0_2.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_0_3.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2, const IddFileAndFactoryWrapper& idd_1_0_3) {
+    IdfFile targetIdf = createTargetIdf(idf_1_0_2, idd_1_0_3);
 
     for (IdfObject& object : idf_1_0_2.objects()) {
 
@@ -2090,27 +2048,21 @@ namespace osversion {
             newParameters.setString(14, "2306");
           }
 
-          ss << newParameters;
+          targetIdf.addObjectCopy(newParameters);
           m_refactored.emplace_back(std::move(object), std::move(newParameters));
         } else {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2, const IddFileAndFactoryWrapper& idd_1_2_3) {
-    std::stringstream ss;
-
-    ss << idf_1_2_2.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_2_3.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2, const IddFileAndFactoryWrapper& idd_1_2_3) {
+    IdfFile targetIdf = createTargetIdf(idf_1_2_2, idd_1_2_3);
 
     boost::optional<int> numberOfStories;
     boost::optional<int> numberOfAboveGroundStories;
@@ -2129,10 +2081,10 @@ namespace osversion {
           } else {
             newObject.setString(2, "ExteriorFloor");
           }
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         } else {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else if (object.iddObject().name() == "OS:Building") {
@@ -2153,7 +2105,7 @@ namespace osversion {
         m_deprecated.push_back(object);
 
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
@@ -2236,21 +2188,15 @@ namespace osversion {
         OS_ASSERT(test);
       }
 
-      ss << newBuildingObject;
+      targetIdf.addObjectCopy(newBuildingObject);
       m_refactored.emplace_back(std::move(*buildingObject), std::move(newBuildingObject));
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4, const IddFileAndFactoryWrapper& idd_1_3_5) {
-    std::stringstream ss;
-
-    ss << idf_1_3_4.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_3_5.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4, const IddFileAndFactoryWrapper& idd_1_3_5) {
+    IdfFile targetIdf = createTargetIdf(idf_1_3_4, idd_1_3_5);
 
     for (IdfObject& object : idf_1_3_4.objects()) {
 
@@ -2266,47 +2212,35 @@ namespace osversion {
           OS_ASSERT(test);
         }
 
-        ss << newWalkin;
+        targetIdf.addObjectCopy(newWalkin);
         m_refactored.emplace_back(std::move(object), std::move(newWalkin));
 
       } else {
 
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3, const IddFileAndFactoryWrapper& idd_1_5_4) {
-    std::stringstream ss;
-
-    ss << idf_1_5_3.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_5_4.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3, const IddFileAndFactoryWrapper& idd_1_5_4) {
+    IdfFile targetIdf = createTargetIdf(idf_1_5_3, idd_1_5_4);
 
     for (IdfObject& object : idf_1_5_3.objects()) {
       if (object.iddObject().name() == "OS:TimeDependentValuation") {
         // put the object in the untranslated list
         m_untranslated.emplace_back(std::move(object));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1, const IddFileAndFactoryWrapper& idd_1_7_2) {
-    std::stringstream ss;
-
-    ss << idf_1_7_1.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_7_2.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1, const IddFileAndFactoryWrapper& idd_1_7_2) {
+    IdfFile targetIdf = createTargetIdf(idf_1_7_1, idd_1_7_2);
 
     for (IdfObject& object : idf_1_7_1.objects()) {
       if (object.iddObject().name() == "OS:EvaporativeCooler:Direct:ResearchSpecial") {
@@ -2326,7 +2260,7 @@ namespace osversion {
         }
         newObject.setDouble(11, 0.1);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (object.iddObject().name() == "OS:EvaporativeCooler:Indirect:ResearchSpecial") {
         auto iddObject = idd_1_7_2.getObject("OS:EvaporativeCooler:Indirect:ResearchSpecial");
@@ -2346,24 +2280,18 @@ namespace osversion {
         newObject.setDouble(22, 0.1);
         newObject.setDouble(24, 1.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4, const IddFileAndFactoryWrapper& idd_1_7_5) {
-    std::stringstream ss;
-
-    ss << idf_1_7_4.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_7_5.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4, const IddFileAndFactoryWrapper& idd_1_7_5) {
+    IdfFile targetIdf = createTargetIdf(idf_1_7_4, idd_1_7_5);
 
     for (IdfObject& object : idf_1_7_4.objects()) {
       if (object.iddObject().name() == "OS:Sizing:System") {
@@ -2395,7 +2323,7 @@ namespace osversion {
         newObject.setDouble(36, 1.0);
         newObject.setString(37, "OnOff");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (object.iddObject().name() == "OS:Sizing:Plant") {
         auto iddObject = idd_1_7_5.getObject("OS:Sizing:Plant");
@@ -2412,7 +2340,7 @@ namespace osversion {
         newObject.setInt(6, 1);
         newObject.setString(7, "None");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (object.iddObject().name() == "OS:DistrictCooling") {
         IdfObject newObject = object.clone(true);
@@ -2421,7 +2349,7 @@ namespace osversion {
           newObject.setString(4, "Autosize");
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (object.iddObject().name() == "OS:DistrictHeating") {
         IdfObject newObject = object.clone(true);
@@ -2430,7 +2358,7 @@ namespace osversion {
           newObject.setString(4, "Autosize");
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (object.iddObject().name() == "OS:Humidifier:Steam:Electric") {
         IdfObject newObject = object.clone(true);
@@ -2439,24 +2367,18 @@ namespace osversion {
           newObject.setString(4, "Autosize");
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3, const IddFileAndFactoryWrapper& idd_1_8_4) {
-    std::stringstream ss;
-
-    ss << idf_1_8_3.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_8_4.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3, const IddFileAndFactoryWrapper& idd_1_8_4) {
+    IdfFile targetIdf = createTargetIdf(idf_1_8_3, idd_1_8_4);
 
     for (IdfObject& object : idf_1_8_3.objects()) {
       auto iddname = object.iddObject().name();
@@ -2477,7 +2399,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:AirLoopHVAC") {
         auto iddObject = idd_1_8_4.getObject("OS:AirLoopHVAC");
@@ -2537,7 +2459,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:AvailabilityManager:Scheduled") {
         m_deprecated.push_back(object);
@@ -2548,26 +2470,20 @@ namespace osversion {
         if (controlType
             && (istringEqual("CycleOnAny", controlType.get()) || istringEqual("CycleOnControlZone", controlType.get())
                 || istringEqual("CycleOnAnyZoneFansOnly", controlType.get()))) {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         } else {
           m_deprecated.push_back(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4, const IddFileAndFactoryWrapper& idd_1_8_5) {
-    std::stringstream ss;
-
-    ss << idf_1_8_4.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_8_5.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4, const IddFileAndFactoryWrapper& idd_1_8_5) {
+    IdfFile targetIdf = createTargetIdf(idf_1_8_4, idd_1_8_5);
 
     for (const IdfObject& object : idf_1_8_4.objects()) {
       auto iddname = object.iddObject().name();
@@ -2584,9 +2500,9 @@ namespace osversion {
               newObject.setString(i, s.get());
             }
           }
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
         } else {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
       } else if (iddname == "OS:PlantLoop") {
         if ((!object.getString(20)) || object.getString(20).get().empty()) {
@@ -2601,26 +2517,20 @@ namespace osversion {
               newObject.setString(i, s.get());
             }
           }
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
         } else {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5, const IddFileAndFactoryWrapper& idd_1_9_0) {
-    std::stringstream ss;
-
-    ss << idf_1_8_5.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_9_0.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5, const IddFileAndFactoryWrapper& idd_1_9_0) {
+    IdfFile targetIdf = createTargetIdf(idf_1_8_5, idd_1_9_0);
 
     for (IdfObject& object : idf_1_8_5.objects()) {
       auto iddname = object.iddObject().name();
@@ -2638,24 +2548,18 @@ namespace osversion {
             newObject.setString(i, s.get());
           }
         }
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2, const IddFileAndFactoryWrapper& idd_1_9_3) {
-    std::stringstream ss;
-
-    ss << idf_1_9_2.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_9_3.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2, const IddFileAndFactoryWrapper& idd_1_9_3) {
+    IdfFile targetIdf = createTargetIdf(idf_1_9_2, idd_1_9_3);
 
     for (IdfObject& object : idf_1_9_2.objects()) {
       auto iddname = object.iddObject().name();
@@ -2680,7 +2584,7 @@ namespace osversion {
             }
           }
         }
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneAirMassFlowConservation") {
@@ -2704,7 +2608,7 @@ namespace osversion {
           newObject.setString(2, value.get());
         }
         // new field Infiltration Balancing Zones is defaulted to MixingSourceZonesOnly
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:AirTerminal:SingleDuct:VAV:Reheat") {
         auto iddObject = idd_1_9_3.getObject("OS:AirTerminal:SingleDuct:VAV:Reheat");
@@ -2719,7 +2623,7 @@ namespace osversion {
 
         newObject.setString(18, "No");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:AirTerminal:SingleDuct:VAV:NoReheat") {
         auto iddObject = idd_1_9_3.getObject("OS:AirTerminal:SingleDuct:VAV:NoReheat");
@@ -2734,24 +2638,18 @@ namespace osversion {
 
         newObject.setString(10, "No");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4, const IddFileAndFactoryWrapper& idd_1_9_5) {
-    std::stringstream ss;
-
-    ss << idf_1_9_4.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_9_5.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4, const IddFileAndFactoryWrapper& idd_1_9_5) {
+    IdfFile targetIdf = createTargetIdf(idf_1_9_4, idd_1_9_5);
 
     for (IdfObject& object : idf_1_9_4.objects()) {
       auto iddname = object.iddObject().name();
@@ -2803,24 +2701,18 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5, const IddFileAndFactoryWrapper& idd_1_10_0) {
-    std::stringstream ss;
-
-    ss << idf_1_9_5.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_10_0.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5, const IddFileAndFactoryWrapper& idd_1_10_0) {
+    IdfFile targetIdf = createTargetIdf(idf_1_9_5, idd_1_10_0);
 
     for (IdfObject& object : idf_1_9_5.objects()) {
       auto iddname = object.iddObject().name();
@@ -2845,7 +2737,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:AirTerminal:SingleDuct:VAV:NoReheat") {
         auto iddObject = idd_1_10_0.getObject("OS:AirTerminal:SingleDuct:VAV:NoReheat");
@@ -2868,25 +2760,19 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1, const IddFileAndFactoryWrapper& idd_1_10_2) {
-
-    std::stringstream ss;
-
-    ss << idf_1_10_1.header() << '\n' << '\n';
+  OptionalIdfFile VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1, const IddFileAndFactoryWrapper& idd_1_10_2) {
 
-    // new version object
-    IdfFile targetIdf(idd_1_10_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_1_10_1, idd_1_10_2);
 
     auto zones = idf_1_10_1.getObjectsByType(idf_1_10_1.iddFile().getObject("OS:ThermalZone").get());
 
@@ -2911,13 +2797,13 @@ namespace osversion {
             // but since we are messing with the name it is probably best
             auto newThermostat = object.clone();
             newThermostat.setName(referencingZone.nameString() + " Thermostat");
-            ss << newThermostat;
+            targetIdf.addObjectCopy(newThermostat);
             m_new.push_back(newThermostat);
             auto newHandle = newThermostat.getString(0).get();
             referencingZone.setString(19, newHandle);
           }
         }
-        ss << object;
+        targetIdf.addObjectCopy(object);
       } else if (iddname == "OS:Sizing:Zone") {
         auto iddObject = idd_1_10_2.getObject("OS:Sizing:Zone");
         OS_ASSERT(iddObject);
@@ -2952,10 +2838,10 @@ namespace osversion {
         newObject.setString(26, "Autosize");
         newObject.setString(27, "Autosize");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
@@ -2976,20 +2862,14 @@ namespace osversion {
       newObject.setString(27, "Autosize");
 
       m_new.push_back(newObject);
-      ss << newObject;
+      targetIdf.addObjectCopy(newObject);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5, const IddFileAndFactoryWrapper& idd_1_10_6) {
-    std::stringstream ss;
-
-    ss << idf_1_10_5.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_10_6.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5, const IddFileAndFactoryWrapper& idd_1_10_6) {
+    IdfFile targetIdf = createTargetIdf(idf_1_10_5, idd_1_10_6);
 
     for (IdfObject& object : idf_1_10_5.objects()) {
       auto iddname = object.iddObject().name();
@@ -3015,24 +2895,18 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3, const IddFileAndFactoryWrapper& idd_1_11_4) {
-    std::stringstream ss;
-
-    ss << idf_1_11_3.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_11_4.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3, const IddFileAndFactoryWrapper& idd_1_11_4) {
+    IdfFile targetIdf = createTargetIdf(idf_1_11_3, idd_1_11_4);
 
     for (IdfObject& object : idf_1_11_3.objects()) {
       auto iddname = object.iddObject().name();
@@ -3057,24 +2931,18 @@ namespace osversion {
         newObject.setDouble(4, 0.0);
         newObject.setDouble(5, 0.8);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4, const IddFileAndFactoryWrapper& idd_1_11_5) {
-    std::stringstream ss;
-
-    ss << idf_1_11_4.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_11_5.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4, const IddFileAndFactoryWrapper& idd_1_11_5) {
+    IdfFile targetIdf = createTargetIdf(idf_1_11_4, idd_1_11_5);
 
     for (IdfObject& object : idf_1_11_4.objects()) {
       auto iddname = object.iddObject().name();
@@ -3100,24 +2968,18 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0, const IddFileAndFactoryWrapper& idd_1_12_1) {
-    std::stringstream ss;
-
-    ss << idf_1_12_0.header() << '\n' << '\n';
-
-    // new version object
-    IdfFile targetIdf(idd_1_12_1.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0, const IddFileAndFactoryWrapper& idd_1_12_1) {
+    IdfFile targetIdf = createTargetIdf(idf_1_12_0, idd_1_12_1);
 
     for (IdfObject& object : idf_1_12_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -3134,22 +2996,18 @@ namespace osversion {
           ++newi;
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3, const IddFileAndFactoryWrapper& idd_1_12_4) {
-    std::stringstream ss;
-
-    ss << idf_1_12_3.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_1_12_4.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3, const IddFileAndFactoryWrapper& idd_1_12_4) {
+    IdfFile targetIdf = createTargetIdf(idf_1_12_3, idd_1_12_4);
 
     for (IdfObject& object : idf_1_12_3.objects()) {
       auto iddname = object.iddObject().name();
@@ -3172,22 +3030,18 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0, const IddFileAndFactoryWrapper& idd_2_1_1) {
-    std::stringstream ss;
-
-    ss << idf_2_1_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_1_1.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0, const IddFileAndFactoryWrapper& idd_2_1_1) {
+    IdfFile targetIdf = createTargetIdf(idf_2_1_0, idd_2_1_1);
 
     for (IdfObject& object : idf_2_1_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -3208,7 +3062,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:HeatPump:WaterToWater:EquationFit:Heating") {
         auto iddObject = idd_2_1_1.getObject("OS:HeatPump:WaterToWater:EquationFit:Heating");
@@ -3223,7 +3077,7 @@ namespace osversion {
         newObject.setDouble(21, 1.0);
         newObject.setString(22, "");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:HeatPump:WaterToWater:EquationFit:Cooling") {
         auto iddObject = idd_2_1_1.getObject("OS:HeatPump:WaterToWater:EquationFit:Cooling");
@@ -3238,22 +3092,18 @@ namespace osversion {
         newObject.setDouble(21, 1.0);
         newObject.setString(22, "");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1, const IddFileAndFactoryWrapper& idd_2_1_2) {
-    std::stringstream ss;
-
-    ss << idf_2_1_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_1_2.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1, const IddFileAndFactoryWrapper& idd_2_1_2) {
+    IdfFile targetIdf = createTargetIdf(idf_2_1_1, idd_2_1_2);
 
     for (IdfObject& object : idf_2_1_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -3275,7 +3125,7 @@ namespace osversion {
           ++newi;
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:ZoneHVAC:FourPipeFanCoil") {
         auto iddObject = idd_2_1_2.getObject("OS:ZoneHVAC:FourPipeFanCoil");
@@ -3291,22 +3141,18 @@ namespace osversion {
         newObject.setString(23, "Autosize");
         newObject.setString(24, "Autosize");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0, const IddFileAndFactoryWrapper& idd_2_3_1) {
-    std::stringstream ss;
-
-    ss << idf_2_3_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_3_1.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0, const IddFileAndFactoryWrapper& idd_2_3_1) {
+    IdfFile targetIdf = createTargetIdf(idf_2_3_0, idd_2_3_1);
 
     boost::optional<std::string> value;
 
@@ -3327,7 +3173,7 @@ namespace osversion {
         newObject.setString(17, "348701.1");
         newObject.setString(18, "1.282051282");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:Pump:VariableSpeed") {
         auto iddObject = idd_2_3_1.getObject("OS:Pump:VariableSpeed");
@@ -3345,7 +3191,7 @@ namespace osversion {
         newObject.setString(28, "1.282051282");
         newObject.setString(29, "0.0");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:CoolingTower:SingleSpeed") {
         auto iddObject = idd_2_3_1.getObject("OS:CoolingTower:SingleSpeed");
@@ -3367,7 +3213,7 @@ namespace osversion {
         newObject.setString(36, "Autosize");
         newObject.setString(37, "General");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:CoolingTower:TwoSpeed") {
         auto iddObject = idd_2_3_1.getObject("OS:CoolingTower:TwoSpeed");
@@ -3385,7 +3231,7 @@ namespace osversion {
         newObject.setString(44, "Autosize");
         newObject.setString(45, "General");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:CoolingTower:VariableSpeed") {
         auto iddObject = idd_2_3_1.getObject("OS:CoolingTower:VariableSpeed");
@@ -3399,7 +3245,7 @@ namespace osversion {
 
         newObject.setString(31, "General");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Chiller:Electric:EIR") {
@@ -3418,7 +3264,7 @@ namespace osversion {
           newObject.setString(19, "AirCooled");
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:AirLoopHVAC") {
         auto iddObject = idd_2_3_1.getObject("OS:AirLoopHVAC");
@@ -3457,8 +3303,8 @@ namespace osversion {
         m_refactored.emplace_back(object, newObject);
         m_new.push_back(avmList);
 
-        ss << newObject;
-        ss << avmList;
+        targetIdf.addObjectCopy(newObject);
+        targetIdf.addObjectCopy(avmList);
 
       } else if (iddname == "OS:PlantLoop") {
         auto iddObject = idd_2_3_1.getObject("OS:PlantLoop");
@@ -3493,8 +3339,8 @@ namespace osversion {
         m_refactored.emplace_back(object, newObject);
         m_new.push_back(avmList);
 
-        ss << newObject;
-        ss << avmList;
+        targetIdf.addObjectCopy(newObject);
+        targetIdf.addObjectCopy(avmList);
 
       } else if (iddname == "OS:AvailabilityManager:NightCycle") {
         auto iddObject = idd_2_3_1.getObject("OS:AvailabilityManager:NightCycle");
@@ -3572,26 +3418,22 @@ namespace osversion {
         m_new.push_back(heatingControlThermalZoneList);
         m_new.push_back(heatingZoneFansOnlyThermalZoneList);
 
-        ss << newObject;
-        ss << controlThermalZoneList;
-        ss << coolingControlThermalZoneList;
-        ss << heatingControlThermalZoneList;
-        ss << heatingZoneFansOnlyThermalZoneList;
+        targetIdf.addObjectCopy(newObject);
+        targetIdf.addObjectCopy(controlThermalZoneList);
+        targetIdf.addObjectCopy(coolingControlThermalZoneList);
+        targetIdf.addObjectCopy(heatingControlThermalZoneList);
+        targetIdf.addObjectCopy(heatingZoneFansOnlyThermalZoneList);
 
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1, const IddFileAndFactoryWrapper& idd_2_4_2) {
-    std::stringstream ss;
-
-    ss << idf_2_4_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_4_2.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1, const IddFileAndFactoryWrapper& idd_2_4_2) {
+    IdfFile targetIdf = createTargetIdf(idf_2_4_1, idd_2_4_2);
 
     boost::optional<std::string> value;
 
@@ -3620,10 +3462,10 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
         m_new.push_back(additionalProperties);
-        ss << additionalProperties;
+        targetIdf.addObjectCopy(additionalProperties);
 
       } else if (iddname == "OS:Boiler:HotWater") {
         auto iddObject = idd_2_4_2.getObject("OS:Boiler:HotWater");
@@ -3636,7 +3478,7 @@ namespace osversion {
         }
         newObject.setString(18, "General");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Boiler:Steam") {
@@ -3650,7 +3492,7 @@ namespace osversion {
         }
         newObject.setString(16, "General");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:WaterHeater:Mixed") {
@@ -3671,7 +3513,7 @@ namespace osversion {
         // End Use Subcategory
         newObject.setString(42, "General");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Chiller:Electric:EIR") {
@@ -3696,24 +3538,20 @@ namespace osversion {
         // endUseSubcategory
         newObject.setString(34, "General");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // Default case
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3, const IddFileAndFactoryWrapper& idd_2_5_0) {
-    std::stringstream ss;
-
-    ss << idf_2_4_3.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_5_0.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3, const IddFileAndFactoryWrapper& idd_2_5_0) {
+    IdfFile targetIdf = createTargetIdf(idf_2_4_3, idd_2_5_0);
 
     boost::optional<std::string> value;
 
@@ -3753,25 +3591,22 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // Default case
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0, const IddFileAndFactoryWrapper& idd_2_6_1) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0, const IddFileAndFactoryWrapper& idd_2_6_1) {
     boost::optional<std::string> value;
 
-    ss << idf_2_6_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_6_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_2_6_0, idd_2_6_1);
 
     struct ConnectionInfo
     {
@@ -3824,8 +3659,8 @@ namespace osversion {
 
         m_refactored.emplace_back(object, newObject);
         m_new.push_back(newReturnPortList);
-        ss << newObject;
-        ss << newReturnPortList;
+        targetIdf.addObjectCopy(newObject);
+        targetIdf.addObjectCopy(newReturnPortList);
       } else if (iddname == "OS:Connection") {
         value = object.getString(0);
         OS_ASSERT(value);
@@ -3842,26 +3677,22 @@ namespace osversion {
           // it needs to specify a port on the PortList instead of the ThermalZone now
           newConnection.setString(2, c->second.newPortListHandle);
           newConnection.setUnsigned(3, 3);
-          ss << newConnection;
+          targetIdf.addObjectCopy(newConnection);
           m_refactored.emplace_back(std::move(object), std::move(newConnection));
         } else {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1, const IddFileAndFactoryWrapper& idd_2_6_2) {
-    std::stringstream ss;
-
-    ss << idf_2_6_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_6_2.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1, const IddFileAndFactoryWrapper& idd_2_6_2) {
+    IdfFile targetIdf = createTargetIdf(idf_2_6_1, idd_2_6_2);
 
     for (IdfObject& object : idf_2_6_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -3893,7 +3724,7 @@ namespace osversion {
           newObject.setDouble(16, 99);
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneHVAC:EquipmentList") {
@@ -3914,23 +3745,19 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2, const IddFileAndFactoryWrapper& idd_2_7_0) {
-    std::stringstream ss;
-
-    ss << idf_2_6_2.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_7_0.iddFile());
-    ss << targetIdf.versionObject().get();
+  OptionalIdfFile VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2, const IddFileAndFactoryWrapper& idd_2_7_0) {
+    IdfFile targetIdf = createTargetIdf(idf_2_6_2, idd_2_7_0);
 
     struct ConnectionInfo
     {
@@ -4010,8 +3837,8 @@ namespace osversion {
               // Register new objects
               m_new.push_back(newNode);
               m_new.push_back(newConnection);
-              ss << newNode;
-              ss << newConnection;
+              targetIdf.addObjectCopy(newNode);
+              targetIdf.addObjectCopy(newConnection);
 
             } else {
               // Otherwise, keep the same
@@ -4020,7 +3847,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Connection") {
@@ -4029,7 +3856,7 @@ namespace osversion {
         OS_ASSERT(value);
         if (connectionsToFix.find(value.get()) == connectionsToFix.end()) {
           // No need to fix it, we just push it
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else if (iddname == "OS:Building") {
@@ -4052,7 +3879,7 @@ namespace osversion {
 
         // Field is optional string, so leave it empty
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:SpaceType") {
@@ -4075,11 +3902,11 @@ namespace osversion {
 
         // Field is optional string, so leave it empty
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
@@ -4106,22 +3933,19 @@ namespace osversion {
           // And it connects to the "Inlet Port" of the name (field 2 of the node)
           newConnection.setString(4, c->second.newNodeHandle);
           newConnection.setUnsigned(5, 2);
-          ss << newConnection;
+          targetIdf.addObjectCopy(newConnection);
           m_refactored.emplace_back(std::move(object), std::move(newConnection));
         }
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0, const IddFileAndFactoryWrapper& idd_2_7_1) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0, const IddFileAndFactoryWrapper& idd_2_7_1) {
     boost::optional<std::string> value;
 
-    ss << idf_2_7_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_7_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_2_7_0, idd_2_7_1);
 
     for (IdfObject& object : idf_2_7_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -4140,27 +3964,24 @@ namespace osversion {
                       << "It was replaced by 'Total' instead for object with handle '" << newObject.getString(0).get()
                       << "'. Please review carefully.");
 
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         } else {
           // Nothing to do here
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1, const IddFileAndFactoryWrapper& idd_2_7_2) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1, const IddFileAndFactoryWrapper& idd_2_7_2) {
     boost::optional<std::string> value;
 
-    ss << idf_2_7_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_7_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_2_7_1, idd_2_7_2);
 
     for (IdfObject& object : idf_2_7_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -4172,11 +3993,11 @@ namespace osversion {
         if (value && (value.get().rfind("file://", 0) == 0)) {
           IdfObject newObject = object.clone(true);
           newObject.setString(10, value.get().substr(7));
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         } else {
           // Nothing to do here
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
         // Both of these happen to have the url field at pos 2 (note: neither of these are actually implemented in the SDK, but let's be safe)
@@ -4187,11 +4008,11 @@ namespace osversion {
         if (value && (value.get().rfind("file://", 0) == 0)) {
           IdfObject newObject = object.clone(true);
           newObject.setString(2, value.get().substr(7));
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         } else {
           // Nothing to do here
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else if (iddname == "OS:ZoneHVAC:EquipmentList") {
@@ -4214,25 +4035,22 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1, const IddFileAndFactoryWrapper& idd_2_9_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1, const IddFileAndFactoryWrapper& idd_2_9_0) {
     boost::optional<std::string> value;
 
-    ss << idf_2_8_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_9_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_2_8_1, idd_2_9_0);
 
     for (IdfObject& object : idf_2_8_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -4253,7 +4071,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Schedule:FixedInterval") {
@@ -4272,7 +4090,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneHVAC:EquipmentList") {
@@ -4310,7 +4128,7 @@ namespace osversion {
                 scheduleConstant.setDouble(3, fraction.get());
 
                 m_new.push_back(scheduleConstant);
-                ss << scheduleConstant;
+                targetIdf.addObjectCopy(scheduleConstant);
 
                 new_eg.setString(i, uuid);
               }
@@ -4320,7 +4138,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ThermalStorage:Ice:Detailed") {
@@ -4385,7 +4203,7 @@ namespace osversion {
            *}
            */
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:AirLoopHVAC:UnitaryHeatCool:VAVChangeoverBypass") {
@@ -4436,11 +4254,11 @@ namespace osversion {
         // Register new objects
         m_new.push_back(newNode);
         m_new.push_back(newConnection);
-        ss << newNode;
-        ss << newConnection;
+        targetIdf.addObjectCopy(newNode);
+        targetIdf.addObjectCopy(newConnection);
 
         // Register refactored
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // Four fields were added but only the last (End Use Subcat) was implemented, but withotu transition rules either
@@ -4474,25 +4292,22 @@ namespace osversion {
         }
 
         // Register refactored
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0, const IddFileAndFactoryWrapper& idd_2_9_1) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0, const IddFileAndFactoryWrapper& idd_2_9_1) {
     boost::optional<std::string> value;
 
-    ss << idf_2_9_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_2_9_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_2_9_0, idd_2_9_1);
 
     boost::optional<IdfObject> alwaysOnDiscreteSchedule;
 
@@ -4529,8 +4344,8 @@ namespace osversion {
 
         alwaysOnDiscreteSchedule->setString(2, typeLimits.getString(0).get());
 
-        ss << alwaysOnDiscreteSchedule.get();
-        ss << typeLimits;
+        targetIdf.addObjectCopy(alwaysOnDiscreteSchedule.get());
+        targetIdf.addObjectCopy(typeLimits);
 
         // Register new objects
         m_new.push_back(alwaysOnDiscreteSchedule.get());
@@ -4554,25 +4369,22 @@ namespace osversion {
         // Applicability Schedule
         newObject.setString(2, alwaysOnDiscreteSchedule->getString(0).get());
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_9_1_to_3_0_0(const IdfFile& idf_2_9_1, const IddFileAndFactoryWrapper& idd_3_0_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_2_9_1_to_3_0_0(const IdfFile& idf_2_9_1, const IddFileAndFactoryWrapper& idd_3_0_0) {
     boost::optional<std::string> value;
 
-    ss << idf_2_9_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_0_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_2_9_1, idd_3_0_0);
 
     // Making the map case-insensitive by providing a Comparator `IstringCompare`
     const std::map<std::string, std::string, openstudio::IstringCompare> replaceFuelTypesMap({
@@ -4655,11 +4467,11 @@ namespace osversion {
             replaceForField(object, newObject, it->second);
           }
 
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         } else {
           // No-op
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else if (iddname == "OS:Material") {
@@ -4691,7 +4503,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Schedule:Rule") {
@@ -4709,7 +4521,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // Note: OS:ScheduleRuleset got a new optional field at the end, so no-op
@@ -4733,7 +4545,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ClimateZones") {
@@ -4753,7 +4565,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Boiler:HotWater") {
@@ -4776,7 +4588,7 @@ namespace osversion {
         // Fuel Type: renames
         replaceForField(object, newObject, 2);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Chiller:Electric:EIR") {
@@ -4826,7 +4638,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ShadowCalculation") {
@@ -4881,7 +4693,7 @@ namespace osversion {
         // Disable Self-Shading From Shading Zone Groups to Other Zones
         newObject.setString(10, "No");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Sizing:Zone") {
@@ -4908,7 +4720,7 @@ namespace osversion {
         // Two fields were plain added to the end: Design Zone Secondary Recirculation Fraction,
         // and  Design Minimum Zone Ventilation Efficiency, but both are optional (has default) so no-op there
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneHVAC:TerminalUnit:VariableRefrigerantFlow") {
@@ -4933,25 +4745,22 @@ namespace osversion {
         newObject.setDouble(25, 21.0);
 
         // Register refactored
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_3_0_0_to_3_0_1(const IdfFile& idf_3_0_0, const IddFileAndFactoryWrapper& idd_3_0_1) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_0_0_to_3_0_1(const IdfFile& idf_3_0_0, const IddFileAndFactoryWrapper& idd_3_0_1) {
     boost::optional<std::string> value;
 
-    ss << idf_3_0_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_0_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_0_0, idd_3_0_1);
 
     for (IdfObject& object : idf_3_0_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -4976,7 +4785,7 @@ namespace osversion {
         // Set new field per IDD default, same as Model Ctor, since it was made required-field
         newObject.setDouble(15, -25.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Coil:Cooling:DX:TwoStageWithHumidityControlMode") {
@@ -4999,7 +4808,7 @@ namespace osversion {
         // Set new field per IDD default, same as Model Ctor, since it was made required-field
         newObject.setDouble(15, -25.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Coil:Cooling:DX:MultiSpeed") {
@@ -5022,7 +4831,7 @@ namespace osversion {
         // Set new field per IDD default, same as Model Ctor, since it was made required-field
         newObject.setDouble(7, -25.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Coil:Cooling:DX:VariableSpeed") {
@@ -5045,7 +4854,7 @@ namespace osversion {
         // Set new field per IDD default, same as Model Ctor, since it was made required-field
         newObject.setDouble(15, -25.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Coil:Cooling:DX:TwoSpeed") {
@@ -5075,26 +4884,23 @@ namespace osversion {
         // Set new field per IDD default, same as Model Ctor, since it was made required-field
         newObject.setDouble(23, -25.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_0_0_to_3_0_1
 
-  std::string VersionTranslator::update_3_0_1_to_3_1_0(const IdfFile& idf_3_0_1, const IddFileAndFactoryWrapper& idd_3_1_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_0_1_to_3_1_0(const IdfFile& idf_3_0_1, const IddFileAndFactoryWrapper& idd_3_1_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_0_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_1_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_0_1, idd_3_1_0);
 
     /*****************************************************************************************************************************************************
        *                                                               Output:Variable fuel                                                                *
@@ -5721,7 +5527,7 @@ namespace osversion {
         // Minimum Ventilation Time
         newObject.setDouble(18, 0.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:AirLoopHVAC") {
@@ -5745,7 +5551,7 @@ namespace osversion {
         // Set new field per IDD default, same as Model Ctor, since it was made required-field
         newObject.setDouble(6, 1.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Construction:InternalSource") {
@@ -5770,7 +5576,7 @@ namespace osversion {
         // If we made it required-field, set new field per IDD default, same as Model Ctor
         // newObject.setDouble(6, 0.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneHVAC:LowTemperatureRadiant:Electric") {
@@ -5790,7 +5596,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:WaterHeater:HeatPump") {
@@ -5813,7 +5619,7 @@ namespace osversion {
         // Made it a required-field with the E+ IDD default value set in Ctor, so set it here too
         newObject.setDouble(16, 48.89);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneHVAC:LowTemperatureRadiant:ConstantFlow") {
@@ -5866,7 +5672,7 @@ namespace osversion {
         // newObject.setDouble(8, 0.35);
         // newObject.setDouble(10, 0.8);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneHVAC:LowTemperatureRadiant:VariableFlow") {
@@ -5911,7 +5717,7 @@ namespace osversion {
         // newObject.setDouble(10, 0.35);
         // newObject.setString(23, "HalfFlowPower");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Output:Meter") {
@@ -5924,7 +5730,7 @@ namespace osversion {
         }
         if (name == object.nameString()) {
           // No-op
-          ss << object;
+          targetIdf.addObjectCopy(object);
         } else {
 
           // Copy everything but 'Variable Name' field
@@ -5943,7 +5749,7 @@ namespace osversion {
 
           newObject.setName(name);
 
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         }
 
@@ -5965,7 +5771,7 @@ namespace osversion {
           auto it = replaceOutputVariablesMap.find(variableName);
           if (it == replaceOutputVariablesMap.end()) {
             // No-op
-            ss << object;
+            targetIdf.addObjectCopy(object);
           } else {
 
             // Copy everything but 'Variable Name' field
@@ -5983,12 +5789,12 @@ namespace osversion {
             LOG(Trace, "Replacing " << variableName << " with " << it->second << " for " << object.nameString());
             newObject.setString(variableNameIndex, it->second);
 
-            ss << newObject;
+            targetIdf.addObjectCopy(newObject);
             m_refactored.emplace_back(std::move(object), std::move(newObject));
           }
         } else {
           // No-op
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else if ((iddname == "OS:Meter:Custom") || (iddname == "OS:Meter:CustomDecrement")) {
@@ -6012,7 +5818,7 @@ namespace osversion {
         }
         if (!isReplaceNeeded) {
           // No-op
-          ss << object;
+          targetIdf.addObjectCopy(object);
         } else {
 
           // Copy everything but 'Variable Name' field
@@ -6047,7 +5853,7 @@ namespace osversion {
             }
           }
 
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         }
 
@@ -6077,7 +5883,7 @@ namespace osversion {
           newObject.pushExtensibleGroup(StringVector(1u, subSurfaceHandleIt->second));
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:SubSurface") {
@@ -6097,26 +5903,23 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_0_1_to_3_1_0
 
-  std::string VersionTranslator::update_3_1_0_to_3_2_0(const IdfFile& idf_3_1_0, const IddFileAndFactoryWrapper& idd_3_2_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_1_0_to_3_2_0(const IdfFile& idf_3_1_0, const IddFileAndFactoryWrapper& idd_3_2_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_1_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_2_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_1_0, idd_3_2_0);
 
     auto makeCurveQuadLinear = [&idd_3_2_0]() -> IdfObject {
       auto quadLinearIddObject = idd_3_2_0.getObject("OS:Curve:QuadLinear").get();
@@ -6192,7 +5995,7 @@ namespace osversion {
         newObject.setDouble(4, 0.0);
         newObject.setDouble(5, 1.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if ((iddname == "OS:Connection") || (iddname == "OS:PortList")) {
@@ -6211,7 +6014,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Construction:AirBoundary") {
@@ -6235,7 +6038,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneAirMassFlowConservation") {
@@ -6260,7 +6063,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneHVAC:TerminalUnit:VariableRefrigerantFlow") {
@@ -6278,7 +6081,7 @@ namespace osversion {
 
         newObject.setString(13, "DrawThrough");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Coil:Cooling:WaterToAirHeatPump:EquationFit") {
@@ -6347,13 +6150,13 @@ namespace osversion {
         newObject.setString(12, sensibleCoolingCapacityCurve.nameString());
         newObject.setString(13, coolingPowerConsumptionCurve.nameString());
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // Register new Curve objects
-        ss << totalCoolingCapacityCurve;
-        ss << sensibleCoolingCapacityCurve;
-        ss << coolingPowerConsumptionCurve;
+        targetIdf.addObjectCopy(totalCoolingCapacityCurve);
+        targetIdf.addObjectCopy(sensibleCoolingCapacityCurve);
+        targetIdf.addObjectCopy(coolingPowerConsumptionCurve);
         m_new.emplace_back(std::move(totalCoolingCapacityCurve));
         m_new.emplace_back(std::move(sensibleCoolingCapacityCurve));
         m_new.emplace_back(std::move(coolingPowerConsumptionCurve));
@@ -6403,12 +6206,12 @@ namespace osversion {
         newObject.setString(10, heatingCapacityCurve.nameString());
         newObject.setString(11, heatingPowerConsumptionCurve.nameString());
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // Register new Curve objects
-        ss << heatingCapacityCurve;
-        ss << heatingPowerConsumptionCurve;
+        targetIdf.addObjectCopy(heatingCapacityCurve);
+        targetIdf.addObjectCopy(heatingPowerConsumptionCurve);
         m_new.emplace_back(std::move(heatingCapacityCurve));
         m_new.emplace_back(std::move(heatingPowerConsumptionCurve));
 
@@ -6465,12 +6268,12 @@ namespace osversion {
         newObject.setString(10, coolingCapacityCurve.nameString());
         newObject.setString(11, coolingCompressorPowerCurve.nameString());
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // Register new Curve objects
-        ss << coolingCapacityCurve;
-        ss << coolingCompressorPowerCurve;
+        targetIdf.addObjectCopy(coolingCapacityCurve);
+        targetIdf.addObjectCopy(coolingCompressorPowerCurve);
         m_new.emplace_back(std::move(coolingCapacityCurve));
         m_new.emplace_back(std::move(coolingCompressorPowerCurve));
 
@@ -6527,32 +6330,29 @@ namespace osversion {
         newObject.setString(10, heatingCapacityCurve.nameString());
         newObject.setString(11, heatingCompressorPowerCurve.nameString());
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // Register new Curve objects
-        ss << heatingCapacityCurve;
-        ss << heatingCompressorPowerCurve;
+        targetIdf.addObjectCopy(heatingCapacityCurve);
+        targetIdf.addObjectCopy(heatingCompressorPowerCurve);
         m_new.emplace_back(std::move(heatingCapacityCurve));
         m_new.emplace_back(std::move(heatingCompressorPowerCurve));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_1_0_to_3_2_0
 
-  std::string VersionTranslator::update_3_2_0_to_3_2_1(const IdfFile& idf_3_2_0, const IddFileAndFactoryWrapper& idd_3_2_1) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_2_0_to_3_2_1(const IdfFile& idf_3_2_0, const IddFileAndFactoryWrapper& idd_3_2_1) {
     boost::optional<std::string> value;
 
-    ss << idf_3_2_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_2_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_2_0, idd_3_2_1);
 
     for (const IdfObject& object : idf_3_2_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -6560,7 +6360,7 @@ namespace osversion {
       if ((iddname == "OS:WaterHeater:Mixed") || (iddname == "OS:WaterHeater:Stratified")) {
 
         // Object is unchanged
-        ss << object;
+        targetIdf.addObjectCopy(object);
 
         // But we also add a WaterHeater:Sizing object
         auto iddObject = idd_3_2_1.getObject("OS:WaterHeater:Sizing");
@@ -6578,26 +6378,23 @@ namespace osversion {
         newObject.setDouble(5, 1.0);
 
         // Register new WaterHeater:Sizing objects
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_new.emplace_back(std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_2_0_to_3_2_1
 
-  std::string VersionTranslator::update_3_2_1_to_3_3_0(const IdfFile& idf_3_2_1, const IddFileAndFactoryWrapper& idd_3_3_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_2_1_to_3_3_0(const IdfFile& idf_3_2_1, const IddFileAndFactoryWrapper& idd_3_3_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_2_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_3_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_2_1, idd_3_3_0);
 
     for (IdfObject& object : idf_3_2_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -6622,7 +6419,7 @@ namespace osversion {
         newObject.setString(5, "Yes");
         newObject.setString(6, "CurrentOccupancy");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:GroundHeatExchanger:Vertical") {
@@ -6647,7 +6444,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if ((iddname == "OS:Controller:MechanicalVentilation") || (iddname == "OS:Sizing:System")) {
@@ -6675,12 +6472,12 @@ namespace osversion {
             }
           }
 
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         } else {
           // Nothing to do since there's no rename to perform
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else if (iddname == "OS:SizingPeriod:DesignDay") {
@@ -6724,26 +6521,23 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_2_1_to_3_3_0
 
-  std::string VersionTranslator::update_3_3_0_to_3_4_0(const IdfFile& idf_3_3_0, const IddFileAndFactoryWrapper& idd_3_4_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_3_0_to_3_4_0(const IdfFile& idf_3_3_0, const IddFileAndFactoryWrapper& idd_3_4_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_3_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_4_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_3_0, idd_3_4_0);
 
     for (IdfObject& object : idf_3_3_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -6775,7 +6569,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
       } else if (iddname == "OS:Coil:Heating:DX:MultiSpeed:StageData") {
         auto iddObject = idd_3_4_0.getObject(iddname);
@@ -6794,7 +6588,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ModelObjectList") {
@@ -6808,26 +6602,23 @@ namespace osversion {
         }
 
         if (!isOnCoil) {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_3_0_to_3_4_0
 
-  std::string VersionTranslator::update_3_4_0_to_3_5_0(const IdfFile& idf_3_4_0, const IddFileAndFactoryWrapper& idd_3_5_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_4_0_to_3_5_0(const IdfFile& idf_3_4_0, const IddFileAndFactoryWrapper& idd_3_5_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_4_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_5_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_4_0, idd_3_5_0);
 
     // ZoneHVAC:Packaged AirConditionner / HeatPump: prescan
     // In E+ 22.1.0, you could have a Packaged system with a Fan:ConstantVolume and a blank schedule for Supply Air Fan Operating Mode Schedule Name
@@ -6867,7 +6658,7 @@ namespace osversion {
     std::string alwaysOnDiscreteScheduleHandleStr;
     std::string alwaysOffDiscreteScheduleHandleStr;
 
-    auto getOrCreateAlwaysDiscreteScheduleHandleStr = [this, &ss, &idf_3_4_0, &idd_3_5_0, &alwaysOnDiscreteScheduleHandleStr,
+    auto getOrCreateAlwaysDiscreteScheduleHandleStr = [this, &targetIdf, &idf_3_4_0, &idd_3_5_0, &alwaysOnDiscreteScheduleHandleStr,
                                                        &alwaysOffDiscreteScheduleHandleStr](bool isAlwaysOn) -> std::string {
       auto& discreteSchHandleStr = isAlwaysOn ? alwaysOnDiscreteScheduleHandleStr : alwaysOffDiscreteScheduleHandleStr;
       if (!discreteSchHandleStr.empty()) {
@@ -6907,8 +6698,8 @@ namespace osversion {
 
         discreteSch.setString(2, typeLimits.getString(0).get());
 
-        ss << discreteSch;
-        ss << typeLimits;
+        targetIdf.addObjectCopy(discreteSch);
+        targetIdf.addObjectCopy(typeLimits);
 
         // Register new objects
         m_new.push_back(discreteSch);
@@ -6962,7 +6753,7 @@ namespace osversion {
               newObject.setDouble(3, 0.0);
 
               m_refactored.push_back(RefactoredObjectData(object, newObject));
-              ss << newObject;
+              targetIdf.addObjectCopy(newObject);
 
               isAirWall = true;
             }
@@ -6970,7 +6761,7 @@ namespace osversion {
         }
 
         if (!isAirWall) {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else if (iddname == "OS:Material:AirWall") {
@@ -7082,11 +6873,11 @@ namespace osversion {
         m_refactored.push_back(RefactoredObjectData(object, tableObject));
         m_new.push_back(varList);
 
-        ss << tableObject;
-        ss << varList;
+        targetIdf.addObjectCopy(tableObject);
+        targetIdf.addObjectCopy(varList);
 
         for (auto&& varAdded : varsAdded) {
-          ss << varAdded;
+          targetIdf.addObjectCopy(varAdded);
           m_new.emplace_back(std::move(varAdded));
         }
 
@@ -7113,7 +6904,7 @@ namespace osversion {
         newObject.setDouble(7, 934.4);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:DX:SingleSpeed") {
 
@@ -7151,7 +6942,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Heating:DX:MultiSpeed:StageData") {
 
@@ -7176,7 +6967,7 @@ namespace osversion {
         newObject.setDouble(6, 934.4);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:DX:MultiSpeed:StageData") {
 
@@ -7201,7 +6992,7 @@ namespace osversion {
         newObject.setDouble(7, 934.4);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:DX:CurveFit:Speed") {
 
@@ -7226,7 +7017,7 @@ namespace osversion {
         newObject.setDouble(9, 934.4);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Heating:WaterToAirHeatPump:EquationFit") {
 
@@ -7259,7 +7050,7 @@ namespace osversion {
         newObject.setDouble(12, 1.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:WaterToAirHeatPump:EquationFit") {
 
@@ -7292,7 +7083,7 @@ namespace osversion {
         newObject.setDouble(13, 19.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Sizing:Zone") {
 
@@ -7333,7 +7124,7 @@ namespace osversion {
         newObject.setDouble(32, 0.005);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Heating:Gas:MultiStage") {
 
@@ -7342,7 +7133,7 @@ namespace osversion {
         // * Availability Schedule * 2
 
         if (!object.isEmpty(2)) {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         } else {
 
           auto iddObject = idd_3_5_0.getObject(iddname);
@@ -7355,13 +7146,13 @@ namespace osversion {
           newObject.setString(2, getOrCreateAlwaysDiscreteScheduleHandleStr(true));
 
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
         }
 
       } else if (iddname == "OS:ZoneHVAC:PackagedTerminalHeatPump") {
 
         if (!object.isEmpty(23)) {
-          ss << object;
+          targetIdf.addObjectCopy(object);
 
         } else {
           auto iddObject = idd_3_5_0.getObject(iddname);
@@ -7376,12 +7167,12 @@ namespace osversion {
           newObject.setString(23, alwaysOffDiscreteScheduleHandleStr);
 
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
         }
       } else if (iddname == "OS:ZoneHVAC:PackagedTerminalAirConditioner") {
 
         if (!object.isEmpty(17)) {
-          ss << object;
+          targetIdf.addObjectCopy(object);
 
         } else {
           auto iddObject = idd_3_5_0.getObject(iddname);
@@ -7396,13 +7187,13 @@ namespace osversion {
           newObject.setString(17, alwaysOffDiscreteScheduleHandleStr);
 
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
         }
 
       } else if (iddname == "OS:Fan:ConstantVolume") {
         std::string fanHandleStr = object.getString(0).get();
         if (std::find(packagedFanCVHandleStrs.cbegin(), packagedFanCVHandleStrs.cend(), fanHandleStr) == packagedFanCVHandleStrs.cend()) {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         } else {
           LOG(Warn, "Fan:ConstantVolume "
                       << object.nameString()
@@ -7504,26 +7295,23 @@ namespace osversion {
           newObject.setDouble(20, 0.0);
 
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
         }
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_4_0_to_3_5_0
 
-  std::string VersionTranslator::update_3_5_0_to_3_5_1(const IdfFile& idf_3_5_0, const IddFileAndFactoryWrapper& idd_3_5_1) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_5_0_to_3_5_1(const IdfFile& idf_3_5_0, const IddFileAndFactoryWrapper& idd_3_5_1) {
     boost::optional<std::string> value;
 
-    ss << idf_3_5_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_5_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_5_0, idd_3_5_1);
 
     for (const IdfObject& object : idf_3_5_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -7549,25 +7337,22 @@ namespace osversion {
         newObject.setDouble(3, 1.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_5_0_to_3_5_1
 
-  std::string VersionTranslator::update_3_5_1_to_3_6_0(const IdfFile& idf_3_5_1, const IddFileAndFactoryWrapper& idd_3_6_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_5_1_to_3_6_0(const IdfFile& idf_3_5_1, const IddFileAndFactoryWrapper& idd_3_6_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_5_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_6_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_5_1, idd_3_6_0);
 
     for (const IdfObject& object : idf_3_5_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -7604,16 +7389,16 @@ namespace osversion {
         m_refactored.push_back(RefactoredObjectData(object, ghxObject));
         m_new.push_back(kusudaObject);
 
-        ss << ghxObject;
-        ss << kusudaObject;
+        targetIdf.addObjectCopy(ghxObject);
+        targetIdf.addObjectCopy(kusudaObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_5_1_to_3_6_0
 
@@ -7878,13 +7663,10 @@ namespace osversion {
     return result;
   }
 
-  std::string VersionTranslator::update_3_6_1_to_3_7_0(const IdfFile& idf_3_6_1, const IddFileAndFactoryWrapper& idd_3_7_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_6_1_to_3_7_0(const IdfFile& idf_3_6_1, const IddFileAndFactoryWrapper& idd_3_7_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_6_1.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_7_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_6_1, idd_3_7_0);
 
     std::vector<CoilLatentTransitionInfo> coilTransitionInfos = preScanCoilLatentChanges(idf_3_6_1);
 
@@ -7981,7 +7763,7 @@ namespace osversion {
     // Could make it a static inside the lambda, except that it won't be reset so if you try to translate twice it fails
     std::string discreteSchHandleStr;
 
-    auto getOrCreateAlwaysOnContinuousSheduleHandleStr = [this, &ss, &idf_3_6_1, &idd_3_7_0, &discreteSchHandleStr]() -> std::string {
+    auto getOrCreateAlwaysOnContinuousSheduleHandleStr = [this, &targetIdf, &idf_3_6_1, &idd_3_7_0, &discreteSchHandleStr]() -> std::string {
       if (!discreteSchHandleStr.empty()) {
         LOG(Trace, "Already found 'Always On Continuous' Schedule in model with handle " << discreteSchHandleStr);
         return discreteSchHandleStr;
@@ -8021,8 +7803,8 @@ namespace osversion {
 
       discreteSch.setString(2, typeLimits.getString(0).get());
 
-      ss << discreteSch;
-      ss << typeLimits;
+      targetIdf.addObjectCopy(discreteSch);
+      targetIdf.addObjectCopy(typeLimits);
 
       // Register new objects
       m_new.emplace_back(std::move(discreteSch));
@@ -8077,8 +7859,8 @@ namespace osversion {
         m_refactored.push_back(RefactoredObjectData(object, ghxObject));
         m_new.push_back(kusudaObject);
 
-        ss << ghxObject;
-        ss << kusudaObject;
+        targetIdf.addObjectCopy(ghxObject);
+        targetIdf.addObjectCopy(kusudaObject);
 
       } else if ((iddname == "OS:Coil:Cooling:DX:VariableSpeed:SpeedData") || (iddname == "OS:Coil:Heating:DX:VariableSpeed:SpeedData")) {
 
@@ -8116,7 +7898,7 @@ namespace osversion {
         newObject.setDouble(insertionIndex + 1, 934.4);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:DX:TwoSpeed") {
 
@@ -8153,7 +7935,7 @@ namespace osversion {
         newObject.setDouble(22, 934.4);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:AirLoopHVAC:UnitarySystem") {
 
@@ -8394,14 +8176,14 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.push_back(RefactoredObjectData(object, std::move(newObject)));
 
         auto it = CoilLatentTransitionInfo::findFromParent(coilTransitionInfos, object);
         if (it != coilTransitionInfos.end()) {
           if (it->isCurveCreationNeeded()) {
             IdfObject plfCurve = it->createCurveLinear(idd_3_7_0);
-            ss << plfCurve;
+            targetIdf.addObjectCopy(plfCurve);
             m_new.emplace_back(std::move(plfCurve));
           }
         }
@@ -8428,13 +8210,13 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
         auto it = CoilLatentTransitionInfo::findFromParent(coilTransitionInfos, object);
         if (it != coilTransitionInfos.end()) {
           if (it->isCurveCreationNeeded()) {
             IdfObject plfCurve = it->createCurveLinear(idd_3_7_0);
-            ss << plfCurve;
+            targetIdf.addObjectCopy(plfCurve);
             m_new.emplace_back(std::move(plfCurve));
           }
         }
@@ -8485,7 +8267,7 @@ namespace osversion {
         // newObject.setString(17; "");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:WaterToAirHeatPump:EquationFit") {
 
@@ -8530,11 +8312,11 @@ namespace osversion {
         newObject.setDouble(22, hpDelayTime);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
         if (!hasCoilInfo) {
           IdfObject plfCurve = CoilLatentTransitionInfo::defaultHeatPumpCoilPLFCorrelationCurve(idd_3_7_0, curveName);
-          ss << plfCurve;
+          targetIdf.addObjectCopy(plfCurve);
           m_new.emplace_back(std::move(plfCurve));
         }
 
@@ -8578,7 +8360,7 @@ namespace osversion {
         newObject.setDouble(14, hpDelayTime);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:Coil:Heating:WaterToAirHeatPump:EquationFit") {
 
@@ -8601,11 +8383,11 @@ namespace osversion {
         newObject.setString(15, curveName);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
         if (!hasCoilInfo) {
           IdfObject plfCurve = CoilLatentTransitionInfo::defaultHeatPumpCoilPLFCorrelationCurve(idd_3_7_0, curveName);
-          ss << plfCurve;
+          targetIdf.addObjectCopy(plfCurve);
           m_new.emplace_back(std::move(plfCurve));
         }
 
@@ -8632,7 +8414,7 @@ namespace osversion {
         newObject.setDouble(16, 0.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:DistrictHeating") {
 
@@ -8655,7 +8437,7 @@ namespace osversion {
         // Add the new "Capacity Fraction Schedule"
         newObject.setString(5, getOrCreateAlwaysOnContinuousSheduleHandleStr());
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:DistrictCooling") {
@@ -8674,7 +8456,7 @@ namespace osversion {
         // Add the new "Capacity Fraction Schedule"
         newObject.setString(5, getOrCreateAlwaysOnContinuousSheduleHandleStr());
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Output:Meter") {
@@ -8687,7 +8469,7 @@ namespace osversion {
         }
         if (name == object.nameString()) {
           // No-op
-          ss << object;
+          targetIdf.addObjectCopy(object);
         } else {
 
           // Copy everything but 'Variable Name' field
@@ -8706,7 +8488,7 @@ namespace osversion {
 
           newObject.setName(name);
 
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         }
 
@@ -8727,7 +8509,7 @@ namespace osversion {
           auto it = replaceOutputVariablesMap.find(variableName);
           if (it == replaceOutputVariablesMap.end()) {
             // No-op
-            ss << object;
+            targetIdf.addObjectCopy(object);
           } else {
 
             // Copy everything but 'Variable Name' field
@@ -8745,12 +8527,12 @@ namespace osversion {
             LOG(Trace, "Replacing " << variableName << " with " << it->second << " for " << object.nameString());
             newObject.setString(variableNameIndex, it->second);
 
-            ss << newObject;
+            targetIdf.addObjectCopy(newObject);
             m_refactored.emplace_back(std::move(object), std::move(newObject));
           }
         } else {
           // No-op
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
       } else if (auto it = std::find_if(crankcaseCoilWithIndex.cbegin(), crankcaseCoilWithIndex.cend(),
@@ -8780,7 +8562,7 @@ namespace osversion {
         // newObject.setString(insertionIndex; "");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (fuelTypeRenamesMap.find(iddname) != fuelTypeRenamesMap.end()) {
         LOG(Trace, "Checking for a fuel type rename in Object of type '" << iddname << "' and named '" << object.nameString() << "'");
@@ -8810,11 +8592,11 @@ namespace osversion {
             replaceForField(object, newObject, it->second);
           }
 
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
           m_refactored.emplace_back(std::move(object), std::move(newObject));
         } else {
           // No-op
-          ss << object;
+          targetIdf.addObjectCopy(object);
         }
 
         //    } else if ((iddname == "OS:Coil:Heating:Gas") || (iddname == "OS:Coil:Heating:Gas:MultiStage")
@@ -8842,7 +8624,7 @@ namespace osversion {
         newObject.setString(27, "InterlockedWithMechanicalCooling");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:LoadProfile:Plant") {
 
@@ -8864,7 +8646,7 @@ namespace osversion {
         newObject.setDouble(8, 5.0);
         newObject.setDouble(9, 20.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:HeatPump:PlantLoop:EIR:Cooling") {
@@ -8894,7 +8676,7 @@ namespace osversion {
         newObject.setDouble(19, -100.0);
         newObject.setDouble(20, 100.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:HeatPump:PlantLoop:EIR:Heating") {
@@ -8940,26 +8722,23 @@ namespace osversion {
         newObject.setString(27, "None");
         newObject.setDouble(28, 0.058333);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_6_1_to_3_7_0
 
-  std::string VersionTranslator::update_3_7_0_to_3_8_0(const IdfFile& idf_3_7_0, const IddFileAndFactoryWrapper& idd_3_8_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_7_0_to_3_8_0(const IdfFile& idf_3_7_0, const IddFileAndFactoryWrapper& idd_3_8_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_7_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_8_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_7_0, idd_3_8_0);
 
     constexpr std::array<int, 4> hx_old_100effectiveness_idxs{4, 5, 8, 9};
     constexpr std::array<int, 4> hx_new_effectiveness_curves_idxs{20, 21, 22, 23};
@@ -9030,14 +8809,14 @@ namespace osversion {
                 // Sensible/Latent Effectiveness of Heating/Cooling Air Flow Curve Name
                 newObject.setString(hx_new_effectiveness_curves_idxs[i], uuid);
 
-                ss << tableLookup;
+                targetIdf.addObjectCopy(tableLookup);
                 m_new.push_back(tableLookup);
               }
             }
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(object, std::move(newObject));
 
         if (tableAdded) {
@@ -9058,10 +8837,10 @@ namespace osversion {
           var.pushExtensibleGroup().setDouble(0, 0.75);                    // Value 1
           var.pushExtensibleGroup().setDouble(0, 1.0);                     // Value 2
 
-          ss << varList;
+          targetIdf.addObjectCopy(varList);
           m_new.emplace_back(std::move(varList));
 
-          ss << var;
+          targetIdf.addObjectCopy(var);
           m_new.emplace_back(std::move(var));
         }
 
@@ -9085,7 +8864,7 @@ namespace osversion {
 
         newObject.setString(10, "Yes");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneHVAC:WaterToAirHeatPump") {
@@ -9108,7 +8887,7 @@ namespace osversion {
 
         newObject.setString(9, "Yes");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:AirLoopHVAC:UnitarySystem") {
@@ -9131,7 +8910,7 @@ namespace osversion {
 
         newObject.setString(35, "Yes");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:People:Definition") {
@@ -9158,7 +8937,7 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Schedule:Day") {
@@ -9184,26 +8963,23 @@ namespace osversion {
           }
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_7_0_to_3_8_0
 
-  std::string VersionTranslator::update_3_8_0_to_3_9_0(const IdfFile& idf_3_8_0, const IddFileAndFactoryWrapper& idd_3_9_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_8_0_to_3_9_0(const IdfFile& idf_3_8_0, const IddFileAndFactoryWrapper& idd_3_9_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_8_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_9_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_8_0, idd_3_9_0);
 
     // ZoneHVAC:TerminalUnit:VariableRefrigerantFlow prescan
     // In E+ v24.2.0, we must change Fan:VariableVolume to Fan:SystemModel for Supply Air Fan Object Type / Name.
@@ -9250,7 +9026,7 @@ namespace osversion {
           newObject.setString(25, "Yes");
         }
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:OutputControl:Files") {
@@ -9272,7 +9048,7 @@ namespace osversion {
 
         newObject.setString(9, "Yes");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:HeatPump:PlantLoop:EIR:Heating") {
@@ -9307,7 +9083,7 @@ namespace osversion {
         newObject.setString(12, "Autosize");
         newObject.setDouble(36, 4.5);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:HeatPump:PlantLoop:EIR:Cooling") {
@@ -9344,7 +9120,7 @@ namespace osversion {
         newObject.setDouble(26, 60.0);
         newObject.setDouble(30, 0.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:AirTerminal:SingleDuct:SeriesPIU:Reheat") {
@@ -9373,7 +9149,7 @@ namespace osversion {
         newObject.setDouble(19, 32.1);
         newObject.setDouble(20, 37.7);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:AirTerminal:SingleDuct:ParallelPIU:Reheat") {
@@ -9402,7 +9178,7 @@ namespace osversion {
         newObject.setDouble(20, 32.1);
         newObject.setDouble(21, 37.7);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Chiller:Electric:EIR") {
@@ -9426,7 +9202,7 @@ namespace osversion {
         newObject.setDouble(38, 0.2);
         newObject.setDouble(40, 0.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Chiller:Electric:ReformulatedEIR") {
@@ -9450,13 +9226,13 @@ namespace osversion {
         newObject.setDouble(34, 0.2);
         newObject.setDouble(36, 0.0);
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:Fan:VariableVolume") {
         std::string fanHandleStr = object.getString(0).get();
         if (std::find(vrfFanVVHandleStrs.cbegin(), vrfFanVVHandleStrs.cend(), fanHandleStr) == vrfFanVVHandleStrs.cend()) {
-          ss << object;
+          targetIdf.addObjectCopy(object);
         } else {
           IdfObject newObject(idd_3_9_0.getObject("OS:Fan:SystemModel").get());
 
@@ -9587,7 +9363,7 @@ namespace osversion {
           // Output Unit Type
           curveQuartic.setString(12, "Dimensionless");
 
-          ss << curveQuartic;
+          targetIdf.addObjectCopy(curveQuartic);
           m_new.push_back(curveQuartic);
 
           // Electric Power Function of Flow Fraction Curve Name
@@ -9606,7 +9382,7 @@ namespace osversion {
           newObject.setDouble(20, 0.0);
 
           m_refactored.emplace_back(std::move(object), std::move(newObject));
-          ss << newObject;
+          targetIdf.addObjectCopy(newObject);
         }
 
       } else if (iddname == "OS:Sizing:Zone") {
@@ -9626,26 +9402,23 @@ namespace osversion {
 
         newObject.setString(39, "Coincident");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_8_0_to_3_9_0
 
-  std::string VersionTranslator::update_3_9_0_to_3_10_0(const IdfFile& idf_3_9_0, const IddFileAndFactoryWrapper& idd_3_10_0) {
-    std::stringstream ss;
+  OptionalIdfFile VersionTranslator::update_3_9_0_to_3_10_0(const IdfFile& idf_3_9_0, const IddFileAndFactoryWrapper& idd_3_10_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_9_0.header() << '\n' << '\n';
-    IdfFile targetIdf(idd_3_10_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    IdfFile targetIdf = createTargetIdf(idf_3_9_0, idd_3_10_0);
 
     for (const IdfObject& object : idf_3_9_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -9670,7 +9443,7 @@ namespace osversion {
 
         newObject.setString(25, "Simultaneous");
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:GroundHeatExchanger:Vertical") {
@@ -9694,7 +9467,7 @@ namespace osversion {
 
         newObject.setDouble(6, 1.0);  // this value of 1 is what we previously had hardcoded in FT
 
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
         m_refactored.emplace_back(std::move(object), std::move(newObject));
 
       } else if (iddname == "OS:ZoneVentilation:DesignFlowRate") {
@@ -9714,7 +9487,7 @@ namespace osversion {
         newObject.setString(26, "Outdoor");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
       } else if (iddname == "OS:SpaceInfiltration:DesignFlowRate") {
 
@@ -9733,15 +9506,15 @@ namespace osversion {
         newObject.setString(13, "Outdoor");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObjectCopy(newObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObjectCopy(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_9_0_to_3_10_0
 
@@ -18,21 +18,30 @@ BCLFileReference::BCLFileReference(const openstudio::path& measureRootDir, const
   // DLM: why would you not want to set the members?
   if (setMembers) {
     m_checksum = openstudio::checksum(m_path);
+    setSoftwareProgramFromFileType();
+  }
+}
 
-    std::string fileType = this->fileType();
-    if (fileType == "osm") {
-      m_softwareProgram = "OpenStudio";
-      //m_softwareProgramVersion = "";
-    } else if (fileType == "osc") {
-      m_softwareProgram = "OpenStudio";
-      //m_softwareProgramVersion = "";
-    } else if (fileType == "idf") {
-      m_softwareProgram = "EnergyPlus";
-      //m_softwareProgramVersion = "";
-    } else if ((fileType == "rb") || (fileType == "py")) {
-      m_softwareProgram = "OpenStudio";
-      //m_softwareProgramVersion = "";
-    }
+BCLFileReference::BCLFileReference(const openstudio::path& measureRootDir, const openstudio::path& relativePath, const std::string& checksum)
+  : BCLFileReference(measureRootDir, relativePath, false) {
+  m_checksum = checksum;
+  setSoftwareProgramFromFileType();
+}
+
+void BCLFileReference::setSoftwareProgramFromFileType() {
+  std::string fileType = this->fileType();
+  if (fileType == "osm") {
+    m_softwareProgram = "OpenStudio";
+    //m_softwareProgramVersion = "";
+  } else if (fileType == "osc") {
+    m_softwareProgram = "OpenStudio";
+    //m_softwareProgramVersion = "";
+  } else if (fileType == "idf") {
+    m_softwareProgram = "EnergyPlus";
+    //m_softwareProgramVersion = "";
+  } else if ((fileType == "rb") || (fileType == "py")) {
+    m_softwareProgram = "OpenStudio";
+    //m_softwareProgramVersion = "";
   }
 }
 
@@ -191,7 +200,10 @@ std::string BCLFileReference::toJSONString() const {
 }
 
 bool BCLFileReference::checkForUpdate() {
-  std::string newChecksum = openstudio::checksum(this->path());
+  return checkForUpdate(openstudio::checksum(this->path()));
+}
+
+bool BCLFileReference::checkForUpdate(const std::string& newChecksum) {
   if (m_checksum != newChecksum) {
     m_checksum = newChecksum;
     return true;
@@ -32,6 +32,9 @@ class UTILITIES_API BCLFileReference
   /// Constructor from file path.
   explicit BCLFileReference(const openstudio::path& measureRootDir, const openstudio::path& relativePath, const bool setMembers = false);
 
+  /// Constructor from file path and its already computed checksum, sets the other members as with setMembers.
+  explicit BCLFileReference(const openstudio::path& measureRootDir, const openstudio::path& relativePath, const std::string& checksum);
+
   //@}
   /** @name Destructor */
   //@{
@@ -100,6 +103,9 @@ class UTILITIES_API BCLFileReference
   /// Check if the file has been updated and return if so.  Will update checksum.
   bool checkForUpdate();
 
+  /// Same as checkForUpdate, given the current checksum of the file.
+  bool checkForUpdate(const std::string& newChecksum);
+
   //@}
 
  protected:
@@ -120,6 +126,8 @@ class UTILITIES_API BCLFileReference
   // configure logging
   REGISTER_LOGGER("utilities.bcl.BCLFileReference");
 
+  void setSoftwareProgramFromFileType();
+
   openstudio::path m_measureRootDir;
   openstudio::path m_path;
   std::string m_checksum;
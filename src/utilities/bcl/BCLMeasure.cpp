@@ -12,6 +12,7 @@
 #include "../core/FilesystemHelpers.hpp"
 #include "../core/StringHelpers.hpp"
 #include "../core/FileReference.hpp"
+#include "../core/FileChecksumCache.hpp"
 #include "../core/Assert.hpp"
 
 #include <OpenStudio.hxx>
@@ -964,10 +965,16 @@ bool BCLMeasure::missingRequiredFields() const {
 }
 
 bool BCLMeasure::checkForUpdatesFiles() {
+  FileChecksumCache cache;
+  return checkForUpdatesFiles(cache);
+}
+
+bool BCLMeasure::checkForUpdatesFiles(FileChecksumCache& cache) {
   bool result = false;
 
   std::vector<BCLFileReference> filesToRemove;
   std::vector<BCLFileReference> filesToAdd;
+  std::vector<BCLFileReference> filesToCheck;
 
   // For all files we have on reference in the measure.xml
   for (BCLFileReference& file : m_bclXML.files()) {
@@ -990,19 +997,23 @@ bool BCLMeasure::checkForUpdatesFiles() {
       result = true;
       filesToRemove.push_back(file);
 
-      // otherwise, compute new checksum, and if not the same: mark it for addition
-    } else if (file.checkForUpdate()) {
-      LOG(Info, filePath << " has been updated");
-      result = true;
-      filesToAdd.push_back(file);
+      // otherwise, the new checksum is computed below, and if not the same: mark it for addition
+    } else {
+      filesToCheck.push_back(file);
     }
   }
 
-  auto addWithUsageTypeIfNotExisting = [this, &filesToAdd](const openstudio::path& relativeFilePath, const std::string& usageType) -> bool {
+  struct NewFile
+  {
+    openstudio::path relativeFilePath;
+    std::string usageType;
+    bool isMeasureScript = false;
+  };
+  std::vector<NewFile> newFiles;
+
+  auto addWithUsageTypeIfNotExisting = [this, &newFiles](const openstudio::path& relativeFilePath, const std::string& usageType) -> bool {
     if (!m_bclXML.hasFile(m_directory / relativeFilePath)) {
-      BCLFileReference fileref(m_directory, relativeFilePath, true);
-      fileref.setUsageType(usageType);
-      filesToAdd.push_back(fileref);
+      newFiles.push_back(NewFile{relativeFilePath, usageType});
       return true;
     } else {
       return false;
@@ -1043,12 +1054,40 @@ bool BCLMeasure::checkForUpdatesFiles() {
       bool thisResult = addWithUsageTypeIfNotExisting(relativeFilePath, std::string(usageType));
       if (thisResult && ((fileName == "measure.rb") || (fileName == "measure.py"))) {
         // we don't know what the actual version this was created for, we also don't know minimum version
-        filesToAdd.back().setSoftwareProgramVersion(openStudioVersion());
+        newFiles.back().isMeasureScript = true;
       }
       result |= thisResult;
     }
   }
 
+  // Hash the tracked files and the new ones in one go, the cache skips the files that did not change and hashes the others in parallel
+  std::vector<openstudio::path> pathsToHash;
+  pathsToHash.reserve(filesToCheck.size() + newFiles.size());
+  for (const BCLFileReference& file : filesToCheck) {
+    pathsToHash.push_back(file.path());
+  }
+  for (const NewFile& newFile : newFiles) {
+    pathsToHash.push_back(openstudio::filesystem::system_complete(m_directory / newFile.relativeFilePath));
+  }
+  const std::vector<std::string> checksums = cache.checksums(pathsToHash);
+
+  for (size_t i = 0; i < filesToCheck.size(); ++i) {
+    BCLFileReference& file = filesToCheck[i];
+    if (file.checkForUpdate(checksums[i])) {
+      LOG(Info, file.path() << " has been updated");
+      result = true;
+      filesToAdd.push_back(file);
+    }
+  }
+
+  for (size_t i = 0; i < newFiles.size(); ++i) {
+    BCLFileReference& fileref = filesToAdd.emplace_back(m_directory, newFiles[i].relativeFilePath, checksums[filesToCheck.size() + i]);
+    fileref.setUsageType(newFiles[i].usageType);
+    if (newFiles[i].isMeasureScript) {
+      fileref.setSoftwareProgramVersion(openStudioVersion());
+    }
+  }
+
   for (const BCLFileReference& file : filesToRemove) {
     m_bclXML.removeFile(file.path());
   }
@@ -1084,6 +1123,10 @@ bool BCLMeasure::checkForUpdatesFiles() {
   return result;
 }
 
+openstudio::path BCLMeasure::fileChecksumCachePath() const {
+  return m_directory / ".checksums.json";
+}
+
 bool BCLMeasure::checkForUpdatesXML() {
   return m_bclXML.checkForUpdatesXML();
 }
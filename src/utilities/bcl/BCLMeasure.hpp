@@ -23,6 +23,7 @@ class Value;
 namespace openstudio {
 
 class FileReferenceType;
+class FileChecksumCache;
 
 /** BCLMeasure is a class for managing the contents of a BCL Measure directory including the xml description file.
   **/
@@ -208,6 +209,14 @@ class UTILITIES_API BCLMeasure
   /// Typical usage is 1) checkForUpdatesFiles, 2) update content using embedded ruby interpreter, 3) checkForUpdatesXML
   bool checkForUpdatesFiles();
 
+  /// Same as checkForUpdatesFiles(), but the checksums of files that did not change since they were last hashed are taken from cache
+  /// Files that need to be hashed are hashed in parallel
+  bool checkForUpdatesFiles(FileChecksumCache& cache);
+
+  /// Path of the file checksums that can be kept beside the measure.xml, see FileChecksumCache::load and FileChecksumCache::save
+  /// It is ignored like any other dot file, so it is neither tracked in the measure.xml nor cloned
+  openstudio::path fileChecksumCachePath() const;
+
   /// Check for updates to the xml, will increment versionID and xmlChecksum then return true
   /// if any xml fields (other than uid, version id, or xml checksum) have changed
   /// The xml file must still be saved to disk to preserve the new versionID
@@ -10,11 +10,13 @@
 #include "../BCLXML.hpp"
 #include "../../core/ApplicationPathHelpers.hpp"
 #include "../../core/PathHelpers.hpp"
+#include "../../core/FileChecksumCache.hpp"
 #include "../../core/Filesystem.hpp"
 
 #include <pugixml.hpp>
 
 #include <algorithm>
+#include <ctime>
 #include <sstream>
 
 using namespace openstudio;
@@ -1216,3 +1218,39 @@ TEST_F(BCLFixture, BCLMeasure_CTor_throw_invalid_xml) {
   msg = logFile->logMessages().back().logMessage();
   EXPECT_TRUE(msg.find("has wrong type for required attribute \"Measure Type\"") != std::string::npos) << logFile->logMessages().back().logMessage();
 }
+
+TEST_F(BCLFixture, BCLMeasure_checkForUpdatesFiles_FileChecksumCache) {
+
+  openstudio::path srcDir = fs::system_complete(getApplicationBuildDirectory() / toPath("Testing") / toPath("TestFileChecksumCacheMeasure"));
+  if (exists(srcDir)) {
+    removeDirectory(srcDir);
+  }
+
+  BCLMeasure measure("My Measure", "MyMeasure", srcDir, "Envelope.Fenestration", MeasureType::ModelMeasure, "Description", "Modeler Description");
+
+  // Files that were just written are not remembered by the cache
+  std::time_t aMinuteAgo = std::time(nullptr) - 60;
+  for (const auto& entry : fs::recursive_directory_iterator(srcDir)) {
+    if (fs::is_regular_file(entry.path())) {
+      fs::last_write_time(entry.path(), aMinuteAgo);
+    }
+  }
+
+  FileChecksumCache cache;
+  EXPECT_FALSE(measure.checkForUpdatesFiles(cache));
+  size_t numComputed = cache.numComputed();
+  EXPECT_EQ(measure.files().size(), numComputed);
+
+  // Nothing is read again
+  EXPECT_FALSE(measure.checkForUpdatesFiles(cache));
+  EXPECT_EQ(numComputed, cache.numComputed());
+
+  // Only the modified file is
+  {
+    fs::ofstream ofs(srcDir / toPath("LICENSE.md"), std::ios_base::app);
+    ofs << "Modified";
+  }
+  fs::last_write_time(srcDir / toPath("LICENSE.md"), aMinuteAgo + 1);
+  EXPECT_TRUE(measure.checkForUpdatesFiles(cache));
+  EXPECT_EQ(numComputed + 1, cache.numComputed());
+}
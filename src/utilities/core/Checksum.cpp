@@ -5,7 +5,9 @@
 
 #include "Checksum.hpp"
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 
 #include <boost/crc.hpp>
 #include <fmt/format.h>
@@ -36,19 +38,14 @@ std::string checksum(std::string s) {
 /// return 8 character hex checksum of istream
 std::string checksum(std::istream& is) {
   boost::crc_32_type crc;
+  // large reads, and the ignored characters are removed in place rather than through a copy of each chunk
+  constexpr std::streamsize n = 1 << 16;
+  std::vector<char> buffer(n);
   do {
-    const std::streamsize n = 1024;
-    char buffer[n];
-    is.read(buffer, n);
-    std::streamsize readSize = is.gcount();
-    //crc.process_bytes(buffer, readSize);
-
-    auto stringSize = static_cast<size_t>(readSize);
-    std::string str(buffer, stringSize);
-    str.erase(std::remove_if(str.begin(), str.end(), openstudio::detail::checksumIgnore), str.end());
-    stringSize = str.size();
-
-    crc.process_bytes(str.c_str(), stringSize);
+    is.read(buffer.data(), n);
+    char* end = buffer.data() + is.gcount();
+    end = std::remove_if(buffer.data(), end, openstudio::detail::checksumIgnore);
+    crc.process_bytes(buffer.data(), end - buffer.data());
   } while (is);
 
   return fmt::format("{:0>8X}", crc.checksum());
@@ -0,0 +1,183 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "FileChecksumCache.hpp"
+#include "Checksum.hpp"
+#include "Filesystem.hpp"
+#include "ParallelFor.hpp"
+
+#include <json/json.h>
+
+namespace openstudio {
+
+namespace {
+
+  constexpr int fileFormatVersion = 1;
+
+  // last write times only have a resolution of one second, and some file systems round them to two
+  constexpr std::time_t racyWriteSeconds = 2;
+
+  std::string cacheKey(const openstudio::path& p) {
+    return p.generic_string();
+  }
+
+}  // namespace
+
+FileChecksumCache::FileStat FileChecksumCache::stat(const openstudio::path& p) {
+  FileStat result;
+  boost::system::error_code ec;
+  if (!openstudio::filesystem::is_regular_file(p, ec)) {
+    return result;
+  }
+  result.size = openstudio::filesystem::file_size(p, ec);
+  if (ec) {
+    return result;
+  }
+  result.lastWriteTime = openstudio::filesystem::last_write_time(p, ec);
+  if (ec) {
+    return result;
+  }
+  result.exists = true;
+  return result;
+}
+
+std::string FileChecksumCache::checksum(const openstudio::path& p) {
+  return checksums({p}).front();
+}
+
+std::vector<std::string> FileChecksumCache::checksums(const std::vector<openstudio::path>& paths) {
+  std::vector<std::string> result(paths.size());
+
+  // anything written from now on may be written again within the same second
+  const std::time_t start = std::time(nullptr);
+
+  std::vector<FileStat> stats;
+  stats.reserve(paths.size());
+  for (const auto& p : paths) {
+    stats.push_back(stat(p));
+  }
+
+  std::vector<size_t> missing;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i = 0; i < paths.size(); ++i) {
+      if (stats[i].exists) {
+        auto it = m_entries.find(cacheKey(paths[i]));
+        if ((it != m_entries.end()) && (it->second.size == stats[i].size) && (it->second.lastWriteTime == stats[i].lastWriteTime)) {
+          result[i] = it->second.checksum;
+          continue;
+        }
+      }
+      missing.push_back(i);
+    }
+  }
+
+  if (missing.empty()) {
+    return result;
+  }
+
+  // files are hashed independently of each other
+  parallelFor(missing.size(), [&paths, &missing, &result](size_t k) { result[missing[k]] = openstudio::checksum(paths[missing[k]]); });
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_numComputed += missing.size();
+  for (size_t i : missing) {
+    const std::string key = cacheKey(paths[i]);
+    if (stats[i].exists && (stats[i].lastWriteTime + racyWriteSeconds <= start)) {
+      m_entries[key] = Entry{stats[i].size, stats[i].lastWriteTime, result[i]};
+    } else {
+      m_entries.erase(key);
+    }
+  }
+
+  return result;
+}
+
+bool FileChecksumCache::load(const openstudio::path& cacheFile, const openstudio::path& directory) {
+  if (!openstudio::filesystem::is_regular_file(cacheFile)) {
+    return false;
+  }
+
+  Json::Value root;
+  Json::CharReaderBuilder rbuilder;
+  std::string formattedErrors;
+  openstudio::filesystem::ifstream ifs(cacheFile);
+  if (!Json::parseFromStream(rbuilder, ifs, &root, &formattedErrors)) {
+    LOG(Warn, "Cannot read file checksums from " << cacheFile << ", " << formattedErrors);
+    return false;
+  }
+
+  if (!root.isObject() || (root.get("version", 0).asInt() != fileFormatVersion) || !root["files"].isObject()) {
+    LOG(Warn, "Ignoring file checksums in " << cacheFile << " written by another version");
+    return false;
+  }
+
+  const Json::Value& files = root["files"];
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (const std::string& relativePath : files.getMemberNames()) {
+    const Json::Value& file = files[relativePath];
+    if (!file["size"].isIntegral() || !file["last_write_time"].isIntegral() || !file["checksum"].isString()) {
+      continue;
+    }
+    // entries computed by this process are at least as recent
+    m_entries.emplace(cacheKey(directory / toPath(relativePath)),
+                      Entry{static_cast<uintmax_t>(file["size"].asUInt64()), static_cast<std::time_t>(file["last_write_time"].asInt64()),
+                            file["checksum"].asString()});
+  }
+
+  return true;
+}
+
+bool FileChecksumCache::save(const openstudio::path& cacheFile, const openstudio::path& directory) const {
+  std::string prefix = cacheKey(directory);
+  if (prefix.empty() || (prefix.back() != '/')) {
+    prefix += '/';
+  }
+
+  Json::Value files(Json::objectValue);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& [key, entry] : m_entries) {
+      if ((key.size() > prefix.size()) && (key.compare(0, prefix.size(), prefix) == 0)) {
+        Json::Value& file = files[key.substr(prefix.size())];
+        file["size"] = Json::UInt64(entry.size);
+        file["last_write_time"] = Json::Int64(entry.lastWriteTime);
+        file["checksum"] = entry.checksum;
+      }
+    }
+  }
+
+  Json::Value root;
+  root["version"] = fileFormatVersion;
+  root["files"] = files;
+
+  Json::StreamWriterBuilder wbuilder;
+  wbuilder["indentation"] = "  ";
+
+  openstudio::filesystem::ofstream ofs(cacheFile, std::ios_base::trunc);
+  if (!ofs.is_open()) {
+    LOG(Warn, "Cannot write file checksums to " << cacheFile);
+    return false;
+  }
+  ofs << Json::writeString(wbuilder, root);
+  return static_cast<bool>(ofs);
+}
+
+size_t FileChecksumCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+size_t FileChecksumCache::numComputed() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_numComputed;
+}
+
+void FileChecksumCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+}  // namespace openstudio
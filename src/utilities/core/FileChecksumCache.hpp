@@ -0,0 +1,80 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_FILECHECKSUMCACHE_HPP
+#define UTILITIES_CORE_FILECHECKSUMCACHE_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Logger.hpp"
+#include "Path.hpp"
+
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio {
+
+/** FileChecksumCache remembers openstudio::checksum of files, keyed by their path, size and last write time, so that files that
+ *  did not change are not read again. A file written less than two seconds before it was hashed is not remembered, since a
+ *  later write within the same second would keep its size and last write time. Thread-safe. */
+class UTILITIES_API FileChecksumCache
+{
+ public:
+  FileChecksumCache() = default;
+
+  FileChecksumCache(const FileChecksumCache&) = delete;
+  FileChecksumCache& operator=(const FileChecksumCache&) = delete;
+
+  /// Same as openstudio::checksum(p)
+  std::string checksum(const openstudio::path& p);
+
+  /// Same as openstudio::checksum for each path, files that have to be read are hashed on all processors. These are the CRC32
+  /// values stored in measure.xml files and compared against the BCL, so the cache cannot use a faster hash
+  std::vector<std::string> checksums(const std::vector<openstudio::path>& paths);
+
+  /// Adds the entries of a file written by save, for files under directory. Returns false if the file could not be read
+  bool load(const openstudio::path& cacheFile, const openstudio::path& directory);
+
+  /// Writes the entries for files under directory, with paths relative to it so that the directory can be moved
+  bool save(const openstudio::path& cacheFile, const openstudio::path& directory) const;
+
+  /// Number of files in the cache
+  size_t size() const;
+
+  /// Number of files hashed since construction, as opposed to found in the cache
+  size_t numComputed() const;
+
+  void clear();
+
+ private:
+  REGISTER_LOGGER("openstudio.FileChecksumCache");
+
+  struct Entry
+  {
+    uintmax_t size = 0;
+    std::time_t lastWriteTime = 0;
+    std::string checksum;
+  };
+
+  struct FileStat
+  {
+    bool exists = false;
+    uintmax_t size = 0;
+    std::time_t lastWriteTime = 0;
+  };
+
+  static FileStat stat(const openstudio::path& p);
+
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, Entry> m_entries;
+  size_t m_numComputed = 0;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_FILECHECKSUMCACHE_HPP
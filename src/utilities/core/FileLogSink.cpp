@@ -7,6 +7,7 @@
 #include "FileLogSink_Impl.hpp"
 
 #include "Assert.hpp"
+#include "Logger.hpp"
 
 #include <shared_mutex>
 
@@ -32,6 +33,9 @@ namespace detail {
   }
 
   std::vector<LogMessage> FileLogSink_Impl::logMessages() const {
+    // messages may still be queued for the background writer
+    Logger::instance().flush();
+
     openstudio::filesystem::ifstream ifs(m_path);
     std::string line;
     std::string text;
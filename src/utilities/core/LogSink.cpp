@@ -40,7 +40,14 @@ namespace detail {
       // DLM@20110701: would like to format Severity as string but can't figure out how to do it
       // because you can't overload operator<< for an enum type
       // this seems to suggest this should work: http://www.edm2.com/0405/enumeration.html
-      m_formatter{expr::stream << "[" << expr::attr<LogChannel>("Channel") << "] <" << expr::attr<LogLevel>("Severity") << "> " << expr::smessage} {}
+      m_formatter{expr::stream << "[" << expr::attr<LogChannel>("Channel") << "] <" << expr::attr<LogLevel>("Severity") << "> " << expr::smessage} {
+    // accepts everything until a level is set, also replaces a level left behind by a sink that used the same address
+    detail::setSinkLogLevel(m_sink.get(), Trace);
+  }
+
+  LogSink_Impl::~LogSink_Impl() {
+    detail::removeSinkLogLevel(m_sink.get());
+  }
 
   void LogSink_Impl::setFormatter(const boost::log::formatter& fmter) {
     std::unique_lock l{m_mutex};
@@ -198,6 +205,9 @@ namespace detail {
       filterLogLevel = *m_logLevel;
     }
 
+    // lets LOG skip formatting messages that no sink would accept
+    detail::setSinkLogLevel(m_sink.get(), filterLogLevel);
+
     boost::regex filterChannelRegex(".*");
     if (m_channelRegex) {
       filterChannelRegex = *m_channelRegex;
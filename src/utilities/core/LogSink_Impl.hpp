@@ -24,7 +24,7 @@ namespace detail {
   {
    public:
     /// destructor
-    virtual ~LogSink_Impl() = default;
+    virtual ~LogSink_Impl();
 
     /// is the sink enabled
     bool isEnabled() const;
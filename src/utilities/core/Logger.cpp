@@ -9,15 +9,178 @@
 #include <boost/log/attributes/function.hpp>
 #include <boost/log/attributes/clock.hpp>
 
+#include <boost/log/attributes/mutable_constant.hpp>
+#include <boost/lockfree/queue.hpp>
+
 #include <boost/core/null_deleter.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 namespace openstudio {
 
+namespace detail {
+
+  // everything is logged until the first sink says otherwise
+  std::atomic<int> minimumEnabledLogLevel{static_cast<int>(Trace)};
+
+  namespace {
+
+    // Levels of the sinks, and which sinks are registered in the logging core. Not a member of Logger so that sinks
+    // can report their level while the Logger singleton itself is being constructed.
+    struct SinkLogLevels
+    {
+      std::mutex mutex;
+      std::map<const LogSinkBackend*, LogLevel> levels;
+      std::set<const LogSinkBackend*> enabled;
+    };
+
+    // never destroyed, sinks held by static objects are destroyed after function local statics
+    SinkLogLevels& sinkLogLevels() {
+      static auto* result = new SinkLogLevels();
+      return *result;
+    }
+
+    void updateMinimumEnabledLogLevel(const SinkLogLevels& sinks) {
+      int result = static_cast<int>(Fatal) + 1;
+      for (const LogSinkBackend* sink : sinks.enabled) {
+        auto it = sinks.levels.find(sink);
+        int level = (it == sinks.levels.end()) ? static_cast<int>(Trace) : static_cast<int>(it->second);
+        result = std::min(result, level);
+      }
+      minimumEnabledLogLevel.store(result, std::memory_order_relaxed);
+    }
+
+    void setSinkEnabled(const LogSinkBackend* sink, bool enabled) {
+      SinkLogLevels& sinks = sinkLogLevels();
+      std::lock_guard l{sinks.mutex};
+      if (enabled) {
+        sinks.enabled.insert(sink);
+      } else {
+        sinks.enabled.erase(sink);
+      }
+      updateMinimumEnabledLogLevel(sinks);
+    }
+
+  }  // namespace
+
+  void setSinkLogLevel(const LogSinkBackend* sink, LogLevel logLevel) {
+    SinkLogLevels& sinks = sinkLogLevels();
+    std::lock_guard l{sinks.mutex};
+    sinks.levels[sink] = logLevel;
+    updateMinimumEnabledLogLevel(sinks);
+  }
+
+  void removeSinkLogLevel(const LogSinkBackend* sink) {
+    SinkLogLevels& sinks = sinkLogLevels();
+    std::lock_guard l{sinks.mutex};
+    // a sink that was never disabled stays registered in the logging core and keeps writing at its level, only
+    // Logger::addSink and Logger::removeSink change which sinks are enabled
+    if (!sinks.enabled.contains(sink)) {
+      sinks.levels.erase(sink);
+    }
+  }
+
+  /// Bounded queue of messages written to the logging core by a background thread
+  class AsyncLogQueue
+  {
+   public:
+    AsyncLogQueue() : m_thread([this]() { run(); }) {}
+
+    AsyncLogQueue(const AsyncLogQueue&) = delete;
+    AsyncLogQueue& operator=(const AsyncLogQueue&) = delete;
+
+    // writes out everything still queued before returning
+    ~AsyncLogQueue() {
+      m_stop = true;
+      m_condition.notify_one();
+      m_thread.join();
+    }
+
+    void push(LogLevel level, const LogChannel& logChannel, const std::string& message) {
+      auto* entry = new Entry{level, logChannel, message, std::this_thread::get_id()};
+      ++m_pending;
+      while (!m_queue.bounded_push(entry)) {
+        // full, wait for the writer to catch up rather than drop the message
+        m_condition.notify_one();
+        std::this_thread::yield();
+      }
+      m_condition.notify_one();
+    }
+
+    void flush() {
+      std::unique_lock l{m_mutex};
+      m_condition.notify_one();
+      m_flushed.wait(l, [this]() { return m_pending.load() == 0; });
+    }
+
+   private:
+    struct Entry
+    {
+      LogLevel level;
+      LogChannel logChannel;
+      std::string message;
+      std::thread::id threadId;
+    };
+
+    void run() {
+      // Filters and formatters see the thread that logged the message, not this one: a thread attribute takes
+      // precedence over the global ThreadId attribute
+      boost::log::attributes::mutable_constant<std::thread::id> threadIdAttribute{std::thread::id{}};
+      boost::log::core::get()->add_thread_attribute("ThreadId", threadIdAttribute);
+
+      // own loggers, so that writing never waits on the Logger's mutex
+      std::map<LogChannel, LoggerType> loggers;
+
+      while (true) {
+        Entry* entry = nullptr;
+        while (m_queue.pop(entry)) {
+          auto it = loggers.find(entry->logChannel);
+          if (it == loggers.end()) {
+            it = loggers.emplace(entry->logChannel, LoggerType(boost::log::keywords::channel = entry->logChannel)).first;
+          }
+          threadIdAttribute.set(entry->threadId);
+          BOOST_LOG_SEV(it->second, entry->level) << entry->message;
+          delete entry;
+          --m_pending;
+        }
+
+        if (m_pending.load() == 0) {
+          // taking the mutex orders this notification after a flush that saw pending messages starts waiting
+          std::lock_guard l{m_mutex};
+          m_flushed.notify_all();
+        }
+
+        if (m_stop && (m_pending.load() == 0)) {
+          break;
+        }
+
+        std::unique_lock l{m_mutex};
+        m_condition.wait_for(l, std::chrono::milliseconds(10), [this]() { return m_stop || !m_queue.empty(); });
+      }
+    }
+
+    boost::lockfree::queue<Entry*, boost::lockfree::capacity<4096>> m_queue;
+    std::atomic<size_t> m_pending{0};
+    std::atomic<bool> m_stop{false};
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::condition_variable m_flushed;
+    std::thread m_thread;
+  };
+
+}  // namespace detail
+
 /// convenience function for SWIG, prefer macros in C++
 void logFree(LogLevel level, const std::string& channel, const std::string& message) {
-  BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
+  if (!isLogLevelEnabled(level)) {
+    return;
+  }
+  openstudio::Logger::instance().log(level, channel, message);
 }
 
 // Meyers' singleton
@@ -43,6 +206,11 @@ Logger::Logger() {
   //this->addSink(m_standardErrLogger.sink());
 }
 
+Logger::~Logger() {
+  // write out whatever is still queued while the sinks are still around
+  setAsynchronous(false);
+}
+
 LogSink Logger::standardOutLogger() const {
   std::shared_lock l{m_mutex};
 
@@ -75,6 +243,46 @@ LoggerType& Logger::loggerFromChannel(const LogChannel& logChannel) {
   return it->second;
 }
 
+void Logger::log(LogLevel level, const LogChannel& logChannel, const std::string& message) {
+  if (m_asynchronous.load()) {
+    std::shared_lock l{m_mutex};
+    if (m_asyncQueue) {
+      m_asyncQueue->push(level, logChannel, message);
+      return;
+    }
+  }
+  BOOST_LOG_SEV(loggerFromChannel(logChannel), level) << message;
+}
+
+void Logger::setAsynchronous(bool asynchronous) {
+  std::unique_ptr<detail::AsyncLogQueue> oldQueue;
+  {
+    std::unique_lock l{m_mutex};
+    if (asynchronous && !m_asyncQueue) {
+      m_asyncQueue = std::make_unique<detail::AsyncLogQueue>();
+    } else if (!asynchronous) {
+      oldQueue = std::move(m_asyncQueue);
+    }
+    m_asynchronous = asynchronous;
+  }
+  // destroying the queue writes out what is left in it, do it without holding the lock
+  oldQueue.reset();
+}
+
+bool Logger::isAsynchronous() const {
+  return m_asynchronous.load();
+}
+
+void Logger::flush() {
+  if (!m_asynchronous.load()) {
+    return;
+  }
+  std::shared_lock l{m_mutex};
+  if (m_asyncQueue) {
+    m_asyncQueue->flush();
+  }
+}
+
 bool Logger::findSink(boost::shared_ptr<LogSinkBackend> sink) {
   std::unique_lock l{m_mutex};
 
@@ -98,6 +306,7 @@ void Logger::addSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->add_sink(sink);
+    detail::setSinkEnabled(sink.get(), true);
   }
 }
 
@@ -116,6 +325,7 @@ void Logger::removeSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->remove_sink(sink);
+    detail::setSinkEnabled(sink.get(), false);
   }
 }
 
@@ -15,6 +15,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <set>
@@ -33,12 +34,14 @@
 /// log a message from within a registered class and throw an exception
 #define LOG_AND_THROW(__message__) LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
-#define LOG_FREE(__level__, __channel__, __message__)        \
-  {                                                          \
-    std::stringstream _ss1;                                  \
-    _ss1 << __message__;                                     \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+/// log a message from outside a registered class, the message is only formatted if some enabled sink accepts its level
+#define LOG_FREE(__level__, __channel__, __message__)          \
+  {                                                            \
+    if (openstudio::isLogLevelEnabled(__level__)) {            \
+      std::stringstream _ss1;                                  \
+      _ss1 << __message__;                                     \
+      openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    }                                                          \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -56,8 +59,23 @@ class OSWorkflow;
 class LogSink;
 namespace detail {
   class LogSink_Impl;
+  class AsyncLogQueue;
+
+  /// lowest level accepted by any enabled sink, above Fatal if no sink is enabled. Kept up to date by Logger and LogSink
+  UTILITIES_API extern std::atomic<int> minimumEnabledLogLevel;
+
+  /// record the level of a sink, sinks that never set one accept everything
+  UTILITIES_API void setSinkLogLevel(const LogSinkBackend* sink, LogLevel logLevel);
+
+  /// forget the level of a sink that is being destroyed, unless it is still registered in the logging core
+  UTILITIES_API void removeSinkLogLevel(const LogSinkBackend* sink);
 }  // namespace detail
 
+/// true if at least one enabled sink could accept a message at level, cheap enough to call before formatting any message
+inline bool isLogLevelEnabled(LogLevel level) {
+  return static_cast<int>(level) >= detail::minimumEnabledLogLevel.load(std::memory_order_relaxed);
+}
+
 /// convenience function for SWIG, prefer macros in C++
 UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
@@ -81,6 +99,20 @@ class UTILITIES_API Logger
   /// exist a new logger will be set up at the default level
   LoggerType& loggerFromChannel(const LogChannel& logChannel);
 
+  /// send message to the sinks, or to the queue of the background writer if asynchronous
+  void log(LogLevel level, const LogChannel& logChannel, const std::string& message);
+
+  /** When asynchronous, log only puts messages on a bounded queue and a background thread writes them to the sinks,
+   *  so callers are not held up by slow sinks. Messages keep their order and the thread id of the caller, but sinks
+   *  only see them once the writer gets to them; call flush before reading a sink. If the queue is full, log waits. */
+  void setAsynchronous(bool asynchronous);
+
+  /// are messages written by a background thread
+  bool isAsynchronous() const;
+
+  /// wait until every queued message has been written to the sinks, returns immediately if not asynchronous
+  void flush();
+
  protected:
   friend class detail::LogSink_Impl;
   friend class openstudio::OSWorkflow;
@@ -99,7 +131,7 @@ class UTILITIES_API Logger
 
  private:
   Logger();
-  ~Logger() = default;
+  ~Logger();
 
   mutable std::shared_mutex m_mutex;
 
@@ -116,6 +148,10 @@ class UTILITIES_API Logger
   /// current sinks, kept here so don't destruct when LogSink wrapper goes out of scope
   using SinkSetType = std::set<boost::shared_ptr<LogSinkBackend>>;
   SinkSetType m_sinks;
+
+  /// background writer, only set when asynchronous
+  std::atomic<bool> m_asynchronous{false};
+  std::unique_ptr<detail::AsyncLogQueue> m_asyncQueue;
 };
 
 }  // namespace openstudio
@@ -24,6 +24,9 @@
 %ignore std::vector<openstudio::LogMessage>::resize(size_type);
 %ignore openstudio::Logger::loggerFromChannel;
 %ignore openstudio::LogSink::setFormatter;
+%ignore openstudio::detail::minimumEnabledLogLevel;
+%ignore openstudio::detail::setSinkLogLevel;
+%ignore openstudio::detail::removeSinkLogLevel;
 
 %template(LogMessageVector) std::vector<openstudio::LogMessage>;
 %template(OptionalLogMessage) boost::optional<openstudio::LogMessage>;
@@ -0,0 +1,146 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "ParallelFor.hpp"
+#include "System.hpp"
+#include "ThreadSafeDeque.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace openstudio {
+
+namespace {
+
+  // set while a thread works on a loop, nested loops then run serially rather than waiting on threads that are all busy
+  thread_local bool t_inParallelFor = false;
+
+  struct Job
+  {
+    Job(size_t t_n, const std::function<void(size_t)>& t_f) : n(t_n), f(t_f) {}
+
+    const size_t n;
+    // only called while the caller of parallelFor is waiting, see helpers
+    const std::function<void(size_t)>& f;
+
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+
+    std::mutex mutex;
+    std::condition_variable done;
+    // pool threads working on this job
+    size_t helpers = 0;
+    std::exception_ptr error;
+
+    void run() {
+      for (size_t i = next++; i < n; i = next++) {
+        if (failed) {
+          return;
+        }
+        try {
+          f(i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (!failed.exchange(true)) {
+            error = std::current_exception();
+          }
+          return;
+        }
+      }
+    }
+  };
+
+  class WorkerPool
+  {
+   public:
+    explicit WorkerPool(unsigned numThreads) : m_numThreads(numThreads) {
+      for (unsigned t = 0; t < m_numThreads; ++t) {
+        // the pool lives until the process exits, see instance
+        std::thread([this]() { work(); }).detach();
+      }
+    }
+
+    // never destroyed, joining threads from static destructors hangs on some platforms
+    static WorkerPool& instance() {
+      static auto* pool = new WorkerPool(std::max(System::numberOfProcessors(), 1U) - 1);
+      return *pool;
+    }
+
+    unsigned numThreads() const {
+      return m_numThreads;
+    }
+
+    // asks numHelpers pool threads to join job, they may still be busy with other jobs by the time the caller is done
+    void post(const std::shared_ptr<Job>& job, unsigned numHelpers) {
+      for (unsigned t = 0; t < numHelpers; ++t) {
+        m_jobs.push_back(std::shared_ptr<Job>(job));
+      }
+    }
+
+   private:
+    void work() {
+      t_inParallelFor = true;
+      while (true) {
+        std::shared_ptr<Job> job = m_jobs.wait_for_one();
+        {
+          std::lock_guard<std::mutex> lock(job->mutex);
+          // the caller only waits for helpers that started before it ran out of indices or saw a failure
+          if ((job->next >= job->n) || job->failed) {
+            continue;
+          }
+          ++job->helpers;
+        }
+        job->run();
+        {
+          std::lock_guard<std::mutex> lock(job->mutex);
+          --job->helpers;
+        }
+        job->done.notify_all();
+      }
+    }
+
+    const unsigned m_numThreads;
+    ThreadSafeDeque<std::shared_ptr<Job>> m_jobs;
+  };
+
+}  // namespace
+
+void parallelFor(size_t n, const std::function<void(size_t)>& f, unsigned maxThreads) {
+  if (n == 0) {
+    return;
+  }
+
+  if (maxThreads == 0) {
+    maxThreads = std::max(System::numberOfProcessors(), 1U);
+  }
+
+  if (t_inParallelFor || (maxThreads == 1) || (n == 1)) {
+    for (size_t i = 0; i < n; ++i) {
+      f(i);
+    }
+    return;
+  }
+
+  WorkerPool& pool = WorkerPool::instance();
+  auto job = std::make_shared<Job>(n, f);
+  pool.post(job, static_cast<unsigned>(std::min<size_t>({maxThreads - 1, pool.numThreads(), n - 1})));
+
+  t_inParallelFor = true;
+  job->run();
+  t_inParallelFor = false;
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  job->done.wait(lock, [&job]() { return job->helpers == 0; });
+  if (job->error) {
+    std::rethrow_exception(job->error);
+  }
+}
+
+}  // namespace openstudio
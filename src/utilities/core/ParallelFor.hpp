@@ -0,0 +1,25 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_PARALLELFOR_HPP
+#define UTILITIES_CORE_PARALLELFOR_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <cstddef>
+#include <functional>
+
+namespace openstudio {
+
+/** Calls f(i) for each i in [0, n), handing indices out one at a time to the calling thread and to the threads of a pool that is
+ *  started on first use and kept for the life of the process, so that expensive and uneven items keep every thread busy. Returns
+ *  once all calls have returned. At most maxThreads threads, the caller included, work on the loop, 0 meaning
+ *  System::numberOfProcessors(). Calls made from within f run serially on the calling thread. If f throws, the remaining indices
+ *  are skipped and the first exception is rethrown. */
+UTILITIES_API void parallelFor(size_t n, const std::function<void(size_t)>& f, unsigned maxThreads = 0);
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_PARALLELFOR_HPP
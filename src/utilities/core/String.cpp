@@ -13,6 +13,8 @@
 #endif
 #include <codecvt>
 
+#include <fmt/format.h>
+
 #include <iomanip>
 
 namespace openstudio {
@@ -47,9 +49,9 @@ std::string toString(double v) {
     result = "NaN";
   } else {
 
-    std::stringstream ss;
-    ss << std::setprecision(std::numeric_limits<double>::digits10) << v;
-    result = ss.str();
+    // same output as streaming with std::setprecision(digits10), i.e. printf's %.15g, without the stream.
+    // fmt rather than std::to_chars, which older macOS deployment targets do not provide for doubles
+    result = fmt::format("{:.{}g}", v, std::numeric_limits<double>::digits10);
   }
 
   return result;
@@ -7,6 +7,7 @@
 #include "StringStreamLogSink_Impl.hpp"
 
 #include "Assert.hpp"
+#include "Logger.hpp"
 
 namespace openstudio {
 
@@ -25,6 +26,9 @@ namespace detail {
   }
 
   std::string StringStreamLogSink_Impl::string() const {
+    // messages may still be queued for the background writer
+    Logger::instance().flush();
+
     std::shared_lock l{m_mutex};
 
     return m_stringstream->str();
@@ -0,0 +1,85 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Logger.hpp"
+#include "../StringStreamLogSink.hpp"
+
+#include <cmath>
+#include <vector>
+
+using namespace openstudio;
+
+// Something that is not free to format, like the point lists and object dumps logged by translators
+static std::vector<double> makeValues() {
+  std::vector<double> values;
+  for (size_t i = 0; i < 32; ++i) {
+    values.push_back(std::sqrt(static_cast<double>(i)));
+  }
+  return values;
+}
+
+static void logValues(const std::vector<double>& values) {
+  LOG_FREE(Debug, "benchmark.Logger", "values = " << values[0] << ", " << values[1] << ", " << values[2] << ", " << values[31]);
+}
+
+// Debug messages when every sink only wants warnings, the message should never be formatted
+static void BM_LogDisabled(benchmark::State& state) {
+  Logger::instance().standardOutLogger().disable();
+  StringStreamLogSink sink;
+  sink.setLogLevel(Warn);
+
+  std::vector<double> values = makeValues();
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    logValues(values);
+  }
+
+  Logger::instance().standardOutLogger().enable();
+}
+
+// Debug messages that a sink accepts, written on the calling thread
+static void BM_LogEnabled(benchmark::State& state) {
+  Logger::instance().standardOutLogger().disable();
+  StringStreamLogSink sink;
+  sink.setLogLevel(Trace);
+
+  std::vector<double> values = makeValues();
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    logValues(values);
+
+    state.PauseTiming();
+    sink.resetStringStream();
+    state.ResumeTiming();
+  }
+
+  Logger::instance().standardOutLogger().enable();
+}
+
+// Same, but the sink is written by the background writer
+static void BM_LogEnabledAsynchronous(benchmark::State& state) {
+  Logger::instance().standardOutLogger().disable();
+  Logger::instance().setAsynchronous(true);
+  StringStreamLogSink sink;
+  sink.setLogLevel(Trace);
+
+  std::vector<double> values = makeValues();
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    logValues(values);
+  }
+
+  Logger::instance().setAsynchronous(false);
+  Logger::instance().standardOutLogger().enable();
+}
+
+BENCHMARK(BM_LogDisabled);
+BENCHMARK(BM_LogEnabled);
+BENCHMARK(BM_LogEnabledAsynchronous);
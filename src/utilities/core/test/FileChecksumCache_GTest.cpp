@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "CoreFixture.hpp"
+#include "../FileChecksumCache.hpp"
+#include "../Checksum.hpp"
+#include "../Filesystem.hpp"
+
+#include <ctime>
+
+using namespace openstudio;
+
+// Writes contents to p and sets its last write time secondsAgo in the past, so that the cache may remember it
+static void writeFile(const openstudio::path& p, const std::string& contents, std::time_t secondsAgo = 60) {
+  {
+    openstudio::filesystem::ofstream ofs(p, std::ios_base::trunc | std::ios_base::binary);
+    ofs << contents;
+  }
+  openstudio::filesystem::last_write_time(p, std::time(nullptr) - secondsAgo);
+}
+
+TEST_F(CoreFixture, FileChecksumCache) {
+  openstudio::path dir = openstudio::tempDir() / openstudio::toPath("FileChecksumCacheTest");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::filesystem::create_directories(dir / toPath("resources"));
+
+  std::vector<openstudio::path> paths{dir / toPath("a.txt"), dir / toPath("resources/b.txt"), dir / toPath("resources/c.txt")};
+  writeFile(paths[0], "Hi there");
+  writeFile(paths[1], "Hi there\r\nGoodbye");
+  writeFile(paths[2], std::string(100000, 'x'));
+
+  FileChecksumCache cache;
+  std::vector<std::string> checksums = cache.checksums(paths);
+  ASSERT_EQ(3u, checksums.size());
+  EXPECT_EQ("1AD514BA", checksums[0]);
+  EXPECT_EQ("17B88D3A", checksums[1]);
+  EXPECT_EQ(openstudio::checksum(paths[2]), checksums[2]);
+  EXPECT_EQ(3u, cache.size());
+  EXPECT_EQ(3u, cache.numComputed());
+
+  // Nothing changed, nothing is read
+  EXPECT_EQ(checksums, cache.checksums(paths));
+  EXPECT_EQ("1AD514BA", cache.checksum(paths[0]));
+  EXPECT_EQ(3u, cache.numComputed());
+
+  // A different size or last write time means the file is read again
+  writeFile(paths[0], "HI there", 30);
+  EXPECT_EQ("D5682D26", cache.checksum(paths[0]));
+  EXPECT_EQ(4u, cache.numComputed());
+  writeFile(paths[1], "Hi there\r\nGoodbye!", 60);
+  EXPECT_NE(checksums[1], cache.checksum(paths[1]));
+  EXPECT_EQ(5u, cache.numComputed());
+
+  // A file that was just written is not remembered, it could be written again within the same second
+  writeFile(paths[2], std::string(100000, 'y'), 0);
+  std::string justWritten = cache.checksum(paths[2]);
+  EXPECT_EQ(openstudio::checksum(paths[2]), justWritten);
+  EXPECT_EQ(justWritten, cache.checksum(paths[2]));
+  EXPECT_EQ(7u, cache.numComputed());
+  EXPECT_EQ(2u, cache.size());
+
+  // Missing files are not remembered either
+  EXPECT_EQ("00000000", cache.checksum(dir / toPath("missing.txt")));
+  EXPECT_EQ(2u, cache.size());
+
+  // Save and load, relative to the directory
+  openstudio::path cacheFile = dir / toPath(".checksums.json");
+  ASSERT_TRUE(cache.save(cacheFile, dir));
+
+  // Copy the directory elsewhere, keeping the last write times
+  openstudio::path movedDir = openstudio::tempDir() / openstudio::toPath("FileChecksumCacheTestMoved");
+  openstudio::filesystem::remove_all(movedDir);
+  openstudio::filesystem::create_directories(movedDir / toPath("resources"));
+  for (const auto& relativePath : {toPath(".checksums.json"), toPath("a.txt"), toPath("resources/b.txt"), toPath("resources/c.txt")}) {
+    openstudio::filesystem::copy_file(dir / relativePath, movedDir / relativePath);
+    openstudio::filesystem::last_write_time(movedDir / relativePath, openstudio::filesystem::last_write_time(dir / relativePath));
+  }
+
+  FileChecksumCache cache2;
+  ASSERT_TRUE(cache2.load(movedDir / toPath(".checksums.json"), movedDir));
+  EXPECT_EQ(2u, cache2.size());
+  EXPECT_EQ("D5682D26", cache2.checksum(movedDir / toPath("a.txt")));
+  EXPECT_EQ(0u, cache2.numComputed());
+
+  // Only entries under the directory are saved
+  openstudio::path resourcesCacheFile = openstudio::tempDir() / openstudio::toPath("FileChecksumCacheTest.json");
+  ASSERT_TRUE(cache2.save(resourcesCacheFile, movedDir / toPath("resources")));
+  FileChecksumCache cache3;
+  ASSERT_TRUE(cache3.load(resourcesCacheFile, movedDir / toPath("resources")));
+  EXPECT_EQ(1u, cache3.size());
+
+  EXPECT_FALSE(cache3.load(movedDir / toPath("missing.json"), movedDir));
+
+  cache3.clear();
+  EXPECT_EQ(0u, cache3.size());
+}
@@ -10,6 +10,7 @@
 #include "../StringStreamLogSink.hpp"
 
 #include <sstream>
+#include <thread>
 
 using openstudio::toPath;
 using openstudio::Logger;
@@ -316,4 +317,109 @@ TEST(LoggerTest, file_logger_disable) {
 
   EXPECT_NO_THROW(openstudio::filesystem::remove(path));
 }
+
+int formatCount = 0;
+
+std::string countFormat(const std::string& text) {
+  ++formatCount;
+  return text;
+}
+
+TEST(LoggerTest, skip_formatting_disabled_levels) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  {
+    StringStreamLogSink sink;
+    sink.setLogLevel(Warn);
+    EXPECT_TRUE(openstudio::isLogLevelEnabled(Warn));
+    EXPECT_TRUE(openstudio::isLogLevelEnabled(Error));
+
+    // other sinks may still be around and accept debug, the message must be formatted exactly when they do
+    formatCount = 0;
+    bool debugEnabled = openstudio::isLogLevelEnabled(Debug);
+    LOG_FREE(Debug, "gate.channel", countFormat("Gate Debug"));
+    EXPECT_EQ(debugEnabled ? 1 : 0, formatCount);
+
+    LOG_FREE(Error, "gate.channel", countFormat("Gate Error"));
+    EXPECT_EQ(debugEnabled ? 2 : 1, formatCount);
+
+    sink.setLogLevel(Trace);
+    EXPECT_TRUE(openstudio::isLogLevelEnabled(Trace));
+    EXPECT_TRUE(openstudio::isLogLevelEnabled(Debug));
+
+    formatCount = 0;
+    LOG_FREE(Debug, "gate.channel", countFormat("Gate Debug"));
+    EXPECT_EQ(1, formatCount);
+
+    std::vector<LogMessage> logMessages = sink.logMessages();
+    ASSERT_EQ(2u, logMessages.size());
+    EXPECT_EQ("Gate Error", logMessages[0].logMessage());
+    EXPECT_EQ("Gate Debug", logMessages[1].logMessage());
+  }
+
+  openstudio::Logger::instance().standardOutLogger().enable();
+}
+
+TEST(LoggerTest, skip_formatting_destroyed_file_sink) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  openstudio::path path = toPath("./skip_formatting_destroyed_file_sink.log");
+  openstudio::filesystem::remove(path);
+
+  {
+    FileLogSink sink(path);
+    sink.setLogLevel(Trace);
+    sink.setChannelRegex(boost::regex("gate\\.destroyed"));
+    sink.setAutoFlush(true);
+  }
+
+  // the file sink is not disabled when destroyed, it keeps writing so messages must still be formatted for it
+  EXPECT_TRUE(openstudio::isLogLevelEnabled(Trace));
+
+  formatCount = 0;
+  LOG_FREE(Trace, "gate.destroyed", countFormat("Gate Trace"));
+  EXPECT_EQ(1, formatCount);
+
+  openstudio::filesystem::ifstream ifs(path);
+  std::stringstream text;
+  text << ifs.rdbuf();
+  std::vector<LogMessage> logMessages = LogMessage::parseLogText(text.str());
+  ASSERT_EQ(1u, logMessages.size());
+  EXPECT_EQ("Gate Trace", logMessages[0].logMessage());
+
+  openstudio::Logger::instance().standardOutLogger().enable();
+}
+
+TEST(LoggerTest, asynchronous) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+  openstudio::Logger::instance().setAsynchronous(true);
+  EXPECT_TRUE(openstudio::Logger::instance().isAsynchronous());
+
+  {
+    StringStreamLogSink sink;
+    sink.setLogLevel(Trace);
+    sink.setThreadId(std::this_thread::get_id());
+
+    for (int i = 0; i < 100; ++i) {
+      LOG_FREE(Info, "async.channel", "Message " << i);
+    }
+
+    std::thread other([]() { LOG_FREE(Error, "async.channel", "Other thread"); });
+    other.join();
+
+    // logMessages waits for the background writer
+    std::vector<LogMessage> logMessages = sink.logMessages();
+    ASSERT_EQ(100u, logMessages.size());
+    for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ(Info, logMessages[i].logLevel());
+      EXPECT_EQ("async.channel", logMessages[i].logChannel());
+      EXPECT_EQ("Message " + std::to_string(i), logMessages[i].logMessage());
+    }
+  }
+
+  openstudio::Logger::instance().setAsynchronous(false);
+  EXPECT_FALSE(openstudio::Logger::instance().isAsynchronous());
+  openstudio::Logger::instance().standardOutLogger().enable();
+}
+
 }  // namespace
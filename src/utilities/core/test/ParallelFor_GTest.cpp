@@ -0,0 +1,86 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "CoreFixture.hpp"
+#include "../ParallelFor.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace openstudio;
+
+TEST_F(CoreFixture, ParallelFor) {
+  std::vector<size_t> result(1000, 0);
+  parallelFor(result.size(), [&result](size_t i) { result[i] = i * i; });
+  for (size_t i = 0; i < result.size(); ++i) {
+    EXPECT_EQ(i * i, result[i]);
+  }
+
+  size_t count = 0;
+  parallelFor(0, [&count](size_t) { ++count; });
+  EXPECT_EQ(0u, count);
+
+  // a single thread runs the indices in order
+  std::vector<size_t> order;
+  parallelFor(10, [&order](size_t i) { order.push_back(i); }, 1);
+  ASSERT_EQ(10u, order.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    EXPECT_EQ(i, order[i]);
+  }
+}
+
+TEST_F(CoreFixture, ParallelFor_Nested) {
+  // inner loops run on the thread of the outer iteration instead of waiting for the pool
+  std::vector<std::vector<size_t>> result(50, std::vector<size_t>(20, 0));
+  parallelFor(result.size(), [&result](size_t i) {
+    const std::thread::id id = std::this_thread::get_id();
+    parallelFor(result[i].size(), [&result, i, id](size_t j) {
+      EXPECT_EQ(id, std::this_thread::get_id());
+      result[i][j] = i + j;
+    });
+  });
+  for (size_t i = 0; i < result.size(); ++i) {
+    for (size_t j = 0; j < result[i].size(); ++j) {
+      EXPECT_EQ(i + j, result[i][j]);
+    }
+  }
+}
+
+TEST_F(CoreFixture, ParallelFor_Exception) {
+  std::atomic<size_t> count = 0;
+  EXPECT_THROW(parallelFor(100,
+                           [&count](size_t i) {
+                             ++count;
+                             if (i == 3) {
+                               throw std::runtime_error("failed");
+                             }
+                           }),
+               std::runtime_error);
+
+  // the pool is still usable afterwards
+  count = 0;
+  parallelFor(100, [&count](size_t) { ++count; });
+  EXPECT_EQ(100u, count.load());
+}
+
+TEST_F(CoreFixture, ParallelFor_ConcurrentCallers) {
+  std::atomic<size_t> count = 0;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&count]() {
+      for (int k = 0; k < 100; ++k) {
+        parallelFor(10, [&count](size_t) { ++count; });
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(4000u, count.load());
+}
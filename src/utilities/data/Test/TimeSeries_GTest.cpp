@@ -11,6 +11,9 @@
 #include "../../time/Date.hpp"
 #include "../../time/Time.hpp"
 
+#include <algorithm>
+#include <span>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -2095,3 +2098,128 @@ TEST_F(DataFixture, TimeSeries_value_DateTime_NoYear) {
     }
   }
 }
+
+TEST_F(DataFixture, TimeSeries_Views) {
+  Vector values = linspace(1, 24, 24);
+  TimeSeries timeSeries(DateTime(Date(MonthOfYear::Jan, 1), Time(0, 1, 0, 0)), Time(0, 1, 0, 0), values, "W");
+
+  std::span<const double> valuesView = timeSeries.valuesView();
+  ASSERT_EQ(24u, valuesView.size());
+  for (unsigned i = 0; i < 24; ++i) {
+    EXPECT_EQ(values[i], valuesView[i]);
+  }
+
+  std::vector<long> secondsFromFirstReport = timeSeries.secondsFromFirstReport();
+  std::span<const long> secondsView = timeSeries.secondsFromFirstReportView();
+  EXPECT_TRUE(std::equal(secondsView.begin(), secondsView.end(), secondsFromFirstReport.begin(), secondsFromFirstReport.end()));
+
+  // Copies share the same data
+  TimeSeries copy = timeSeries;
+  EXPECT_EQ(valuesView.data(), copy.valuesView().data());
+  EXPECT_EQ(secondsView.data(), copy.secondsFromFirstReportView().data());
+}
+
+TEST_F(DataFixture, TimeSeries_valuesAt) {
+  Vector values = linspace(1, 48, 48);
+  DateTime firstReportDateTime(Date(MonthOfYear::Jan, 1), Time(0, 1, 0, 0));
+  std::vector<DateTime> reportDateTimes;
+  for (unsigned i = 0; i < 48; ++i) {
+    reportDateTimes.push_back(firstReportDateTime + Time(0, i, 0, 0));
+  }
+
+  TimeSeries intervalTimeSeries(firstReportDateTime, Time(0, 1, 0, 0), values, "W");
+  TimeSeries detailedTimeSeries(reportDateTimes, values, "W");
+  detailedTimeSeries.setOutOfRangeValue(-99);
+
+  // Every 20 minutes from before the start to after the end, sorted then reversed
+  DateTimeVector dateTimes;
+  for (int i = -6; i < 160; ++i) {
+    dateTimes.push_back(firstReportDateTime + Time(0, 0, 20 * i, 0));
+  }
+  DateTimeVector reversedDateTimes(dateTimes.rbegin(), dateTimes.rend());
+
+  for (const TimeSeries& timeSeries : {intervalTimeSeries, detailedTimeSeries}) {
+    for (const DateTimeVector& queries : {dateTimes, reversedDateTimes}) {
+      Vector result = timeSeries.valuesAt(queries);
+      ASSERT_EQ(queries.size(), result.size());
+      for (unsigned i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(timeSeries.value(queries[i]), result[i]) << queries[i];
+      }
+    }
+  }
+
+  EXPECT_EQ(0u, detailedTimeSeries.valuesAt({}).size());
+}
+
+TEST_F(DataFixture, TimeSeries_averageValues_resample) {
+  // Hourly values over two days
+  Vector values = linspace(1, 48, 48);
+  DateTime startDateTime(Date(MonthOfYear::Jan, 1), Time(0, 0, 0, 0));
+  TimeSeries timeSeries(startDateTime + Time(0, 1, 0, 0), Time(0, 1, 0, 0), values, "W");
+  timeSeries.setOutOfRangeValue(-99);
+
+  DateTimeVector days{startDateTime, startDateTime + Time(1), startDateTime + Time(2)};
+  Vector dailyAverages = timeSeries.averageValues(days);
+  ASSERT_EQ(2u, dailyAverages.size());
+  EXPECT_DOUBLE_EQ(12.5, dailyAverages[0]);
+  EXPECT_DOUBLE_EQ(36.5, dailyAverages[1]);
+
+  // Same as averageValue over the whole series
+  Vector average = timeSeries.averageValues({startDateTime, startDateTime + Time(2)});
+  ASSERT_EQ(1u, average.size());
+  EXPECT_DOUBLE_EQ(timeSeries.averageValue(), average[0]);
+
+  // Half an hour in each of the first two values, and outside of the series
+  Vector partial = timeSeries.averageValues({startDateTime + Time(0, 0, 30, 0), startDateTime + Time(0, 1, 30, 0), startDateTime + Time(3)});
+  ASSERT_EQ(2u, partial.size());
+  EXPECT_DOUBLE_EQ(1.5, partial[0]);
+  EXPECT_DOUBLE_EQ((0.5 * 2 + (1176.0 - 1 - 2) - 99 * 24) / 70.5, partial[1]);
+
+  EXPECT_EQ(0u, timeSeries.averageValues({startDateTime}).size());
+
+  TimeSeries daily = timeSeries.resample(days);
+  ASSERT_EQ(2u, daily.values().size());
+  EXPECT_EQ("W", daily.units());
+  EXPECT_EQ(startDateTime, daily.startDateTime());
+  EXPECT_EQ(startDateTime + Time(1), daily.firstReportDateTime());
+  EXPECT_DOUBLE_EQ(12.5, daily.values(0));
+  EXPECT_DOUBLE_EQ(36.5, daily.values(1));
+  EXPECT_DOUBLE_EQ(timeSeries.integrate(), daily.integrate());
+
+  EXPECT_TRUE(timeSeries.resample({startDateTime}).values().empty());
+}
+
+TEST_F(DataFixture, TimeSeries_AddSubtractSameTimes) {
+  Vector values = linspace(1, 8760, 8760);
+  DateTime firstReportDateTime(Date(MonthOfYear::Jan, 1), Time(0, 1, 0, 0));
+  std::vector<DateTime> dateTimes;
+  for (unsigned i = 0; i < 8760; ++i) {
+    dateTimes.push_back(firstReportDateTime + Time(0, i, 0, 0));
+  }
+
+  TimeSeries intervalTimeSeries(firstReportDateTime, Time(0, 1, 0, 0), values, "W");
+  TimeSeries detailedTimeSeries(dateTimes, values, "W");
+
+  // Element by element, but built from the date times as for series reporting at different times
+  TimeSeries sum = intervalTimeSeries + 2 * intervalTimeSeries;
+  ASSERT_EQ(8760u, sum.values().size());
+  EXPECT_FALSE(sum.intervalLength());
+  EXPECT_EQ(firstReportDateTime, sum.firstReportDateTime());
+  EXPECT_EQ(detailedTimeSeries.startDateTime(), sum.startDateTime());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(3 * values[i], sum.values(i));
+  }
+
+  TimeSeries diff = intervalTimeSeries - detailedTimeSeries;
+  ASSERT_EQ(8760u, diff.values().size());
+  EXPECT_FALSE(diff.intervalLength());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(0.0, diff.values(i));
+  }
+
+  // Different times still report at the times of both series
+  TimeSeries shifted(firstReportDateTime + Time(0, 0, 30, 0), Time(0, 1, 0, 0), values, "W");
+  TimeSeries mixed = intervalTimeSeries + shifted;
+  EXPECT_EQ(2 * 8760u, mixed.values().size());
+  EXPECT_EQ(intervalTimeSeries.value(dateTimes[10]) + shifted.value(dateTimes[10]), mixed.value(dateTimes[10]));
+}
@@ -6,6 +6,10 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
 using namespace std;
 using namespace boost;
 
@@ -480,6 +484,10 @@ namespace detail {
     return value;
   }
 
+  std::span<const long> TimeSeries_Impl::secondsFromFirstReportView() const {
+    return {m_secondsFromFirstReport.data(), m_secondsFromFirstReport.size()};
+  }
+
   /// values
   Vector TimeSeries_Impl::values() const {
     return m_values;
@@ -494,6 +502,10 @@ namespace detail {
     return value;
   }
 
+  std::span<const double> TimeSeries_Impl::valuesView() const {
+    return {m_values.data().begin(), m_values.size()};
+  }
+
   /// units
   const std::string TimeSeries_Impl::units() const {
     return m_units;
@@ -572,6 +584,51 @@ namespace detail {
     return result;
   }
 
+  /// get values at numbers of seconds from start date and time
+  Vector TimeSeries_Impl::valuesAtSecondsFromFirstReport(const std::vector<long>& secondsFromFirstReport) const {
+    Vector result(secondsFromFirstReport.size());
+
+    if (m_intervalLength || m_secondsFromFirstReport.empty()) {
+      // already a constant time look up
+      for (unsigned i = 0; i < secondsFromFirstReport.size(); ++i) {
+        result[i] = valueAtSecondsFromFirstReport(secondsFromFirstReport[i]);
+      }
+      return result;
+    }
+
+    // same as interp with HoldNextInterp, walking forward through the series as long as the times are increasing
+    const long duration = m_secondsFromFirstReport.back();
+    auto begin = m_secondsFromFirstReport.cbegin();
+    auto it = begin;
+    long previous = std::numeric_limits<long>::min();
+    for (unsigned i = 0; i < secondsFromFirstReport.size(); ++i) {
+      const long seconds = secondsFromFirstReport[i];
+      if ((seconds < 0) || (seconds > duration)) {
+        result[i] = m_outOfRangeValue;
+        continue;
+      }
+      if (seconds == m_secondsFromFirstReport.front()) {
+        result[i] = m_values[0];
+        continue;
+      }
+      if (seconds == duration) {
+        result[i] = m_values[m_values.size() - 1];
+        continue;
+      }
+      if (seconds < previous) {
+        it = std::lower_bound(begin, m_secondsFromFirstReport.cend(), seconds);
+      } else {
+        while (*it < seconds) {
+          ++it;
+        }
+      }
+      previous = seconds;
+      result[i] = m_values[it - begin];
+    }
+
+    return result;
+  }
+
   /// get value at number of days from start date
   double TimeSeries_Impl::value(double daysFromFirstReport) const {
     return valueAtSecondsFromFirstReport(Time(daysFromFirstReport).totalSeconds());
@@ -582,42 +639,119 @@ namespace detail {
     return valueAtSecondsFromFirstReport(timeFromFirstReport.totalSeconds());
   }
 
-  /// get value at date and time
-  double TimeSeries_Impl::value(const DateTime& dateTime) const {
-    boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-
+  DateTime TimeSeries_Impl::firstReportDateTimeWithYear() const {
     // If our timeseries doesn't have a year, we force it to the assumed one
-    DateTime firstReportDateTimeWithYear = m_firstReportDateTime;
-    int timeSeriesYear = m_firstReportDateTime.date().year();
-    if (!calendarYear) {
-      firstReportDateTimeWithYear = DateTime(
-        Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), timeSeriesYear), m_firstReportDateTime.time());
+    if (!m_firstReportDateTime.date().baseYear()) {
+      return {Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()),
+              m_firstReportDateTime.time()};
     }
+    return m_firstReportDateTime;
+  }
 
+  long TimeSeries_Impl::toSecondsFromFirstReport(const DateTime& dateTime, const DateTime& firstReportDateTimeWithYear, bool periodBoundary) const {
     // If our requested datetime doesn't have an assigned year, we default to the one of the **TimeSeries** (whether hard assigned or not)
     // Or the one right after in case it ends up before the start (try wrap-around)
-    DateTime dateTimeWithYear = dateTime;
-    if (!dateTimeWithYear.date().baseYear()) {
-      // Starts by assuming same year as timeseries, then use that to compare, and if before, then assume wrap-around
-      // Even if it doesn't really wrap-around, it'll just return nothing so it's fine
-      // (and valueAtSecondsFromFirstReport will also add Debug message)
-      dateTimeWithYear = DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth(), timeSeriesYear), dateTime.time());
+    if (dateTime.date().baseYear()) {
+      return (dateTime - firstReportDateTimeWithYear).totalSeconds();
+    }
 
-      int secondsFromFirstReport = (dateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
+    // Starts by assuming same year as timeseries, then use that to compare, and if before, then assume wrap-around
+    // Even if it doesn't really wrap-around, it'll just return nothing so it's fine
+    // (and valueAtSecondsFromFirstReport will also add Debug message)
+    const int timeSeriesYear = m_firstReportDateTime.date().year();
+    DateTime dateTimeWithYear(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth(), timeSeriesYear), dateTime.time());
+
+    long secondsFromFirstReport = (dateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
+
+    // If it's negative, then: if m_intervalLength exist we check that it's even bigger than intervalLength,
+    // in which case we do shift to next year, otherwise we do nothing
+    // This allows passing "2005-01-01 00:01:00" to report at "2005-01-01 01:00:00" (historical behavior)
+    // cf valueAtSecondsFromFirstReport which will allow it
+    // The start of a period to average over may go back to the start of the series
+    long earliestSecondsFromFirstReport = 0;
+    if (periodBoundary) {
+      earliestSecondsFromFirstReport = m_secondsFromStart.empty() ? 0 : -m_secondsFromStart[0];
+    } else if (m_intervalLength) {
+      earliestSecondsFromFirstReport = 1 - m_intervalLength->totalSeconds();
+    }
+    if (secondsFromFirstReport < earliestSecondsFromFirstReport) {
+      dateTimeWithYear = DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth(), timeSeriesYear + 1), dateTime.time());
+      secondsFromFirstReport = (dateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
+    }
 
-      // If it's negative, then: if m_intervalLength exist we check that it's even bigger than intervalLength,
-      // in which case we do shift to next year, otherwise we do nothing
-      // This allows passing "2005-01-01 00:01:00" to report at "2005-01-01 01:00:00" (historical behavior)
-      // cf valueAtSecondsFromFirstReport which will allow it
-      if (secondsFromFirstReport < 0 && (!m_intervalLength || secondsFromFirstReport <= -m_intervalLength->totalSeconds())) {
-        dateTimeWithYear = DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth(), timeSeriesYear + 1), dateTime.time());
-      }
+    return secondsFromFirstReport;
+  }
+
+  std::vector<long> TimeSeries_Impl::toSecondsFromFirstReport(const DateTimeVector& dateTimes, bool periodBoundaries) const {
+    const DateTime firstReportWithYear = firstReportDateTimeWithYear();
+    std::vector<long> result;
+    result.reserve(dateTimes.size());
+    for (const DateTime& dateTime : dateTimes) {
+      result.push_back(toSecondsFromFirstReport(dateTime, firstReportWithYear, periodBoundaries));
     }
+    return result;
+  }
 
+  /// get value at date and time
+  double TimeSeries_Impl::value(const DateTime& dateTime) const {
     LOG(Debug, "Initial: dateTime=" << dateTime << ", m_firstReportDateTime=" << m_firstReportDateTime);
-    LOG(Debug, "Querying with dateTimeWithYear=" << dateTimeWithYear << ", firstReportDateTimeWithYear=" << firstReportDateTimeWithYear);
 
-    return value(dateTimeWithYear - firstReportDateTimeWithYear);
+    return valueAtSecondsFromFirstReport(toSecondsFromFirstReport(dateTime, firstReportDateTimeWithYear()));
+  }
+
+  /// get values at date and times
+  Vector TimeSeries_Impl::valuesAt(const DateTimeVector& dateTimes) const {
+    return valuesAtSecondsFromFirstReport(toSecondsFromFirstReport(dateTimes));
+  }
+
+  /// get time weighted averages between consecutive date times
+  Vector TimeSeries_Impl::averageValues(const DateTimeVector& dateTimes) const {
+    if (dateTimes.size() < 2) {
+      return {};
+    }
+
+    const std::vector<long> secondsFromFirstReport = toSecondsFromFirstReport(dateTimes, true);
+
+    // integral of the series from its start, each value holds from the previous report (or the start) to its own
+    const unsigned numValues = m_values.size();
+    const long start = m_secondsFromStart.empty() ? 0 : -m_secondsFromStart[0];
+    const long end = m_secondsFromFirstReport.empty() ? 0 : m_secondsFromFirstReport.back();
+    unsigned index = 0;
+    double integralBeforeIndex = 0.0;
+    auto integralTo = [&](long seconds) -> double {
+      if ((numValues == 0) || (seconds <= start)) {
+        return (seconds - start) * m_outOfRangeValue;
+      }
+      auto intervalBegin = [&](unsigned i) { return (i == 0) ? start : m_secondsFromFirstReport[i - 1]; };
+      if (seconds < intervalBegin(index)) {
+        // not sorted, start over
+        index = 0;
+        integralBeforeIndex = 0.0;
+      }
+      while ((index < numValues) && (m_secondsFromFirstReport[index] < seconds)) {
+        integralBeforeIndex += (m_secondsFromFirstReport[index] - intervalBegin(index)) * m_values[index];
+        ++index;
+      }
+      if (index == numValues) {
+        return integralBeforeIndex + (seconds - end) * m_outOfRangeValue;
+      }
+      return integralBeforeIndex + (seconds - intervalBegin(index)) * m_values[index];
+    };
+
+    Vector result(dateTimes.size() - 1);
+    double previousIntegral = integralTo(secondsFromFirstReport[0]);
+    for (unsigned i = 1; i < secondsFromFirstReport.size(); ++i) {
+      const double integral = integralTo(secondsFromFirstReport[i]);
+      const long duration = secondsFromFirstReport[i] - secondsFromFirstReport[i - 1];
+      if (duration == 0) {
+        result[i - 1] = valueAtSecondsFromFirstReport(secondsFromFirstReport[i]);
+      } else {
+        result[i - 1] = (integral - previousIntegral) / duration;
+      }
+      previousIntegral = integral;
+    }
+
+    return result;
   }
 
   /// get values between start and end date times
@@ -700,80 +834,73 @@ namespace detail {
     m_outOfRangeValue = value;
   }
 
-  /// add timeseries
-  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Impl& other) const {
-    std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
-
-    // if same units
-    if (m_units == other.units()) {
-
-      // make unique, ordered set of all date times
-      std::set<DateTime> dateTimesSet;
-      DateTimeVector dateTimes1 = dateTimes();
-      DateTimeVector dateTimes2 = other.dateTimes();
-      dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-      dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
-
-      // create vector out of set
-      DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
-
-      // compute value at each date time
-      Vector values(dateTimesSet.size());
-      unsigned valueIndex = 0;
-      for (const DateTime& dt : dateTimes) {
-        values[valueIndex] = value(dt) + other.value(dt);
-
-        LOG(Debug, "At '" << dt << "' " << value(dt) << " + " << other.value(dt) << " = " << values[valueIndex]);
+  bool TimeSeries_Impl::hasSameTimes(const TimeSeries_Impl& other) const {
+    return (m_firstReportDateTime == other.m_firstReportDateTime) && (m_startDateTime == other.m_startDateTime) && (m_wrapAround == other.m_wrapAround)
+           && (m_secondsFromFirstReport == other.m_secondsFromFirstReport) && (m_secondsFromStart == other.m_secondsFromStart)
+           && (m_values.size() == other.m_values.size());
+  }
 
-        ++valueIndex;
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::combine(const TimeSeries_Impl& other, bool subtract) const {
+    if (!m_wrapAround && hasSameTimes(other)
+        && (std::adjacent_find(m_secondsFromFirstReport.begin(), m_secondsFromFirstReport.end(), std::greater_equal<>())
+            == m_secondsFromFirstReport.end())) {
+      // the merged date times below would be our own, no need to look the values up
+      Vector values = m_values;
+      if (subtract) {
+        values -= other.m_values;
+      } else {
+        values += other.m_values;
       }
+      return std::make_shared<TimeSeries_Impl>(dateTimes(), values, m_units);
+    }
 
-      // make new result
-      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+    // make unique, ordered vector of all date times
+    DateTimeVector dateTimes1 = dateTimes();
+    DateTimeVector dateTimes2 = other.dateTimes();
+    DateTimeVector dateTimes;
+    dateTimes.reserve(dateTimes1.size() + dateTimes2.size());
+    if (std::is_sorted(dateTimes1.begin(), dateTimes1.end()) && std::is_sorted(dateTimes2.begin(), dateTimes2.end())) {
+      std::merge(dateTimes1.begin(), dateTimes1.end(), dateTimes2.begin(), dateTimes2.end(), std::back_inserter(dateTimes));
+    } else {
+      dateTimes.insert(dateTimes.end(), dateTimes1.begin(), dateTimes1.end());
+      dateTimes.insert(dateTimes.end(), dateTimes2.begin(), dateTimes2.end());
+      std::sort(dateTimes.begin(), dateTimes.end());
+    }
+    dateTimes.erase(std::unique(dateTimes.begin(), dateTimes.end(), [](const DateTime& a, const DateTime& b) { return !(a < b) && !(b < a); }),
+                    dateTimes.end());
 
+    // compute value at each date time
+    Vector values = valuesAt(dateTimes);
+    if (subtract) {
+      values -= other.valuesAt(dateTimes);
     } else {
-      LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
+      values += other.valuesAt(dateTimes);
     }
 
-    return result;
+    // make new result
+    return std::make_shared<TimeSeries_Impl>(dateTimes, values, m_units);
   }
 
-  /// subtract timeseries
-  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Impl& other) const {
-    std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
-
+  /// add timeseries
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Impl& other) const {
     // if same units
     if (m_units == other.units()) {
+      return combine(other, false);
+    }
 
-      // make unique, ordered set of all date times
-      std::set<DateTime> dateTimesSet;
-      DateTimeVector dateTimes1 = dateTimes();
-      DateTimeVector dateTimes2 = other.dateTimes();
-      dateTimesSet.insert(dateTimes1.begin(), dateTimes1.end());
-      dateTimesSet.insert(dateTimes2.begin(), dateTimes2.end());
-
-      // create vector out of set
-      DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
-
-      // compute value at each date time
-      Vector values(dateTimesSet.size());
-      unsigned valueIndex = 0;
-      for (const DateTime& dt : dateTimes) {
-        values[valueIndex] = value(dt) - other.value(dt);
-
-        LOG(Debug, "At '" << dt << "' " << value(dt) << " - " << other.value(dt) << " = " << values[valueIndex]);
-
-        ++valueIndex;
-      }
-
-      // make new result
-      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+    LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
+    return std::make_shared<TimeSeries_Impl>();
+  }
 
-    } else {
-      LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+  /// subtract timeseries
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Impl& other) const {
+    // if same units
+    if (m_units == other.units()) {
+      return combine(other, true);
     }
 
-    return result;
+    LOG(Warn, "Subtracting timeseries with different units returns an empty timeseries");
+    return std::make_shared<TimeSeries_Impl>();
   }
 
   std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
@@ -864,6 +991,10 @@ long TimeSeries::secondsFromFirstReport(unsigned int i) const {
   return m_impl->secondsFromFirstReport(i);
 }
 
+std::span<const long> TimeSeries::secondsFromFirstReportView() const {
+  return m_impl->secondsFromFirstReportView();
+}
+
 openstudio::Vector TimeSeries::values() const {
   return m_impl->values();
 }
@@ -872,6 +1003,10 @@ double TimeSeries::values(unsigned int i) const {
   return m_impl->values(i);
 }
 
+std::span<const double> TimeSeries::valuesView() const {
+  return m_impl->valuesView();
+}
+
 const std::string TimeSeries::units() const {
   return m_impl->units();
 }
@@ -892,6 +1027,22 @@ Vector TimeSeries::values(const DateTime& startDateTime, const DateTime& endDate
   return m_impl->values(startDateTime, endDateTime);
 }
 
+Vector TimeSeries::valuesAt(const DateTimeVector& dateTimes) const {
+  return m_impl->valuesAt(dateTimes);
+}
+
+Vector TimeSeries::averageValues(const DateTimeVector& dateTimes) const {
+  return m_impl->averageValues(dateTimes);
+}
+
+TimeSeries TimeSeries::resample(const DateTimeVector& dateTimes) const {
+  if (dateTimes.size() < 2) {
+    LOG(Warn, "Cannot resample a timeseries on less than two date times");
+    return {};
+  }
+  return {dateTimes, averageValues(dateTimes), units()};
+}
+
 double TimeSeries::outOfRangeValue() const {
   return m_impl->outOfRangeValue();
 }
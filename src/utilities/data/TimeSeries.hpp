@@ -16,6 +16,7 @@
 #include <boost/optional.hpp>
 #include <boost/function.hpp>
 
+#include <span>
 #include <vector>
 
 namespace openstudio {
@@ -58,14 +59,20 @@ namespace detail {
 
     long secondsFromFirstReport(unsigned int i) const;
 
+    std::span<const long> secondsFromFirstReportView() const;
+
     openstudio::Vector values() const;
 
     double values(unsigned int i) const;
 
+    std::span<const double> valuesView() const;
+
     const std::string units() const;
 
     double valueAtSecondsFromFirstReport(long secondsFromFirstReport) const;
 
+    Vector valuesAtSecondsFromFirstReport(const std::vector<long>& secondsFromFirstReport) const;
+
     double value(double daysFromFirstReport) const;
 
     double value(const Time& timeFromFirstReport) const;
@@ -74,6 +81,10 @@ namespace detail {
 
     Vector values(const DateTime& startDateTime, const DateTime& endDateTime) const;
 
+    Vector valuesAt(const DateTimeVector& dateTimes) const;
+
+    Vector averageValues(const DateTimeVector& dateTimes) const;
+
     double outOfRangeValue() const;
 
     void setOutOfRangeValue(double value);
@@ -90,6 +101,23 @@ namespace detail {
 
    private:
     REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+    // m_firstReportDateTime, in the assumed year if it does not have one
+    DateTime firstReportDateTimeWithYear() const;
+
+    // seconds from first report of dateTime, which is given the year of the series (or the next one) if it does not have one.
+    // A dateTime that bounds an averaging period may fall on the start of the series without being moved to the next year
+    long toSecondsFromFirstReport(const DateTime& dateTime, const DateTime& firstReportDateTimeWithYear, bool periodBoundary = false) const;
+
+    std::vector<long> toSecondsFromFirstReport(const DateTimeVector& dateTimes, bool periodBoundaries = false) const;
+
+    // true if other reports at the same times, so that values can be combined index by index
+    bool hasSameTimes(const TimeSeries_Impl& other) const;
+
+    // sums or subtracts other at the union of both report times, element by element when both report at the same
+    // increasing times. Either way the result is built from its date times, so it has no interval length
+    std::shared_ptr<TimeSeries_Impl> combine(const TimeSeries_Impl& other, bool subtract) const;
+
     // fully qualified first report date
     DateTime m_firstReportDateTime;
 
@@ -222,12 +250,20 @@ class UTILITIES_API TimeSeries
   /// Return the time in seconds from end of the first reporting interval at index i to prevent implicit vector copy for single value
   long secondsFromFirstReport(unsigned int i) const;
 
+  /** Returns a read-only view of the time in seconds from end of the first reporting interval, without copying it.
+   *  The view is valid as long as this TimeSeries or a copy of it exists. */
+  std::span<const long> secondsFromFirstReportView() const;
+
   /// Returns the values vector
   openstudio::Vector values() const;
 
   /// Returns the value at index i to prevent implicit vector copy for single value
   double values(unsigned int i) const;
 
+  /** Returns a read-only view of the values, without copying them.
+   *  The view is valid as long as this TimeSeries or a copy of it exists. */
+  std::span<const double> valuesView() const;
+
   /// Returns the series units as a standard string
   const std::string units() const;
 
@@ -243,6 +279,19 @@ class UTILITIES_API TimeSeries
   /// Get values between start and end date times
   Vector values(const DateTime& startDateTime, const DateTime& endDateTime) const;
 
+  /** Get value at each date and time, same as calling value(const DateTime&) for each of them.
+   *  Sorted date times are looked up in a single pass over the series. */
+  Vector valuesAt(const DateTimeVector& dateTimes) const;
+
+  /** Get the time weighted average of the series over each interval between consecutive date times, dateTimes.size() - 1 values.
+   *  Each reported value holds over its whole reporting interval, as in integrate(), and times outside of the series count as
+   *  outOfRangeValue. Sorted date times are looked up in a single pass over the series. */
+  Vector averageValues(const DateTimeVector& dateTimes) const;
+
+  /** Resample the series on the intervals between consecutive date times, using averageValues. dateTimes.front() is the start
+   *  of the returned series. Returns an empty series if there are less than two date times. */
+  TimeSeries resample(const DateTimeVector& dateTimes) const;
+
   /// Get the value used for out of range data
   double outOfRangeValue() const;
 
@@ -257,7 +306,8 @@ class UTILITIES_API TimeSeries
   /** @name Operators */
   //@{
 
-  /// Add timeseries
+  /** Add timeseries, values are added element by element if both series report at the same times, otherwise the result
+   *  reports at the times of both series. */
   TimeSeries operator+(const TimeSeries& other) const;
 
   /// Subtract timeseries
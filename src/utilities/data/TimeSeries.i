@@ -11,6 +11,10 @@
 
 %ignore openstudio::detail;
 
+// std::span is not wrapped, use values and secondsFromFirstReport instead
+%ignore openstudio::TimeSeries::valuesView;
+%ignore openstudio::TimeSeries::secondsFromFirstReportView;
+
 %template(TimeSeriesPtr) std::shared_ptr<openstudio::TimeSeries>;
 
 // create an instantiation of the optional class
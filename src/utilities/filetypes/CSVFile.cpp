@@ -13,26 +13,143 @@
 #include "../data/Vector.hpp"
 #include "../time/DateTime.hpp"
 
+#include <algorithm>
 #include <iostream>
-
-#include <boost/regex.hpp>
+#include <string_view>
 
 namespace openstudio {
 namespace detail {
 
-  CSVFile_Impl::CSVFile_Impl() : m_numColumns(0) {}
+  namespace {
+
+    // matches ^[-0-9]+$
+    bool isIntegerString(std::string_view value) {
+      return !value.empty() && std::all_of(value.begin(), value.end(), [](char c) { return (c == '-') || ((c >= '0') && (c <= '9')); });
+    }
+
+    // matches ^[+-]?\d+\.?(\d+)?$
+    bool isDoubleString(std::string_view value) {
+      size_t i = 0;
+      const size_t n = value.size();
+      if ((i < n) && ((value[i] == '+') || (value[i] == '-'))) {
+        ++i;
+      }
+      const size_t digitsStart = i;
+      while ((i < n) && (value[i] >= '0') && (value[i] <= '9')) {
+        ++i;
+      }
+      if (i == digitsStart) {
+        return false;
+      }
+      if ((i < n) && (value[i] == '.')) {
+        ++i;
+      }
+      while ((i < n) && (value[i] >= '0') && (value[i] <= '9')) {
+        ++i;
+      }
+      return i == n;
+    }
+
+    // splits an Excel formatted CSV line on commas that are not inside quotes, quotes are kept
+    void splitLine(std::string_view line, std::vector<std::string_view>& fields) {
+      fields.clear();
+      bool inQuotes = false;
+      size_t start = 0;
+      for (size_t i = 0; i < line.size(); ++i) {
+        if (line[i] == '"') {
+          inQuotes = !inQuotes;
+        } else if ((line[i] == ',') && !inQuotes) {
+          fields.push_back(line.substr(start, i - start));
+          start = i + 1;
+        }
+      }
+      fields.push_back(line.substr(start));
+    }
+
+    void writeString(std::ostream& os, const std::string& s) {
+      if (s == ",") {
+        os << "\"" << s << "\"";
+      } else {
+        os << s;
+      }
+    }
+
+  }  // namespace
+
+  void CSVFile_Impl::Column::appendEmpty(unsigned n) {
+    types.insert(types.end(), n, CellType::Empty);
+    numbers.insert(numbers.end(), n, 0.0);
+  }
+
+  void CSVFile_Impl::Column::appendNumber(CellType type, double value) {
+    types.push_back(type);
+    numbers.push_back(value);
+  }
+
+  void CSVFile_Impl::Column::appendString(std::string value) {
+    if (value.empty()) {
+      appendEmpty();
+      return;
+    }
+    strings.emplace_back(static_cast<unsigned>(types.size()), std::move(value));
+    types.push_back(CellType::String);
+    numbers.push_back(0.0);
+  }
+
+  void CSVFile_Impl::Column::append(const Variant& value) {
+    switch (value.variantType().value()) {
+      case VariantType::Boolean:
+        appendNumber(CellType::Boolean, value.valueAsBoolean() ? 1.0 : 0.0);
+        break;
+      case VariantType::Integer:
+        appendNumber(CellType::Integer, value.valueAsInteger());
+        break;
+      case VariantType::Double:
+        appendNumber(CellType::Double, value.valueAsDouble());
+        break;
+      case VariantType::String:
+        appendString(value.valueAsString());
+        break;
+      default:
+        OS_ASSERT(false);
+    }
+  }
+
+  const std::string& CSVFile_Impl::Column::stringAt(unsigned row) const {
+    static const std::string empty;
+    auto it = std::lower_bound(strings.begin(), strings.end(), row, [](const auto& cell, unsigned r) { return cell.first < r; });
+    if ((it != strings.end()) && (it->first == row)) {
+      return it->second;
+    }
+    return empty;
+  }
+
+  Variant CSVFile_Impl::Column::variantAt(unsigned row) const {
+    switch (types[row]) {
+      case CellType::Boolean:
+        return Variant(numbers[row] != 0.0);
+      case CellType::Integer:
+        return Variant(static_cast<int>(numbers[row]));
+      case CellType::Double:
+        return Variant(numbers[row]);
+      case CellType::String:
+        return Variant(stringAt(row));
+      default:
+        break;
+    }
+    return Variant("");
+  }
 
-  CSVFile_Impl::CSVFile_Impl(const std::string& s) {
+  CSVFile_Impl::CSVFile_Impl() : m_numRows(0) {}
+
+  CSVFile_Impl::CSVFile_Impl(const std::string& s) : m_numRows(0) {
     std::istringstream ss(s);
 
     // will throw on error
-    m_rows = parseRows(ss);
-
-    assignNumColumns();
-    padRows();
+    parse(ss);
   }
 
-  CSVFile_Impl::CSVFile_Impl(const openstudio::path& p) {
+  CSVFile_Impl::CSVFile_Impl(const openstudio::path& p) : m_numRows(0) {
     if (!boost::filesystem::exists(p) || !boost::filesystem::is_regular_file(p)) {
       LOG_AND_THROW("Path '" << p << "' is not a CSVFile file");
     }
@@ -41,11 +158,9 @@ namespace detail {
     std::ifstream ifs(openstudio::toSystemFilename(p));
 
     // will throw on error
-    m_rows = parseRows(ifs);
+    parse(ifs);
 
     m_path = p;
-    assignNumColumns();
-    padRows();
   }
 
   CSVFile CSVFile_Impl::clone() const {
@@ -58,40 +173,38 @@ namespace detail {
   }
 
   std::string CSVFile_Impl::string() const {
-    static const boost::regex escapeItRegex(",");
-
-    std::string s;
     std::stringstream result;
-    for (const auto& row : m_rows) {
-      OS_ASSERT(row.size() == m_numColumns);
-      for (size_t i = 0; i < m_numColumns; ++i) {
+    write(result);
+    return result.str();
+  }
 
-        switch (row[i].variantType().value()) {
-          case VariantType::Integer:
-            result << row[i].valueAsInteger();
+  void CSVFile_Impl::write(std::ostream& os) const {
+    const size_t numColumns = m_columns.size();
+    for (unsigned row = 0; row < m_numRows; ++row) {
+      for (size_t i = 0; i < numColumns; ++i) {
+        const Column& column = m_columns[i];
+        OS_ASSERT(column.types.size() == m_numRows);
+
+        switch (column.types[row]) {
+          case CellType::Integer:
+            os << static_cast<int>(column.numbers[row]);
             break;
-          case VariantType::Double:
-            result << row[i].valueAsDouble();
+          case CellType::Double:
+            os << column.numbers[row];
             break;
-          case VariantType::String:
-            s = row[i].valueAsString();
-            if (boost::regex_match(s, escapeItRegex)) {
-              result << "\"" << s << "\"";
-            } else {
-              result << s;
-            }
+          case CellType::String:
+            writeString(os, column.stringAt(row));
             break;
           default:
             break;
         }
 
-        if (i < m_numColumns - 1) {
-          result << ",";
+        if (i < numColumns - 1) {
+          os << ",";
         }
       }
-      result << "\n";
+      os << "\n";
     }
-    return result.str();
   }
 
   bool CSVFile_Impl::save() const {
@@ -105,7 +218,7 @@ namespace detail {
 
       if (outFile) {
         try {
-          outFile << string();
+          write(outFile);
           outFile.close();
           return true;
         } catch (...) {
@@ -139,124 +252,122 @@ namespace detail {
   }
 
   unsigned CSVFile_Impl::numColumns() const {
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::numRows() const {
-    return m_rows.size();
+    return m_numRows;
   }
 
   std::vector<std::vector<Variant>> CSVFile_Impl::rows() const {
-    return m_rows;
+    std::vector<std::vector<Variant>> result(m_numRows);
+    for (unsigned row = 0; row < m_numRows; ++row) {
+      result[row].reserve(m_columns.size());
+      for (const auto& column : m_columns) {
+        result[row].push_back(column.variantAt(row));
+      }
+    }
+    return result;
   }
 
   void CSVFile_Impl::addRow(const std::vector<Variant>& row) {
-    m_rows.push_back(row);
-    if (row.size() > m_numColumns) {
-      m_numColumns = row.size();
-      padRows();
+    while (m_columns.size() < row.size()) {
+      newColumn();
     }
 
-    while (m_rows[m_rows.size() - 1].size() < m_numColumns) {
-      m_rows[m_rows.size() - 1].push_back(Variant(""));
+    for (size_t i = 0; i < m_columns.size(); ++i) {
+      if (i < row.size()) {
+        m_columns[i].append(row[i]);
+      } else {
+        m_columns[i].appendEmpty();
+      }
     }
+    ++m_numRows;
   }
 
   void CSVFile_Impl::setRows(const std::vector<std::vector<Variant>>& rows) {
-    m_rows = rows;
-    assignNumColumns();
+    m_columns.clear();
+    m_numRows = 0;
+    for (const auto& row : rows) {
+      addRow(row);
+    }
   }
 
   void CSVFile_Impl::clear() {
-    m_rows.clear();
+    m_columns.clear();
     m_path.reset();
-    m_numColumns = 0;
+    m_numRows = 0;
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<DateTime>& dateTimes) {
     unsigned n = dateTimes.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(dateTimes[i].toISO8601()));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column& column = m_columns.emplace_back();
+    column.strings.reserve(n);
+    for (const auto& dateTime : dateTimes) {
+      column.appendString(dateTime.toISO8601());
     }
+    column.appendEmpty(m_numRows - n);
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const Vector& values) {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
-    }
+    Column& column = m_columns.emplace_back();
+    column.types.assign(n, CellType::Double);
+    column.numbers.assign(values.begin(), values.end());
+    column.appendEmpty(m_numRows - n);
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<double>& values) {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
-    }
+    Column& column = m_columns.emplace_back();
+    column.types.assign(n, CellType::Double);
+    column.numbers.assign(values.begin(), values.end());
+    column.appendEmpty(m_numRows - n);
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<std::string>& values) {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column& column = m_columns.emplace_back();
+    for (const auto& value : values) {
+      column.appendString(value);
     }
+    column.appendEmpty(m_numRows - n);
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   std::vector<DateTime> CSVFile_Impl::getColumnAsDateTimes(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return {};
     }
 
+    const Column& column = m_columns[columnIndex];
+
     std::vector<DateTime> result;
+    result.reserve(m_numRows);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (m_rows[i][columnIndex].variantType() != VariantType::String) {
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if ((column.types[i] != CellType::String) && (column.types[i] != CellType::Empty)) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return {};
       }
 
-      boost::optional<DateTime> dateTime = DateTime::fromISO8601(m_rows[i][columnIndex].valueAsString());
+      boost::optional<DateTime> dateTime = DateTime::fromISO8601(column.stringAt(i));
       if (!dateTime) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return {};
@@ -268,53 +379,45 @@ namespace detail {
   }
 
   std::vector<double> CSVFile_Impl::getColumnAsDoubleVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return {};
     }
 
-    std::vector<double> result;
-
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
+    const Column& column = m_columns[columnIndex];
 
-      boost::optional<double> value;
-      if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
-        value = m_rows[i][columnIndex].valueAsDouble();
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
-        value = m_rows[i][columnIndex].valueAsInteger();
-      }
-
-      if (!value) {
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if ((column.types[i] != CellType::Double) && (column.types[i] != CellType::Integer)) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a numeric value");
         return {};
       }
-      result.push_back(*value);
     }
 
-    return result;
+    return column.numbers;
   }
 
   std::vector<std::string> CSVFile_Impl::getColumnAsStringVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return {};
     }
 
+    const Column& column = m_columns[columnIndex];
+
     std::vector<std::string> result;
+    result.reserve(m_numRows);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
+    for (unsigned i = 0; i < m_numRows; ++i) {
 
-      if (m_rows[i][columnIndex].variantType() == VariantType::String) {
-        result.push_back(m_rows[i][columnIndex].valueAsString());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
+      if ((column.types[i] == CellType::String) || (column.types[i] == CellType::Empty)) {
+        result.push_back(column.stringAt(i));
+      } else if (column.types[i] == CellType::Double) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsDouble();
+        ss << column.numbers[i];
         result.push_back(ss.str());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
+      } else if (column.types[i] == CellType::Integer) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsInteger();
+        ss << static_cast<int>(column.numbers[i]);
         result.push_back(ss.str());
       }
     }
@@ -323,70 +426,60 @@ namespace detail {
   }
 
   // throws on error
-  std::vector<std::vector<Variant>> CSVFile_Impl::parseRows(std::istream& input) {
-    std::vector<std::vector<Variant>> result;
-
+  void CSVFile_Impl::parse(std::istream& input) {
     // DLM: what conditions should make this throw?
 
-    // Excel formated CSV regex, \A[^,"]*(?=,)|(?:[^",]*"[^"]*"[^",]*)+|[^",]*"[^"]*\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\Z|\A[^,]*\Z
-    static const boost::regex csvRegex(
-      "\\A[^,\"]*(?=,)|(?:[^\",]*\"[^\"]*\"[^\",]*)+|[^\",]*\"[^\"]*\\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\\Z|\\A[^,]*\\Z");
-    static const boost::regex intRegex("^[-0-9]+$");
-    static const boost::regex doubleRegex("^[+-]?\\d+\\.?(\\d+)?$");
-    static const boost::regex quoteRegex("^\"(.*)\"$");
-
     std::string line;
+    std::vector<std::string_view> fields;
     while (std::getline(input, line)) {
-      std::vector<Variant> row;
-      boost::regex_token_iterator<std::string::iterator> it{line.begin(), line.end(), csvRegex, 0};
-      boost::regex_token_iterator<std::string::iterator> end;
-      while (it != end) {
-        std::string value = *it;
-        if (boost::regex_match(value, intRegex)) {
-          row.push_back(Variant(std::stoi(value)));
-        } else if (boost::regex_match(value, doubleRegex)) {
-          row.push_back(Variant(std::stod(value)));
+      std::string_view lineView(line);
+      if (!lineView.empty() && (lineView.back() == '\r')) {
+        lineView.remove_suffix(1);
+      }
+
+      splitLine(lineView, fields);
+
+      while (m_columns.size() < fields.size()) {
+        newColumn();
+      }
+
+      for (size_t i = 0; i < m_columns.size(); ++i) {
+        Column& column = m_columns[i];
+        if (i >= fields.size()) {
+          column.appendEmpty();
+          continue;
+        }
+
+        std::string_view value = fields[i];
+        if (isIntegerString(value)) {
+          column.appendNumber(CellType::Integer, std::stoi(std::string(value)));
+        } else if (isDoubleString(value)) {
+          column.appendNumber(CellType::Double, std::stod(std::string(value)));
         } else {
-          boost::smatch valueMatch;
-          if (boost::regex_search(value, valueMatch, quoteRegex)) {
-            row.push_back(Variant(valueMatch[1]));
-          } else {
-            row.push_back(Variant(value));
+          if ((value.size() >= 2) && (value.front() == '"') && (value.back() == '"')) {
+            value = value.substr(1, value.size() - 2);
           }
+          column.appendString(std::string(value));
         }
-        ++it;
       }
-      result.push_back(row);
-    }
-
-    return result;
-  }
-
-  void CSVFile_Impl::assignNumColumns() {
-    m_numColumns = 0;
-    for (const auto& row : m_rows) {
-      m_numColumns = std::max<unsigned>(m_numColumns, row.size());
+      ++m_numRows;
     }
   }
 
   void CSVFile_Impl::ensureNumRows(unsigned numRows) {
     // add empty cells to existing columns if needed
-    if (numRows > m_rows.size()) {
-      unsigned numRowsToAdd = numRows - m_rows.size();
-      std::vector<Variant> blankRow(m_numColumns, Variant(""));
-      for (unsigned i = 0; i < numRowsToAdd; ++i) {
-        m_rows.push_back(blankRow);
+    if (numRows > m_numRows) {
+      for (auto& column : m_columns) {
+        column.appendEmpty(numRows - m_numRows);
       }
+      m_numRows = numRows;
     }
-    OS_ASSERT(m_rows.size() >= numRows);
   }
 
-  void CSVFile_Impl::padRows() {
-    for (auto& row : m_rows) {
-      while (row.size() < m_numColumns) {
-        row.push_back(Variant(""));
-      }
-    }
+  CSVFile_Impl::Column& CSVFile_Impl::newColumn() {
+    Column& column = m_columns.emplace_back();
+    column.appendEmpty(m_numRows);
+    return column;
   }
 
 }  // namespace detail
@@ -12,6 +12,8 @@
 #include "../core/Path.hpp"
 #include "../data/Vector.hpp"
 
+#include <utility>
+
 namespace openstudio {
 
 class CSVFile;
@@ -77,21 +79,49 @@ namespace detail {
     /** Get column as a Vector (first column is index 0). Numeric cells will be converted to strings. Empty vector is returned if column index is invalid.*/
     std::vector<std::string> getColumnAsStringVector(unsigned columnIndex) const;
 
+    /** Writes the file contents to a stream, one row at a time. */
+    void write(std::ostream& os) const;
+
    private:
     REGISTER_LOGGER("openstudio.CSVFile");
 
-    // throws on error
-    static std::vector<std::vector<Variant>> parseRows(std::istream& input);
+    enum class CellType : unsigned char
+    {
+      Empty,
+      Boolean,
+      Integer,
+      Double,
+      String
+    };
+
+    /** One column of cells. Numeric cells are stored in a contiguous array, non empty string cells are stored
+     *  separately, sorted by row. Empty cells read back as the empty string. */
+    struct Column
+    {
+      std::vector<CellType> types;
+      std::vector<double> numbers;
+      std::vector<std::pair<unsigned, std::string>> strings;
+
+      void appendEmpty(unsigned n = 1);
+      void appendNumber(CellType type, double value);
+      void appendString(std::string value);
+      void append(const Variant& value);
+
+      const std::string& stringAt(unsigned row) const;
+      Variant variantAt(unsigned row) const;
+    };
 
-    void assignNumColumns();
+    // throws on error
+    void parse(std::istream& input);
 
     void ensureNumRows(unsigned numRows);
 
-    void padRows();
+    // adds a column of empty cells for the existing rows
+    Column& newColumn();
 
     boost::optional<openstudio::path> m_path;
-    unsigned m_numColumns;
-    std::vector<std::vector<Variant>> m_rows;
+    unsigned m_numRows;
+    std::vector<Column> m_columns;
   };
 
 }  // namespace detail
@@ -12,7 +12,9 @@
 #include "../core/Assert.hpp"
 
 #include <fmt/format.h>
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace openstudio {
 
@@ -4322,21 +4324,22 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
   }
   if (!m_data.empty()) {
     std::string units = EpwDataPoint::getUnits(id);
+    const std::vector<double>& column = dataColumn(id);
+    const DateTimeVector& allDates = timeSeriesDates();
+    if (std::none_of(column.begin(), column.end(), [](double value) { return std::isnan(value); })) {
+      // Complete column, the shared dates can be used as is
+      return boost::optional<TimeSeries>(TimeSeries(allDates, openstudio::createVector(column), units));
+    }
+    // Some values are missing, keep only the dates of the values that are there
     DateTimeVector dates;
+    dates.reserve(column.size() + 1);
     dates.push_back(DateTime());  // Use a placeholder to avoid an insert
     std::vector<double> values;
-    for (unsigned int i = 0; i < m_data.size(); i++) {
-      DateTime dateTime = m_data[i].dateTime();
-      // Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].getField(id);
-      if (value) {
-        if (isActual()) {
-          dates.push_back(DateTime(dateTime));
-        } else {
-          // Strip year
-          dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
-        }
-        values.push_back(value.get());
+    values.reserve(column.size());
+    for (unsigned int i = 0; i < column.size(); i++) {
+      if (!std::isnan(column[i])) {
+        dates.push_back(allDates[i + 1]);
+        values.push_back(column[i]);
       }
     }
     if (!values.empty()) {
@@ -4348,6 +4351,40 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
   return boost::none;
 }
 
+const std::vector<double>& EpwFile::dataColumn(EpwDataField field) {
+  auto [it, inserted] = m_dataColumns.try_emplace(field.value());
+  if (inserted) {
+    std::vector<double>& column = it->second;
+    column.reserve(m_data.size());
+    for (const auto& dataPoint : m_data) {
+      boost::optional<double> value = dataPoint.getField(field);
+      column.push_back(value ? value.get() : std::numeric_limits<double>::quiet_NaN());
+    }
+  }
+  return it->second;
+}
+
+const DateTimeVector& EpwFile::timeSeriesDates() {
+  if (m_timeSeriesDates.empty() && !m_data.empty()) {
+    // Build into a local so that nothing is cached if a date cannot be made (e.g. a leap day in a TMY file)
+    DateTimeVector dates;
+    dates.reserve(m_data.size() + 1);
+    dates.push_back(DateTime());  // Use a placeholder to avoid an insert
+    for (const auto& dataPoint : m_data) {
+      DateTime dateTime = dataPoint.dateTime();
+      if (isActual()) {
+        dates.push_back(dateTime);
+      } else {
+        // Strip year
+        dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
+      }
+    }
+    dates[0] = dates[1] - Time(0, 0, 0, 3600 / m_recordsPerHour);  // Overwrite the placeholder
+    m_timeSeriesDates = std::move(dates);
+  }
+  return m_timeSeriesDates;
+}
+
 boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& name) {
   if (m_data.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
@@ -4507,6 +4544,22 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
   return true;
 }
 
+// Same as splitString(line, ','), without going through a stringstream for each of the many data lines
+static std::vector<std::string> splitDataLine(const std::string& line) {
+  std::vector<std::string> result;
+  if (line.empty()) {
+    return result;
+  }
+  result.reserve(35);
+  std::string::size_type start = 0;
+  for (std::string::size_type comma = line.find(','); comma != std::string::npos; comma = line.find(',', start)) {
+    result.emplace_back(line, start, comma - start);
+    start = comma + 1;
+  }
+  result.emplace_back(line, start);
+  return result;
+}
+
 bool EpwFile::parse(std::istream& ifs, bool storeData) {
   // read line by line
   std::string line;
@@ -4576,7 +4629,7 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
   std::vector<EPWString> epw_strings;
   while (std::getline(ifs, line)) {
     lineNumber++;
-    std::vector<std::string> strings = splitString(line, ',');
+    std::vector<std::string> strings = splitDataLine(line);
     if (strings.size() >= 5) {
       try {
         int year = std::stoi(strings[0]);
@@ -4625,7 +4678,7 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
               m_minutesMatch = false;
             }
           }
-          epw_strings.push_back({lineNumber, year, month, day, hour, currentMinute, strings});
+          epw_strings.push_back({lineNumber, year, month, day, hour, currentMinute, std::move(strings)});
         }
 
       } catch (...) {
@@ -16,6 +16,8 @@
 #include "../time/DateTime.hpp"
 #include "../data/TimeSeries.hpp"
 
+#include <map>
+
 namespace openstudio {
 
 // forward declaration
@@ -1087,6 +1089,10 @@ class UTILITIES_API EpwFile
   bool parseDataPeriod(const std::string& line);
   bool parseHolidaysDaylightSavings(const std::string& line);
   bool parseGroundTemperatures(const std::string& line);
+  // Values of a data field for every data point, NaN where the value is missing. Parsed on first use and kept
+  const std::vector<double>& dataColumn(EpwDataField field);
+  // Time series dates of every data point, built on first use and shared by all the fields
+  const DateTimeVector& timeSeriesDates();
 
   // configure logging
   REGISTER_LOGGER("openstudio.EpwFile");
@@ -1109,6 +1115,10 @@ class UTILITIES_API EpwFile
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
   std::vector<EpwDataPoint> m_data;
+  // Columns of m_data keyed by EpwDataField value, see dataColumn
+  std::map<int, std::vector<double>> m_dataColumns;
+  // Start of the first interval followed by the date and time of each data point, see timeSeriesDates
+  DateTimeVector m_timeSeriesDates;
   std::vector<EpwDesignCondition> m_designs;
   std::vector<EpwGroundTemperatureDepth> m_depths;
 
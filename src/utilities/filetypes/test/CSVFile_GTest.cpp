@@ -272,3 +272,53 @@ TEST(Filetypes, CSVFile_AddAndGetColumn) {
   EXPECT_EQ("2.2", getCol4[1]);
   EXPECT_EQ("0.33", getCol4[2]);
 }
+
+TEST(Filetypes, CSVFile_RaggedColumns) {
+  CSVFile csvFile;
+
+  // a header row followed by a shorter numeric column, as written by ScheduleFile
+  std::vector<std::string> header{"Date/Time", "Value"};
+  csvFile.addRow({Variant(header[0]), Variant(header[1])});
+  csvFile.addColumn(std::vector<double>{1.5, 2.5, 3.5, 4.5});
+
+  ASSERT_EQ(4, csvFile.numRows());
+  ASSERT_EQ(3, csvFile.numColumns());
+
+  // header columns are padded with empty cells, so they are not numeric
+  EXPECT_TRUE(csvFile.getColumnAsDoubleVector(1).empty());
+  EXPECT_EQ(4u, csvFile.getColumnAsDoubleVector(2).size());
+  std::vector<std::string> col1 = csvFile.getColumnAsStringVector(1);
+  ASSERT_EQ(4u, col1.size());
+  EXPECT_EQ("Value", col1[0]);
+  EXPECT_EQ("", col1[3]);
+
+  auto rows = csvFile.rows();
+  ASSERT_EQ(4u, rows.size());
+  for (const auto& row : rows) {
+    EXPECT_EQ(3u, row.size());
+  }
+  EXPECT_EQ(VariantType::Double, rows[3][2].variantType().value());
+  EXPECT_EQ(4.5, rows[3][2].valueAsDouble());
+  EXPECT_EQ(VariantType::String, rows[3][0].variantType().value());
+  EXPECT_EQ("", rows[3][0].valueAsString());
+
+  // round trip through the writer and the reader
+  EXPECT_EQ("Date/Time,Value,1.5\n,,2.5\n,,3.5\n,,4.5\n", csvFile.string());
+  CSVFile reloaded(csvFile.string());
+  EXPECT_EQ(csvFile.string(), reloaded.string());
+  EXPECT_EQ(4, reloaded.numRows());
+  EXPECT_EQ(3, reloaded.numColumns());
+
+  // a ragged row widens the file, existing rows are padded
+  csvFile.addRow({Variant(1), Variant(2), Variant(3), Variant(true)});
+  EXPECT_EQ(5, csvFile.numRows());
+  EXPECT_EQ(4, csvFile.numColumns());
+  EXPECT_EQ("Date/Time,Value,1.5,\n,,2.5,\n,,3.5,\n,,4.5,\n1,2,3,\n", csvFile.string());
+
+  // windows line endings are not part of the last cell
+  CSVFile crlf(std::string("1,2.5\r\n3,4.5\r\n"));
+  std::vector<double> col = crlf.getColumnAsDoubleVector(1);
+  ASSERT_EQ(2u, col.size());
+  EXPECT_EQ(2.5, col[0]);
+  EXPECT_EQ(4.5, col[1]);
+}
@@ -924,6 +924,41 @@ TEST(Filetypes, EpwFile_DataPoint) {
   }
 }
 
+TEST(Filetypes, EpwFile_TimeSeriesMatchesData) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p);
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760, data.size());
+
+  for (const std::string field : {"Dry Bulb Temperature", "Atmospheric Station Pressure", "Wind Speed", "Present Weather Codes",
+                                  "Liquid Precipitation Depth", "Liquid Precipitation Quantity"}) {
+    std::vector<double> expectedValues;
+    DateTimeVector expectedDates;
+    for (auto& dataPoint : data) {
+      if (boost::optional<double> value = dataPoint.getField(EpwDataField(field))) {
+        expectedValues.push_back(value.get());
+        expectedDates.push_back(dataPoint.dateTime());
+      }
+    }
+    boost::optional<TimeSeries> series = epwFile.getTimeSeries(field);
+    if (expectedValues.empty()) {
+      EXPECT_FALSE(series) << field;
+      continue;
+    }
+    ASSERT_TRUE(series) << field;
+    openstudio::Vector values = series->values();
+    DateTimeVector dates = series->dateTimes();
+    ASSERT_EQ(expectedValues.size(), values.size()) << field;
+    ASSERT_EQ(expectedDates.size(), dates.size()) << field;
+    for (size_t i = 0; i < expectedValues.size(); ++i) {
+      EXPECT_EQ(expectedValues[i], values[i]) << field;
+      EXPECT_EQ(expectedDates[i].date().monthOfYear(), dates[i].date().monthOfYear()) << field;
+      EXPECT_EQ(expectedDates[i].date().dayOfMonth(), dates[i].date().dayOfMonth()) << field;
+      EXPECT_EQ(expectedDates[i].time(), dates[i].time()) << field;
+    }
+  }
+}
+
 TEST(Filetypes, EpwFile_parseDataPeriods) {
 
   // I would construct an empty EpwFile to call parseDataPeriods but I can't since it's a private Ctor, and the method itself is private...
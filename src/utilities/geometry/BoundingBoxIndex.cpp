@@ -0,0 +1,160 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "BoundingBoxIndex.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace openstudio {
+
+namespace {
+
+  // boxes per leaf, below this it is cheaper to test every box than to split further
+  constexpr unsigned maxLeafSize = 4;
+
+}  // namespace
+
+BoundingBoxIndex::BoundingBoxIndex(const std::vector<BoundingBox>& boxes) : m_size(boxes.size()) {
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    const BoundingBox& box = boxes[i];
+    if (box.isEmpty()) {
+      continue;
+    }
+    m_boxes.push_back(Box{{*box.minX(), *box.minY(), *box.minZ()}, {*box.maxX(), *box.maxY(), *box.maxZ()}});
+    m_indices.push_back(i);
+  }
+
+  m_order.resize(m_boxes.size());
+  std::iota(m_order.begin(), m_order.end(), 0U);
+
+  if (!m_boxes.empty()) {
+    m_nodes.reserve(2 * m_boxes.size() / maxLeafSize + 1);
+    build(0, static_cast<unsigned>(m_boxes.size()));
+  }
+}
+
+size_t BoundingBoxIndex::size() const {
+  return m_size;
+}
+
+std::vector<size_t> BoundingBoxIndex::intersecting(const BoundingBox& box, double tol) const {
+  std::vector<size_t> result;
+  if (box.isEmpty()) {
+    return result;
+  }
+
+  query(Box{{*box.minX(), *box.minY(), *box.minZ()}, {*box.maxX(), *box.maxY(), *box.maxZ()}}, tol, result);
+  for (size_t& index : result) {
+    index = m_indices[index];
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::vector<std::pair<size_t, size_t>> BoundingBoxIndex::intersectingPairs(double tol) const {
+  std::vector<std::pair<size_t, size_t>> result;
+
+  std::vector<size_t> candidates;
+  for (size_t i = 0; i < m_boxes.size(); ++i) {
+    candidates.clear();
+    query(m_boxes[i], tol, candidates);
+    // m_boxes is in the order of the original list, so comparing positions in m_boxes compares original indices
+    std::sort(candidates.begin(), candidates.end());
+    for (size_t j : candidates) {
+      if (j > i) {
+        result.emplace_back(m_indices[i], m_indices[j]);
+      }
+    }
+  }
+
+  return result;
+}
+
+unsigned BoundingBoxIndex::build(unsigned first, unsigned count) {
+  auto nodeIndex = static_cast<unsigned>(m_nodes.size());
+  m_nodes.emplace_back();
+
+  Box box = m_boxes[m_order[first]];
+  Box centroids{};
+  for (unsigned axis = 0; axis < 3; ++axis) {
+    centroids.min[axis] = centroids.max[axis] = 0.5 * (box.min[axis] + box.max[axis]);
+  }
+  for (unsigned i = first; i < first + count; ++i) {
+    const Box& other = m_boxes[m_order[i]];
+    for (unsigned axis = 0; axis < 3; ++axis) {
+      box.min[axis] = std::min(box.min[axis], other.min[axis]);
+      box.max[axis] = std::max(box.max[axis], other.max[axis]);
+      double centroid = 0.5 * (other.min[axis] + other.max[axis]);
+      centroids.min[axis] = std::min(centroids.min[axis], centroid);
+      centroids.max[axis] = std::max(centroids.max[axis], centroid);
+    }
+  }
+  m_nodes[nodeIndex].box = box;
+
+  // split at the median centroid along the axis where the centroids are most spread out
+  unsigned splitAxis = 0;
+  for (unsigned axis = 1; axis < 3; ++axis) {
+    if (centroids.max[axis] - centroids.min[axis] > centroids.max[splitAxis] - centroids.min[splitAxis]) {
+      splitAxis = axis;
+    }
+  }
+
+  if ((count <= maxLeafSize) || (centroids.max[splitAxis] == centroids.min[splitAxis])) {
+    m_nodes[nodeIndex].first = first;
+    m_nodes[nodeIndex].count = count;
+    return nodeIndex;
+  }
+
+  unsigned half = count / 2;
+  std::nth_element(m_order.begin() + first, m_order.begin() + first + half, m_order.begin() + first + count,
+                   [this, splitAxis](unsigned a, unsigned b) {
+                     return (m_boxes[a].min[splitAxis] + m_boxes[a].max[splitAxis]) < (m_boxes[b].min[splitAxis] + m_boxes[b].max[splitAxis]);
+                   });
+
+  unsigned left = build(first, half);
+  unsigned right = build(first + half, count - half);
+  m_nodes[nodeIndex].left = left;
+  m_nodes[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+void BoundingBoxIndex::query(const Box& box, double tol, std::vector<size_t>& result) const {
+  if (m_nodes.empty()) {
+    return;
+  }
+
+  std::vector<unsigned> stack{0};
+  while (!stack.empty()) {
+    const Node& node = m_nodes[stack.back()];
+    stack.pop_back();
+
+    // a node's box contains all boxes below it, if it does not intersect neither do they
+    if (!intersects(node.box, box, tol)) {
+      continue;
+    }
+
+    if (node.count > 0) {
+      for (unsigned i = node.first; i < node.first + node.count; ++i) {
+        if (intersects(m_boxes[m_order[i]], box, tol)) {
+          result.push_back(m_order[i]);
+        }
+      }
+    } else {
+      stack.push_back(node.right);
+      stack.push_back(node.left);
+    }
+  }
+}
+
+bool BoundingBoxIndex::intersects(const Box& a, const Box& b, double tol) {
+  // same test as BoundingBox::intersects
+  bool test = ((a.min[0] > b.max[0] + tol) || (a.min[1] > b.max[1] + tol) || (a.min[2] > b.max[2] + tol) || (b.min[0] > a.max[0] + tol)
+               || (b.min[1] > a.max[1] + tol) || (b.min[2] > a.max[2] + tol));
+
+  return (!test);
+}
+
+}  // namespace openstudio
@@ -0,0 +1,73 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_BOUNDINGBOXINDEX_HPP
+#define UTILITIES_GEOMETRY_BOUNDINGBOXINDEX_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "BoundingBox.hpp"
+
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+
+/** BoundingBoxIndex is a static bounding volume hierarchy over a list of BoundingBoxes. It answers which of
+ *  the boxes intersect a given box, or which pairs of boxes intersect each other, without testing every pair.
+ *  Intersection follows BoundingBox::intersects exactly, so empty boxes never intersect anything. Indices refer
+ *  to the position of the box in the list the index was built from; the boxes are copied and later changes to
+ *  the original list are not seen.
+ */
+class UTILITIES_API BoundingBoxIndex
+{
+ public:
+  /// build the index over boxes
+  explicit BoundingBoxIndex(const std::vector<BoundingBox>& boxes);
+
+  /// number of boxes the index was built from, including empty ones
+  size_t size() const;
+
+  /// indices of boxes that intersect box, in increasing order. Default tolerance is 1cm
+  std::vector<size_t> intersecting(const BoundingBox& box, double tol = 0.01) const;
+
+  /// all pairs (i, j) with i < j such that box i intersects box j, sorted by i then j. Default tolerance is 1cm
+  std::vector<std::pair<size_t, size_t>> intersectingPairs(double tol = 0.01) const;
+
+ private:
+  REGISTER_LOGGER("utilities.BoundingBoxIndex");
+
+  struct Box
+  {
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+  };
+
+  // leaves hold m_order[first, first + count), inner nodes have count == 0 and children left and right
+  struct Node
+  {
+    Box box;
+    unsigned first = 0;
+    unsigned count = 0;
+    unsigned left = 0;
+    unsigned right = 0;
+  };
+
+  unsigned build(unsigned first, unsigned count);
+
+  void query(const Box& box, double tol, std::vector<size_t>& result) const;
+
+  static bool intersects(const Box& a, const Box& b, double tol);
+
+  size_t m_size;
+  std::vector<Box> m_boxes;
+  std::vector<size_t> m_indices;
+  std::vector<unsigned> m_order;
+  std::vector<Node> m_nodes;
+};
+
+}  // namespace openstudio
+
+#endif  //UTILITIES_GEOMETRY_BOUNDINGBOXINDEX_HPP
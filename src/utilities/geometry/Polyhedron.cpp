@@ -16,12 +16,137 @@
 #include <fmt/core.h>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <numeric>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace openstudio {
 
+namespace {
+
+  // Twice the tolerance, so that rounding can never put two almost equal points more than one cell apart
+  constexpr double cellSize = 2.0 * POINT_TOLERANCE;
+
+  // Uniform grid of cellSize wide cells. isAlmostEqual3dPt compares each coordinate separately, so two points that are almost equal are at most
+  // one cell apart on each axis: only the 27 cells around a point can hold a match.
+  class PointGrid
+  {
+   public:
+    void insert(const Point3d& pt, size_t value) {
+      m_cells[cellOf(pt)].push_back(value);
+    }
+
+    // Calls fn on every value stored near pt. These are only candidates, they still have to be checked with isAlmostEqual3dPt
+    template <typename Fn>
+    void forEachNear(const Point3d& pt, Fn fn) const {
+      const Cell center = cellOf(pt);
+      for (int64_t dx = -1; dx <= 1; ++dx) {
+        for (int64_t dy = -1; dy <= 1; ++dy) {
+          for (int64_t dz = -1; dz <= 1; ++dz) {
+            auto it = m_cells.find(Cell{center[0] + dx, center[1] + dy, center[2] + dz});
+            if (it != m_cells.end()) {
+              for (size_t value : it->second) {
+                fn(value);
+              }
+            }
+          }
+        }
+      }
+    }
+
+   private:
+    using Cell = std::array<int64_t, 3>;
+
+    struct CellHash
+    {
+      size_t operator()(const Cell& cell) const {
+        size_t h = std::hash<int64_t>{}(cell[0]);
+        h = h * 31 + std::hash<int64_t>{}(cell[1]);
+        h = h * 31 + std::hash<int64_t>{}(cell[2]);
+        return h;
+      }
+    };
+
+    static Cell cellOf(const Point3d& pt) {
+      return {static_cast<int64_t>(std::floor(pt.x() / cellSize)), static_cast<int64_t>(std::floor(pt.y() / cellSize)),
+              static_cast<int64_t>(std::floor(pt.z() / cellSize))};
+    }
+
+    std::unordered_map<Cell, std::vector<size_t>, CellHash> m_cells;
+  };
+
+  // Appends edge to edges unless an equal edge (in either direction) is already there. grid indexes the start points of edges.
+  // An equal edge starts near either end of edge, so both are looked up
+  void appendIfNoEqualEdge(std::vector<Surface3dEdge>& edges, PointGrid& grid, const Surface3dEdge& edge) {
+    bool found = false;
+    auto check = [&edges, &edge, &found](size_t i) { found = found || (edges[i] == edge); };
+    grid.forEachNear(edge.start(), check);
+    grid.forEachNear(edge.end(), check);
+    if (!found) {
+      grid.insert(edge.start(), edges.size());
+      edges.push_back(edge);
+    }
+  }
+
+  // Vertex indices sorted along each axis, to find the vertices that may lie on an edge without testing them all
+  class SortedVertices
+  {
+   public:
+    explicit SortedVertices(const std::vector<Point3d>& vertices) : m_vertices(vertices) {
+      for (size_t axis = 0; axis < 3; ++axis) {
+        auto& sorted = m_sorted[axis];
+        sorted.resize(vertices.size());
+        std::iota(sorted.begin(), sorted.end(), 0);
+        std::sort(sorted.begin(), sorted.end(), [this, axis](size_t lhs, size_t rhs) {
+          return coordinate(m_vertices[lhs], axis) < coordinate(m_vertices[rhs], axis);
+        });
+      }
+    }
+
+    // Indices, in increasing order, of the vertices within POINT_TOLERANCE of the bounding box of [start, end]. This includes every vertex
+    // for which isPointOnLineBetweenPoints(start, end, vertex) may be true
+    std::vector<size_t> nearSegment(const Point3d& start, const Point3d& end) const {
+      std::array<double, 3> lo{};
+      std::array<double, 3> hi{};
+      size_t narrowestAxis = 0;
+      for (size_t axis = 0; axis < 3; ++axis) {
+        lo[axis] = std::min(coordinate(start, axis), coordinate(end, axis)) - POINT_TOLERANCE;
+        hi[axis] = std::max(coordinate(start, axis), coordinate(end, axis)) + POINT_TOLERANCE;
+        if ((hi[axis] - lo[axis]) < (hi[narrowestAxis] - lo[narrowestAxis])) {
+          narrowestAxis = axis;
+        }
+      }
+
+      // Walk the axis along which the box is the thinnest, it has the fewest vertices to filter
+      const auto& sorted = m_sorted[narrowestAxis];
+      auto first = std::lower_bound(sorted.begin(), sorted.end(), lo[narrowestAxis],
+                                    [this, narrowestAxis](size_t i, double value) { return coordinate(m_vertices[i], narrowestAxis) < value; });
+      std::vector<size_t> result;
+      for (auto it = first; (it != sorted.end()) && (coordinate(m_vertices[*it], narrowestAxis) <= hi[narrowestAxis]); ++it) {
+        const Point3d& pt = m_vertices[*it];
+        if ((lo[0] <= pt.x()) && (pt.x() <= hi[0]) && (lo[1] <= pt.y()) && (pt.y() <= hi[1]) && (lo[2] <= pt.z()) && (pt.z() <= hi[2])) {
+          result.push_back(*it);
+        }
+      }
+      std::sort(result.begin(), result.end());
+      return result;
+    }
+
+   private:
+    static double coordinate(const Point3d& pt, size_t axis) {
+      return (axis == 0) ? pt.x() : ((axis == 1) ? pt.y() : pt.z());
+    }
+
+    const std::vector<Point3d>& m_vertices;
+    std::array<std::vector<size_t>, 3> m_sorted;
+  };
+
+}  // namespace
+
 Surface3dEdge::Surface3dEdge(Point3d start, Point3d end, const Surface3d& firstSurface)
   : m_start(std::move(start)), m_end(std::move(end)), m_firstSurfaceName(firstSurface.name) {
   m_allSurfNums.push_back(firstSurface.surfNum);
@@ -242,29 +367,53 @@ void Polyhedron::performEdgeMatching() {
 
   m_hasAnySurfaceWithIncorrectOrientation = false;
 
-  // We use **Combinations** (rather than Permutations) to avoid traversing unnecessarily
+  // Two edges are equal only if the start of one is almost equal to either end of the other, so candidates are found through a grid over the edge
+  // start points rather than by comparing every pair of edges
+  std::vector<std::pair<size_t, size_t>> edgeRefs;  // (surface index, edge index)
+  edgeRefs.reserve(numVertices());
+  PointGrid startGrid;
   for (size_t i = 0; i < m_surfaces.size(); ++i) {
-    for (size_t j = i + 1; j < m_surfaces.size(); ++j) {
-      auto& surface1 = m_surfaces[i];
-      auto& surface2 = m_surfaces[j];
-      for (Surface3dEdge& edge1 : surface1.edges) {
-        for (Surface3dEdge& edge2 : surface2.edges) {
-          if (edge1 == edge2) {
-            if (std::find(edge1.allSurfNums().begin(), edge1.allSurfNums().cend(), edge2.firstSurfNum()) == edge1.allSurfNums().end()) {
-              // appendSurface will allow use to check edge.count() later to check if count == 2.
-              // All edges must be count == 2 in an Enclosed Polyhedron
-              edge1.appendSurface(surface2);
-              edge2.appendSurface(surface1);
-              // In a Polyhedron that has a consistent orientation (typically all faces are in counter clockwise order),
-              // each edge must be matched by an edge in the **opposite** direction. If not, mark conflicted
-              if (!edge1.reverseEqual(edge2)) {
-                edge1.markConflictedOrientation();
-                edge2.markConflictedOrientation();
-                m_hasAnySurfaceWithIncorrectOrientation = true;
-              }
-            }
-          }
-        }
+    for (size_t a = 0; a < m_surfaces[i].edges.size(); ++a) {
+      startGrid.insert(m_surfaces[i].edges[a].start(), edgeRefs.size());
+      edgeRefs.emplace_back(i, a);
+    }
+  }
+
+  // (surface1 index, surface2 index, edge1 index, edge2 index), with surface1 index < surface2 index
+  std::vector<std::array<size_t, 4>> matches;
+  for (const auto& [i, a] : edgeRefs) {
+    const Surface3dEdge& edge1 = m_surfaces[i].edges[a];
+    auto check = [this, &edgeRefs, &matches, &edge1, i = i, a = a](size_t ref) {
+      const auto& [j, b] = edgeRefs[ref];
+      if ((j > i) && (edge1 == m_surfaces[j].edges[b])) {
+        matches.push_back({i, j, a, b});
+      }
+    };
+    startGrid.forEachNear(edge1.start(), check);
+    startGrid.forEachNear(edge1.end(), check);
+  }
+
+  // Process the matches in the order of the nested loops over surface pairs then edges, since the allSurfNums check below depends on it.
+  // We use **Combinations** (rather than Permutations): each pair of surfaces is only seen once
+  std::sort(matches.begin(), matches.end());
+  matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+
+  for (const auto& [i, j, a, b] : matches) {
+    auto& surface1 = m_surfaces[i];
+    auto& surface2 = m_surfaces[j];
+    Surface3dEdge& edge1 = surface1.edges[a];
+    Surface3dEdge& edge2 = surface2.edges[b];
+    if (std::find(edge1.allSurfNums().begin(), edge1.allSurfNums().cend(), edge2.firstSurfNum()) == edge1.allSurfNums().end()) {
+      // appendSurface will allow use to check edge.count() later to check if count == 2.
+      // All edges must be count == 2 in an Enclosed Polyhedron
+      edge1.appendSurface(surface2);
+      edge2.appendSurface(surface1);
+      // In a Polyhedron that has a consistent orientation (typically all faces are in counter clockwise order),
+      // each edge must be matched by an edge in the **opposite** direction. If not, mark conflicted
+      if (!edge1.reverseEqual(edge2)) {
+        edge1.markConflictedOrientation();
+        edge2.markConflictedOrientation();
+        m_hasAnySurfaceWithIncorrectOrientation = true;
       }
     }
   }
@@ -295,6 +444,7 @@ void Polyhedron::resetEdgeMatching() {
 
 void Polyhedron::updateZonePolygonsForMissingColinearPoints() {
   const std::vector<Point3d> uniqVertices = uniqueVertices();
+  const SortedVertices sortedVertices(uniqVertices);
 
   bool anyInserted = false;
 
@@ -306,8 +456,10 @@ void Polyhedron::updateZonePolygonsForMissingColinearPoints() {
 
       for (auto it = surface.edges.begin(); it != surface.edges.end(); ++it) {
 
-        // now go through all the vertices and see if they are colinear with start and end vertices
-        for (const auto& testVertex : uniqVertices) {
+        // now go through the vertices close to the edge and see if they are colinear with start and end vertices.
+        // They are visited in the order of uniqVertices so the first one to split the edge is the same as when testing them all
+        for (size_t vertexIndex : sortedVertices.nearSegment(it->start(), it->end())) {
+          const Point3d& testVertex = uniqVertices[vertexIndex];
           if (const boost::optional<Surface3dEdge> newEdge = it->splitEdge(testVertex)) {
             LOG(Debug, testVertex << " is on " << *it);
             auto itnext = std::next(it);
@@ -347,12 +499,15 @@ std::vector<Point3d> Polyhedron::uniqueVertices() const {
 
   std::vector<Point3d> uniqVertices;
   uniqVertices.reserve(numVertices());
+  PointGrid grid;
 
   for (const auto& surface : m_surfaces) {
     for (const auto& edge : surface.edges) {
       const auto& pt = edge.start();
-      if (std::find_if(uniqVertices.cbegin(), uniqVertices.cend(), [&pt](const auto& unqV) { return isAlmostEqual3dPt(pt, unqV); })
-          == uniqVertices.cend()) {
+      bool found = false;
+      grid.forEachNear(pt, [&uniqVertices, &pt, &found](size_t i) { found = found || isAlmostEqual3dPt(pt, uniqVertices[i]); });
+      if (!found) {
+        grid.insert(pt, uniqVertices.size());
         uniqVertices.push_back(pt);
       }
     }
@@ -364,14 +519,12 @@ std::vector<Surface3dEdge> Polyhedron::uniqueEdges() const {
 
   std::vector<Surface3dEdge> uniqueSurface3dEdges;
   uniqueSurface3dEdges.reserve(numVertices());
+  PointGrid grid;
 
   // construct list of unique edges
   for (const auto& surface : m_surfaces) {
     for (const Surface3dEdge& thisSurface3dEdge : surface.edges) {
-      auto itFound = std::find(uniqueSurface3dEdges.begin(), uniqueSurface3dEdges.end(), thisSurface3dEdge);
-      if (itFound == uniqueSurface3dEdges.end()) {
-        uniqueSurface3dEdges.push_back(thisSurface3dEdge);
-      }
+      appendIfNoEqualEdge(uniqueSurface3dEdges, grid, thisSurface3dEdge);
     }
   }
 
@@ -382,6 +535,7 @@ std::vector<Surface3dEdge> Polyhedron::edgesNotTwo(bool includeCreatedEdges) con
 
   std::vector<Surface3dEdge> edgesNotTwo;
   edgesNotTwo.reserve(numVertices());
+  PointGrid grid;
 
   // All edges for an enclosed polyhedron should be shared by two (and only two) side
   for (const auto& surface : m_surfaces) {
@@ -389,10 +543,7 @@ std::vector<Surface3dEdge> Polyhedron::edgesNotTwo(bool includeCreatedEdges) con
       // only return a list of those edges that appear in both the original edge and the revised edges:
       // this eliminates added edges that will confuse users (edges that were caught by the updateZonePolygonsForMissingColinearPoints routine)
       if ((thisSurface3dEdge.count() != 2) && (includeCreatedEdges || !thisSurface3dEdge.hasBeenCreated())) {
-        auto itFound = std::find(edgesNotTwo.begin(), edgesNotTwo.end(), thisSurface3dEdge);
-        if (itFound == edgesNotTwo.end()) {
-          edgesNotTwo.push_back(thisSurface3dEdge);
-        }
+        appendIfNoEqualEdge(edgesNotTwo, grid, thisSurface3dEdge);
       }
     }
   }
@@ -7,6 +7,7 @@
 #include "GeometryFixture.hpp"
 
 #include "../BoundingBox.hpp"
+#include "../BoundingBoxIndex.hpp"
 #include "../Point3d.hpp"
 
 using namespace openstudio;
@@ -120,3 +121,51 @@ TEST_F(GeometryFixture, BoundingBox_NoIntersection) {
   EXPECT_FALSE(b1.intersects(b2));
   EXPECT_FALSE(b2.intersects(b1));
 }
+
+TEST_F(GeometryFixture, BoundingBoxIndex_MatchesPairwiseIntersects) {
+  // a grid of unit boxes that touch their neighbors, with some gaps, some overlapping boxes and an empty box mixed in
+  std::vector<BoundingBox> boxes;
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      for (int k = 0; k < 3; ++k) {
+        BoundingBox box;
+        if ((i + j + k) % 17 != 0) {
+          double gap = ((i * j) % 5 == 0) ? 0.5 : 0.0;
+          box.addPoint(Point3d(i + gap, j, k));
+          box.addPoint(Point3d(i + 1, j + 1 + gap, k + 1));
+        }
+        boxes.push_back(box);
+      }
+    }
+  }
+  BoundingBox big;
+  big.addPoint(Point3d(2.5, 2.5, 0.5));
+  big.addPoint(Point3d(6.5, 4.5, 1.5));
+  boxes.push_back(big);
+
+  BoundingBoxIndex index(boxes);
+  EXPECT_EQ(boxes.size(), index.size());
+
+  for (double tol : {0.01, 0.0, 0.6}) {
+    std::vector<std::pair<size_t, size_t>> expected;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      for (size_t j = i + 1; j < boxes.size(); ++j) {
+        if (boxes[i].intersects(boxes[j], tol)) {
+          expected.emplace_back(i, j);
+        }
+      }
+    }
+    EXPECT_EQ(expected, index.intersectingPairs(tol));
+
+    std::vector<size_t> expectedBig;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      if (big.intersects(boxes[i], tol)) {
+        expectedBig.push_back(i);
+      }
+    }
+    EXPECT_EQ(expectedBig, index.intersecting(big, tol));
+  }
+
+  EXPECT_TRUE(index.intersecting(BoundingBox()).empty());
+  EXPECT_TRUE(BoundingBoxIndex(std::vector<BoundingBox>()).intersectingPairs().empty());
+}
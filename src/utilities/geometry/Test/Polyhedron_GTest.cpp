@@ -233,3 +233,91 @@ TEST_F(GeometryFixture, Surface3d_Convexity) {
     EXPECT_FALSE(surface.isConvex());
   }
 }
+
+// A cube of the given size where each face is split in n x n facets, except for the roof which is split in nRoof x nRoof facets.
+// When n != nRoof, the top edges of the walls do not line up with the edges of the roof and have to be split
+static std::vector<Surface3d> makeFacetedCube(double size, int n, int nRoof) {
+  struct Face
+  {
+    Point3d origin;
+    Vector3d u;
+    Vector3d v;
+    int n;
+  };
+  // u x v is the outward normal
+  const std::vector<Face> faces{
+    {{0.0, 0.0, 0.0}, {0.0, size, 0.0}, {size, 0.0, 0.0}, n},      // floor
+    {{0.0, 0.0, size}, {size, 0.0, 0.0}, {0.0, size, 0.0}, nRoof},  // roof
+    {{0.0, 0.0, 0.0}, {size, 0.0, 0.0}, {0.0, 0.0, size}, n},      // south
+    {{0.0, size, 0.0}, {0.0, 0.0, size}, {size, 0.0, 0.0}, n},     // north
+    {{0.0, 0.0, 0.0}, {0.0, 0.0, size}, {0.0, size, 0.0}, n},      // west
+    {{size, 0.0, 0.0}, {0.0, size, 0.0}, {0.0, 0.0, size}, n},     // east
+  };
+
+  std::vector<Surface3d> surfaces;
+  for (const auto& face : faces) {
+    auto point = [&face](int i, int j) {
+      return face.origin + (static_cast<double>(i) / face.n) * face.u + (static_cast<double>(j) / face.n) * face.v;
+    };
+    for (int i = 0; i < face.n; ++i) {
+      for (int j = 0; j < face.n; ++j) {
+        const size_t surfNum = surfaces.size();
+        surfaces.emplace_back(std::vector<Point3d>{point(i, j), point(i + 1, j), point(i + 1, j + 1), point(i, j + 1)},
+                              fmt::format("Facet {}", surfNum), surfNum);
+      }
+    }
+  }
+  return surfaces;
+}
+
+TEST_F(GeometryFixture, Polyhedron_ManyFacets) {
+
+  constexpr double volume = 12.0 * 12.0 * 12.0;
+
+  {
+    const Polyhedron zonePoly(makeFacetedCube(12.0, 4, 4));
+    EXPECT_TRUE(zonePoly.isEnclosedVolume());
+    EXPECT_FALSE(zonePoly.hasAddedColinearPoints());
+    EXPECT_TRUE(zonePoly.edgesNotTwo().empty());
+    EXPECT_FALSE(zonePoly.hasAnySurfaceWithIncorrectOrientation());
+    // 6 * 16 facets with 4 edges, each shared by two facets
+    EXPECT_EQ(6 * 16 * 4 / 2, zonePoly.uniqueEdges().size());
+    // 8 corners, 12 * 3 on the edges of the cube, 6 * 9 inside the faces
+    EXPECT_EQ(8 + 12 * 3 + 6 * 9, zonePoly.uniqueVertices().size());
+    EXPECT_DOUBLE_EQ(volume, zonePoly.polyhedronVolume());
+  }
+
+  {
+    // The roof is split at 4 and 8, the walls at 3, 6 and 9: every top edge of the walls and every edge of the roof along the walls gets split
+    const Polyhedron zonePoly(makeFacetedCube(12.0, 4, 3));
+    EXPECT_TRUE(zonePoly.isEnclosedVolume());
+    EXPECT_TRUE(zonePoly.hasAddedColinearPoints());
+    EXPECT_TRUE(zonePoly.edgesNotTwo().empty());
+    EXPECT_FALSE(zonePoly.hasAnySurfaceWithIncorrectOrientation());
+    EXPECT_DOUBLE_EQ(volume, zonePoly.polyhedronVolume());
+  }
+
+  {
+    // Flip a facet in the middle of the floor
+    std::vector<Surface3d> surfaces = makeFacetedCube(12.0, 4, 4);
+    std::vector<Point3d> vertices = surfaces[5].vertices;
+    std::reverse(vertices.begin(), vertices.end());
+    surfaces[5] = Surface3d(vertices, surfaces[5].name, surfaces[5].surfNum);
+    const Polyhedron zonePoly(surfaces);
+    EXPECT_TRUE(zonePoly.isEnclosedVolume());
+    EXPECT_TRUE(zonePoly.hasAnySurfaceWithIncorrectOrientation());
+    EXPECT_FALSE(zonePoly.isCompletelyInsideOut());
+    const std::vector<Surface3d> incorrectSurfaces = zonePoly.findSurfacesWithIncorrectOrientation();
+    ASSERT_EQ(1, incorrectSurfaces.size());
+    EXPECT_EQ(surfaces[5].name, incorrectSurfaces.front().name);
+  }
+
+  {
+    // Remove a facet in the middle of the floor, leaving a hole bounded by 4 edges
+    std::vector<Surface3d> surfaces = makeFacetedCube(12.0, 4, 4);
+    surfaces.erase(std::next(surfaces.begin(), 5));
+    const Polyhedron zonePoly(surfaces);
+    EXPECT_FALSE(zonePoly.isEnclosedVolume());
+    EXPECT_EQ(4, zonePoly.edgesNotTwo().size());
+  }
+}
@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../TriangulationCache.hpp"
+#include "../Geometry.hpp"
+#include "../Point3d.hpp"
+
+#include <vector>
+
+using namespace openstudio;
+
+// A 10x4 wall at offset x, with a 1x2 window when withHole is set, in face coordinates
+static TriangulationCache::Face makeFace(double x, bool withHole) {
+  TriangulationCache::Face face;
+  face.vertices = {{x + 10, 4, 0}, {x + 10, 0, 0}, {x, 0, 0}, {x, 4, 0}};
+  if (withHole) {
+    face.holes.push_back({{x + 3, 3, 0}, {x + 3, 1, 0}, {x + 2, 1, 0}, {x + 2, 3, 0}});
+  }
+  return face;
+}
+
+TEST_F(GeometryFixture, TriangulationCache_SameAsComputeTriangulation) {
+  std::vector<TriangulationCache::Face> faces;
+  for (int i = 0; i < 50; ++i) {
+    faces.push_back(makeFace(20.0 * i, (i % 2) == 0));
+  }
+
+  TriangulationCache cache;
+  auto triangulations = cache.triangulate(faces);
+  ASSERT_EQ(faces.size(), triangulations.size());
+  for (size_t i = 0; i < faces.size(); ++i) {
+    EXPECT_EQ(computeTriangulation(faces[i].vertices, faces[i].holes), triangulations[i]);
+    EXPECT_FALSE(triangulations[i].empty());
+  }
+  EXPECT_EQ(50u, cache.size());
+  EXPECT_EQ(50u, cache.numTriangulated());
+
+  // Nothing is triangulated again, only the new face is
+  faces.push_back(makeFace(-20.0, true));
+  auto triangulations2 = cache.triangulate(faces);
+  ASSERT_EQ(faces.size(), triangulations2.size());
+  for (size_t i = 0; i < triangulations.size(); ++i) {
+    EXPECT_EQ(triangulations[i], triangulations2[i]);
+  }
+  EXPECT_EQ(computeTriangulation(faces.back().vertices, faces.back().holes), triangulations2.back());
+  EXPECT_EQ(51u, cache.size());
+  EXPECT_EQ(51u, cache.numTriangulated());
+
+  // A window moved, so the face is different
+  faces[0].holes[0][0] = Point3d(2.5, 3, 0);
+  cache.triangulate(faces);
+  EXPECT_EQ(52u, cache.size());
+  EXPECT_EQ(52u, cache.numTriangulated());
+
+  EXPECT_TRUE(cache.triangulate({}).empty());
+
+  cache.clear();
+  EXPECT_EQ(0u, cache.size());
+}
+
+TEST_F(GeometryFixture, TriangulationCache_MaxSize) {
+  TriangulationCache cache(10);
+  EXPECT_EQ(10u, cache.maxSize());
+
+  std::vector<TriangulationCache::Face> faces;
+  for (int i = 0; i < 8; ++i) {
+    faces.push_back(makeFace(20.0 * i, true));
+  }
+  cache.triangulate(faces);
+  EXPECT_EQ(8u, cache.size());
+
+  // Going over maxSize drops the faces that were not asked for in the last call
+  std::vector<TriangulationCache::Face> faces2;
+  for (int i = 0; i < 4; ++i) {
+    faces2.push_back(makeFace(-20.0 * (i + 1), false));
+  }
+  cache.triangulate(faces2);
+  EXPECT_EQ(4u, cache.size());
+
+  // Faces of a single call are all kept, even if there are more than maxSize of them
+  faces.insert(faces.end(), faces2.begin(), faces2.end());
+  cache.triangulate(faces);
+  EXPECT_EQ(12u, cache.size());
+  EXPECT_EQ(20u, cache.numTriangulated());
+}
@@ -0,0 +1,127 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "TriangulationCache.hpp"
+#include "Geometry.hpp"
+
+#include "../core/ParallelFor.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace openstudio {
+
+namespace {
+
+  void hashCombine(size_t& seed, size_t value) {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  }
+
+  void hashPoints(size_t& seed, const std::vector<Point3d>& points) {
+    hashCombine(seed, points.size());
+    for (const Point3d& point : points) {
+      hashCombine(seed, std::hash<double>{}(point.x()));
+      hashCombine(seed, std::hash<double>{}(point.y()));
+      hashCombine(seed, std::hash<double>{}(point.z()));
+    }
+  }
+
+}  // namespace
+
+size_t TriangulationCache::FaceHash::operator()(const Face& face) const {
+  size_t seed = 0;
+  hashPoints(seed, face.vertices);
+  hashCombine(seed, face.holes.size());
+  for (const auto& hole : face.holes) {
+    hashPoints(seed, hole);
+  }
+  return seed;
+}
+
+// Point3d::operator== is exact, faces only hit the cache if all coordinates are the same
+bool TriangulationCache::FaceEqual::operator()(const Face& lhs, const Face& rhs) const {
+  return (lhs.vertices == rhs.vertices) && (lhs.holes == rhs.holes);
+}
+
+TriangulationCache::TriangulationCache(size_t maxSize) : m_maxSize(maxSize) {}
+
+std::vector<std::vector<std::vector<Point3d>>> TriangulationCache::triangulate(const std::vector<Face>& faces) {
+  std::vector<std::vector<std::vector<Point3d>>> result(faces.size());
+
+  // faces not in the cache
+  std::vector<size_t> missing;
+  uint64_t generation = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    generation = ++m_generation;
+    for (size_t i = 0; i < faces.size(); ++i) {
+      auto it = m_entries.find(faces[i]);
+      if (it != m_entries.end()) {
+        it->second.lastUsed = generation;
+        result[i] = it->second.triangulation;
+      } else {
+        missing.push_back(i);
+      }
+    }
+  }
+
+  if (missing.empty()) {
+    return result;
+  }
+
+  // computeTriangulation only works on its inputs
+  parallelFor(missing.size(), [&faces, &missing, &result](size_t k) {
+    const Face& face = faces[missing[k]];
+    result[missing[k]] = computeTriangulation(face.vertices, face.holes);
+  });
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_numTriangulated += missing.size();
+  for (size_t i : missing) {
+    Entry& entry = m_entries[faces[i]];
+    entry.triangulation = result[i];
+    entry.lastUsed = generation;
+  }
+
+  if (m_entries.size() > m_maxSize) {
+    // keep what this call asked for, even if that alone is more than maxSize
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+      if (it->second.lastUsed < generation) {
+        it = m_entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    LOG(Debug, "Dropped faces from the triangulation cache, " << m_entries.size() << " faces left");
+  }
+
+  return result;
+}
+
+size_t TriangulationCache::size() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+size_t TriangulationCache::maxSize() const {
+  return m_maxSize;
+}
+
+size_t TriangulationCache::numTriangulated() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_numTriangulated;
+}
+
+void TriangulationCache::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+}
+
+TriangulationCache& TriangulationCache::shared() {
+  static TriangulationCache cache;
+  return cache;
+}
+
+}  // namespace openstudio
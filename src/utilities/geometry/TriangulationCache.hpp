@@ -0,0 +1,83 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_TRIANGULATIONCACHE_HPP
+#define UTILITIES_GEOMETRY_TRIANGULATIONCACHE_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "Point3d.hpp"
+#include "../core/Logger.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio {
+
+/** TriangulationCache triangulates faces with computeTriangulation and remembers the results, keyed by the exact face and hole
+ *  vertices, so that exporting a model again only triangulates the faces that changed. Faces missing from the cache are
+ *  triangulated on all processors. Once the cache holds more than maxSize faces, the faces that were not asked for by the
+ *  latest call are dropped. Thread-safe. */
+class UTILITIES_API TriangulationCache
+{
+ public:
+  /// vertices and holes as passed to computeTriangulation
+  struct Face
+  {
+    std::vector<Point3d> vertices;
+    std::vector<std::vector<Point3d>> holes;
+  };
+
+  explicit TriangulationCache(size_t maxSize = 50000);
+
+  TriangulationCache(const TriangulationCache&) = delete;
+  TriangulationCache& operator=(const TriangulationCache&) = delete;
+
+  /// same as computeTriangulation(face.vertices, face.holes) for each face, in the order of faces
+  std::vector<std::vector<std::vector<Point3d>>> triangulate(const std::vector<Face>& faces);
+
+  /// number of faces in the cache
+  size_t size() const;
+
+  size_t maxSize() const;
+
+  /// number of faces triangulated since construction, as opposed to found in the cache
+  size_t numTriangulated() const;
+
+  void clear();
+
+  /// cache shared by the ThreeJS and glTF forward translators
+  static TriangulationCache& shared();
+
+ private:
+  REGISTER_LOGGER("utilities.TriangulationCache");
+
+  struct FaceHash
+  {
+    size_t operator()(const Face& face) const;
+  };
+
+  struct FaceEqual
+  {
+    bool operator()(const Face& lhs, const Face& rhs) const;
+  };
+
+  struct Entry
+  {
+    std::vector<std::vector<Point3d>> triangulation;
+    uint64_t lastUsed = 0;
+  };
+
+  mutable std::mutex m_mutex;
+  size_t m_maxSize;
+  uint64_t m_generation = 0;
+  size_t m_numTriangulated = 0;
+  std::unordered_map<Face, Entry, FaceHash, FaceEqual> m_entries;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_GEOMETRY_TRIANGULATIONCACHE_HPP
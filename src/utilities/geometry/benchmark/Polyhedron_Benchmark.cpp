@@ -0,0 +1,97 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../Point3d.hpp"
+#include "../Polyhedron.hpp"
+#include "../Vector3d.hpp"
+
+#include "../../core/Assert.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace openstudio;
+
+// A 12m cube where each face is split in n x n facets, except for the roof which is split in nRoof x nRoof facets
+static std::vector<Surface3d> makeFacetedCube(int n, int nRoof) {
+  constexpr double size = 12.0;
+  struct Face
+  {
+    Point3d origin;
+    Vector3d u;
+    Vector3d v;
+    int n;
+  };
+  // u x v is the outward normal
+  const std::vector<Face> faces{
+    {{0.0, 0.0, 0.0}, {0.0, size, 0.0}, {size, 0.0, 0.0}, n},      // floor
+    {{0.0, 0.0, size}, {size, 0.0, 0.0}, {0.0, size, 0.0}, nRoof},  // roof
+    {{0.0, 0.0, 0.0}, {size, 0.0, 0.0}, {0.0, 0.0, size}, n},      // south
+    {{0.0, size, 0.0}, {0.0, 0.0, size}, {size, 0.0, 0.0}, n},     // north
+    {{0.0, 0.0, 0.0}, {0.0, 0.0, size}, {0.0, size, 0.0}, n},      // west
+    {{size, 0.0, 0.0}, {0.0, size, 0.0}, {0.0, 0.0, size}, n},     // east
+  };
+
+  std::vector<Surface3d> surfaces;
+  for (const auto& face : faces) {
+    auto point = [&face](int i, int j) {
+      return face.origin + (static_cast<double>(i) / face.n) * face.u + (static_cast<double>(j) / face.n) * face.v;
+    };
+    for (int i = 0; i < face.n; ++i) {
+      for (int j = 0; j < face.n; ++j) {
+        const size_t surfNum = surfaces.size();
+        surfaces.emplace_back(std::vector<Point3d>{point(i, j), point(i + 1, j), point(i + 1, j + 1), point(i, j + 1)},
+                              "Facet " + std::to_string(surfNum), surfNum);
+      }
+    }
+  }
+  return surfaces;
+}
+
+// Every edge matches another one directly
+static void BM_PolyhedronEnclosed(benchmark::State& state) {
+  const std::vector<Surface3d> surfaces = makeFacetedCube(state.range(0), state.range(0));
+
+  for (auto _ : state) {
+    Polyhedron zonePoly(surfaces);
+    OS_ASSERT(zonePoly.isEnclosedVolume());
+    benchmark::DoNotOptimize(zonePoly);
+  }
+
+  state.SetComplexityN(surfaces.size());
+}
+
+// The roof facets do not line up with the walls, so the edges along the roof have to be split before matching again
+static void BM_PolyhedronSplitEdges(benchmark::State& state) {
+  const std::vector<Surface3d> surfaces = makeFacetedCube(state.range(0), state.range(0) + 1);
+
+  for (auto _ : state) {
+    Polyhedron zonePoly(surfaces);
+    OS_ASSERT(zonePoly.isEnclosedVolume());
+    benchmark::DoNotOptimize(zonePoly);
+  }
+
+  state.SetComplexityN(surfaces.size());
+}
+
+// What Space::cacheGeometryDiagnostics and the space diagnostics do once the Polyhedron is built
+static void BM_PolyhedronDiagnostics(benchmark::State& state) {
+  std::vector<Surface3d> surfaces = makeFacetedCube(state.range(0), state.range(0));
+  surfaces.pop_back();
+  const Polyhedron zonePoly(surfaces);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(zonePoly.edgesNotTwo());
+    benchmark::DoNotOptimize(zonePoly.uniqueEdges());
+  }
+
+  state.SetComplexityN(surfaces.size());
+}
+
+BENCHMARK(BM_PolyhedronEnclosed)->RangeMultiplier(2)->Range(2, 32)->Complexity();
+BENCHMARK(BM_PolyhedronSplitEdges)->RangeMultiplier(2)->Range(2, 32)->Complexity();
+BENCHMARK(BM_PolyhedronDiagnostics)->RangeMultiplier(2)->Range(2, 32)->Complexity();
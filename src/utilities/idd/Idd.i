@@ -58,6 +58,11 @@
 // ignore ostream related functions
 %ignore print(std::ostream&, bool) const;
 
+// ignore loading from the static tables written by GenerateIddFactory
+%ignore openstudio::IddKey::load(const IddKeyTable&);
+%ignore openstudio::IddField::load(const IddFieldTable&, const std::string&);
+%ignore openstudio::IddObject::load(const IddObjectTable&, IddObjectType);
+
 // include the headers into the swig interface directly
 %include <utilities/idd/IddEnums.hpp>
 
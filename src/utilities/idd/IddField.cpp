@@ -5,7 +5,9 @@
 
 #include "IddField.hpp"
 #include "IddField_Impl.hpp"
+#include "IddTables.hpp"
 
+#include "IddPropertyParser.hpp"
 #include "IddRegex.hpp"
 #include "CommentRegex.hpp"
 #include <utilities/idd/IddFactory.hxx>
@@ -217,6 +219,55 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IddField_Impl> IddField_Impl::load(const IddFieldTable& table, const std::string& objectName) {
+
+    std::shared_ptr<IddField_Impl> result(new IddField_Impl(table.name, objectName));
+    result->m_fieldId = table.fieldId;
+
+    IddFieldProperties& properties = result->m_properties;
+    properties.type = IddFieldType(table.type);
+    properties.note = table.note;
+    properties.required = table.required;
+    properties.autosizable = table.autosizable;
+    properties.autocalculatable = table.autocalculatable;
+    properties.retaincase = table.retaincase;
+    properties.deprecated = table.deprecated;
+    properties.beginExtensible = table.beginExtensible;
+    if (table.units) {
+      properties.units = std::string(table.units);
+    }
+    if (table.ipUnits) {
+      properties.ipUnits = std::string(table.ipUnits);
+    }
+    properties.minBoundType = table.minBoundType;
+    if (table.minBoundText) {
+      properties.minBoundValue = table.minBoundValue;
+      properties.minBoundText = std::string(table.minBoundText);
+    }
+    properties.maxBoundType = table.maxBoundType;
+    if (table.maxBoundText) {
+      properties.maxBoundValue = table.maxBoundValue;
+      properties.maxBoundText = std::string(table.maxBoundText);
+    }
+    if (table.stringDefault) {
+      properties.stringDefault = std::string(table.stringDefault);
+    }
+    if (table.hasNumericDefault) {
+      properties.numericDefault = table.numericDefault;
+    }
+    properties.objectLists.assign(table.objectLists, table.objectLists + table.numObjectLists);
+    properties.references.assign(table.references, table.references + table.numReferences);
+    properties.referenceClassNames.assign(table.referenceClassNames, table.referenceClassNames + table.numReferenceClassNames);
+    properties.externalLists.assign(table.externalLists, table.externalLists + table.numExternalLists);
+
+    result->m_keys.reserve(table.numKeys);
+    for (unsigned i = 0; i < table.numKeys; ++i) {
+      result->m_keys.push_back(IddKey::load(table.keys[i]));
+    }
+
+    return result;
+  }
+
   std::ostream& IddField_Impl::print(std::ostream& os, bool lastField) const {
     std::string separator = (lastField ? std::string(";") : std::string(","));
 
@@ -303,246 +354,109 @@ namespace detail {
   }
 
   void IddField_Impl::parseProperty(const std::string& text) {
-    // this function is called very often and has been identified as a bottleneck
-    // that is why some of the optimizations below have been applied
-
     if (text.empty()) {
       return;
     }
 
-    bool notHandled = true;
-    boost::smatch matches;
-
-    std::string lowerText = openstudio::ascii_to_lower_copy(text);
-
-    const char index = lowerText[0];
+    using iddPropertyParser::FieldPropertyKind;
 
-    //sort inside the case statements based on the probability of that value being in the string.(so we don't run 5 unlikely
-    //regex tofind the likely one) Keep the case statements in aphabitical order for ease of maintance, since it doesn't
-    //effect the speed
-    switch (index) {
+    boost::optional<iddPropertyParser::FieldProperty> property = iddPropertyParser::parseFieldProperty(text);
+    if (!property) {
+      LOG_AND_THROW("Unknown field property text '" << text << "' detected in field '" << m_name << "'");
+    }
 
-      case 'a': {
-        if (boost::algorithm::starts_with(lowerText, "autosizable")) {
-          m_properties.autosizable = true;
-          notHandled = false;
-        } else if (boost::algorithm::starts_with(lowerText, "autocalculatable")) {
-          m_properties.autocalculatable = true;
-          notHandled = false;
-        }
+    std::string& value = property->value;
+    switch (property->kind) {
+      case FieldPropertyKind::Autosizable:
+        m_properties.autosizable = true;
         break;
-      }
-      case 'b': {
-        if (boost::algorithm::starts_with(lowerText, "begin-extensible")) {
-          m_properties.beginExtensible = true;
-          notHandled = false;
-        }
+      case FieldPropertyKind::Autocalculatable:
+        m_properties.autocalculatable = true;
         break;
-      }
-
-      case 'd': {
-        if (boost::algorithm::starts_with(lowerText, "default")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::defaultProperty()));
-          std::string stringDefault(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(stringDefault);
-          m_properties.stringDefault = stringDefault;
-          notHandled = false;
-          // if we are numeric type and not set to autosize, set the numeric property
-          if ((m_properties.type == IddFieldType::RealType) || (m_properties.type == IddFieldType::IntegerType)) {
-            if (!boost::regex_match(text, iddRegex::automaticDefault())) {
-              m_properties.numericDefault = boost::lexical_cast<double>(stringDefault);
-            } else {
-              // otherwise this is -9999
-              m_properties.numericDefault = -9999;
-            }
+      case FieldPropertyKind::BeginExtensible:
+        m_properties.beginExtensible = true;
+        break;
+      case FieldPropertyKind::Default:
+        m_properties.stringDefault = value;
+        // if we are numeric type and not set to autosize, set the numeric property
+        if ((m_properties.type == IddFieldType::RealType) || (m_properties.type == IddFieldType::IntegerType)) {
+          if (!property->automaticDefault) {
+            m_properties.numericDefault = boost::lexical_cast<double>(value);
+          } else {
+            // otherwise this is -9999
+            m_properties.numericDefault = -9999;
           }
-        } else if (boost::algorithm::starts_with(lowerText, "deprecated")) {
-          m_properties.deprecated = true;
-          notHandled = false;
         }
         break;
-      }
-      case 'e': {
-        if (boost::algorithm::starts_with(lowerText, "external-list")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::externalListProperty()));
-          std::string externalList(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(externalList);
-          m_properties.externalLists.push_back(externalList);
-          notHandled = false;
-        }
-
+      case FieldPropertyKind::Deprecated:
+        m_properties.deprecated = true;
         break;
-      }
-      case 'f': {
-        if (boost::algorithm::starts_with(lowerText, "field")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::nameProperty()));
-          std::string fieldName(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(fieldName);
-          notHandled = false;
-          if (!boost::equals(m_name, fieldName)) {
-            LOG_AND_THROW("Field name '" << fieldName << "' does not match expected '" << m_name << "' in object '" << m_objectName << "'");
-          }
-        }
+      case FieldPropertyKind::ExternalList:
+        m_properties.externalLists.push_back(value);
         break;
-      }
-      case 'i': {
-        if (boost::algorithm::starts_with(lowerText, "ip-units")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::ipUnitsProperty()));
-          std::string ipUnits(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(ipUnits);
-          m_properties.ipUnits = ipUnits;
-          notHandled = false;
+      case FieldPropertyKind::Field:
+        if (!boost::equals(m_name, value)) {
+          LOG_AND_THROW("Field name '" << value << "' does not match expected '" << m_name << "' in object '" << m_objectName << "'");
         }
         break;
-      }
-
-      case 'k': {
-        if (boost::algorithm::starts_with(lowerText, "key")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::keyProperty()));
-          std::string keyText(matches[1].first, matches[1].second);
-          notHandled = false;
-          boost::smatch keyMatches;
-          if (boost::regex_search(keyText, keyMatches, iddRegex::contentAndCommentLine())) {
-            std::string keyName(keyMatches[1].first, keyMatches[1].second);
-            openstudio::ascii_trim(keyName);
-
-            // construct the key
-            OptionalIddKey key = IddKey::load(keyName, keyText);
-
-            // add the key to the keys
-            if (key) {
-              m_keys.push_back(*key);
-            } else {
-              LOG_AND_THROW("Key could not be loaded from text '" << keyText << "'.");
-            }
-
-          } else {
-            LOG_AND_THROW("Key name could not be determined from text '" << keyText << "'.");
-          }
-        }
+      case FieldPropertyKind::IPUnits:
+        m_properties.ipUnits = value;
         break;
-      }
-      case 'm': {
-        if (boost::algorithm::starts_with(lowerText, "minimum")) {
-          if (boost::regex_search(text, matches, iddRegex::minExclusiveProperty())) {
-            m_properties.minBoundType = IddFieldProperties::ExclusiveBound;
-            std::string minExclusive(matches[1].first, matches[1].second);
-            openstudio::ascii_trim(minExclusive);
-            m_properties.minBoundValue = boost::lexical_cast<double>(minExclusive);
-            m_properties.minBoundText = minExclusive;
-            notHandled = false;
-          } else if (boost::regex_search(text, matches, iddRegex::minInclusiveProperty())) {
-            m_properties.minBoundType = IddFieldProperties::InclusiveBound;
-            std::string minInclusive(matches[1].first, matches[1].second);
-            openstudio::ascii_trim(minInclusive);
-            m_properties.minBoundValue = boost::lexical_cast<double>(minInclusive);
-            m_properties.minBoundText = minInclusive;
-            notHandled = false;
-          }
-        } else if (boost::algorithm::starts_with(lowerText, "maximum")) {
-          if (boost::regex_search(text, matches, iddRegex::maxExclusiveProperty())) {
-            m_properties.maxBoundType = IddFieldProperties::ExclusiveBound;
-            std::string maxExclusive(matches[1].first, matches[1].second);
-            openstudio::ascii_trim(maxExclusive);
-            m_properties.maxBoundValue = boost::lexical_cast<double>(maxExclusive);
-            m_properties.maxBoundText = maxExclusive;
-            notHandled = false;
-          } else if (boost::regex_search(text, matches, iddRegex::maxInclusiveProperty())) {
-            m_properties.maxBoundType = IddFieldProperties::InclusiveBound;
-            std::string maxInclusive(matches[1].first, matches[1].second);
-            openstudio::ascii_trim(maxInclusive);
-            m_properties.maxBoundValue = boost::lexical_cast<double>(maxInclusive);
-            m_properties.maxBoundText = maxInclusive;
-            notHandled = false;
-          }
-        } else if (boost::algorithm::starts_with(lowerText, "memo")) {
-          notHandled = false;
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::memoProperty()));
-          std::string memo(matches[1].first, matches[1].second);
-          trim(memo);
-          if (m_properties.note.empty()) {
-            m_properties.note = memo;
-          } else {
-            m_properties.note += "\n" + memo;
-          }
+      case FieldPropertyKind::Key: {
+        // construct the key
+        OptionalIddKey key = IddKey::load(value, property->keyText);
+
+        // add the key to the keys
+        if (key) {
+          m_keys.push_back(*key);
+        } else {
+          LOG_AND_THROW("Key could not be loaded from text '" << property->keyText << "'.");
         }
         break;
       }
-      case 'n': {
-        if (boost::algorithm::starts_with(lowerText, "note")) {
-          notHandled = false;
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::noteProperty()));
-          std::string note(matches[1].first, matches[1].second);
-          trim(note);
-          if (m_properties.note.empty()) {
-            m_properties.note = note;
-          } else {
-            m_properties.note += "\n" + note;
-          }
-        }
+      case FieldPropertyKind::MinimumExclusive:
+      case FieldPropertyKind::MinimumInclusive:
+        m_properties.minBoundType =
+          (property->kind == FieldPropertyKind::MinimumExclusive) ? IddFieldProperties::ExclusiveBound : IddFieldProperties::InclusiveBound;
+        m_properties.minBoundValue = boost::lexical_cast<double>(value);
+        m_properties.minBoundText = value;
         break;
-      }
-      case 'o': {
-        if (boost::algorithm::starts_with(lowerText, "object-list")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::objectListProperty()));
-          std::string objectList(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(objectList);
-          m_properties.objectLists.push_back(objectList);
-          notHandled = false;
-        }
+      case FieldPropertyKind::MaximumExclusive:
+      case FieldPropertyKind::MaximumInclusive:
+        m_properties.maxBoundType =
+          (property->kind == FieldPropertyKind::MaximumExclusive) ? IddFieldProperties::ExclusiveBound : IddFieldProperties::InclusiveBound;
+        m_properties.maxBoundValue = boost::lexical_cast<double>(value);
+        m_properties.maxBoundText = value;
         break;
-      }
-      case 'r': {
-        if (boost::algorithm::starts_with(lowerText, "required-field")) {
-          m_properties.required = true;
-          notHandled = false;
-        } else if (boost::algorithm::starts_with(lowerText, "reference-class-name")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::referenceClassNameProperty()));
-          std::string reference(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(reference);
-          m_properties.referenceClassNames.push_back(reference);
-          notHandled = false;
-        } else if (boost::algorithm::starts_with(lowerText, "reference")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::referenceProperty()));
-          std::string reference(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(reference);
-          m_properties.references.push_back(reference);
-          notHandled = false;
-        } else if (boost::algorithm::starts_with(lowerText, "retaincase")) {
-          m_properties.retaincase = true;
-          notHandled = false;
+      case FieldPropertyKind::Memo:
+      case FieldPropertyKind::Note:
+        if (m_properties.note.empty()) {
+          m_properties.note = value;
+        } else {
+          m_properties.note += "\n" + value;
         }
         break;
-      }
-
-      case 't': {
-        if (boost::algorithm::starts_with(lowerText, "type")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::typeProperty()));
-          std::string fieldType(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(fieldType);
-          m_properties.type = IddFieldType(fieldType);
-          notHandled = false;
-        }
+      case FieldPropertyKind::ObjectList:
+        m_properties.objectLists.push_back(value);
         break;
-      }
-      case 'u': {
-        if (boost::algorithm::starts_with(lowerText, "unitsBasedOnField")) {
-          // unhandled
-          //I like how we spend time comparing to this, but then don't handle it!
-          notHandled = false;
-        } else if (boost::algorithm::starts_with(lowerText, "units")) {
-          OS_ASSERT(boost::regex_search(text, matches, iddRegex::unitsProperty()));
-          std::string units(matches[1].first, matches[1].second);
-          openstudio::ascii_trim(units);
-          m_properties.units = units;
-          notHandled = false;
-        }
+      case FieldPropertyKind::Required:
+        m_properties.required = true;
+        break;
+      case FieldPropertyKind::ReferenceClassName:
+        m_properties.referenceClassNames.push_back(value);
+        break;
+      case FieldPropertyKind::Reference:
+        m_properties.references.push_back(value);
+        break;
+      case FieldPropertyKind::RetainCase:
+        m_properties.retaincase = true;
+        break;
+      case FieldPropertyKind::Type:
+        m_properties.type = IddFieldType(value);
+        break;
+      case FieldPropertyKind::Units:
+        m_properties.units = value;
         break;
-      }
-    }
-
-    if (notHandled) {
-      LOG_AND_THROW("Unknown field property text '" << text << "' detected in field '" << m_name << "'");
     }
   }
 
@@ -625,6 +539,10 @@ OptionalIddField IddField::load(const std::string& name, const std::string& text
   }
 }
 
+IddField IddField::load(const IddFieldTable& table, const std::string& objectName) {
+  return IddField(detail::IddField_Impl::load(table, objectName));
+}
+
 // PRIVATE
 
 IddField::IddField(const std::shared_ptr<detail::IddField_Impl>& impl) : m_impl(impl) {}
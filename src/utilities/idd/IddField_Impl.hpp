@@ -20,6 +20,7 @@
 namespace openstudio {
 
 class Unit;
+struct IddFieldTable;
 
 namespace detail {
 
@@ -106,6 +107,9 @@ namespace detail {
      *  belongs. */
     static std::shared_ptr<IddField_Impl> load(const std::string& name, const std::string& text, const std::string& objectName);
 
+    /** Load the IddField from a table written by GenerateIddFactory. No text is parsed. */
+    static std::shared_ptr<IddField_Impl> load(const IddFieldTable& table, const std::string& objectName);
+
     /** Print the IddField to an output stream. Field slash codes are indented to produce pretty
      *  output. If lastField, then the field id will be followed by a semi-colon; otherwise, a
      *  comma will be used (consistent with IDD formatting). */
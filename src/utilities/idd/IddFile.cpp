@@ -86,11 +86,9 @@ namespace detail {
 
   boost::optional<IddObject> IddFile_Impl::getObject(const std::string& objectName) const {
     OptionalIddObject result;
-    for (const IddObject& object : m_objects) {
-      if (istringEqual(object.name(), objectName)) {
-        result = object;
-        break;
-      }
+    auto it = m_objectIndicesByName.find(boost::to_upper_copy(objectName));
+    if (it != m_objectIndicesByName.end()) {
+      result = m_objects[it->second];
     }
     return result;
   }
@@ -146,6 +144,8 @@ namespace detail {
   }
 
   void IddFile_Impl::addObject(const IddObject& object) {
+    // the first object of a given name wins, as it always has for getObject
+    m_objectIndicesByName.emplace(boost::to_upper_copy(object.name()), m_objects.size());
     m_objects.push_back(object);
   }
 
@@ -200,7 +200,7 @@ namespace detail {
     OptionalIddObject commentOnlyObject =
       IddObject::load(iddRegex::commentOnlyObjectName(), currentGroup, iddRegex::commentOnlyObjectText(), IddObjectType::CommentOnly);
     OS_ASSERT(commentOnlyObject);
-    m_objects.push_back(*commentOnlyObject);
+    addObject(*commentOnlyObject);
 
     // temp string to read file
     std::string line;
@@ -324,7 +324,7 @@ namespace detail {
 
         // construct a new object and put it in the object vector
         if (object) {
-          m_objects.push_back(*object);
+          addObject(*object);
         } else {
           LOG_AND_THROW("Unable to construct IddObject from text: " << '\n' << text);
         }
@@ -12,6 +12,7 @@
 
 #include <string>
 #include <ostream>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/algorithm/string.hpp>
@@ -110,6 +111,9 @@ namespace detail {
     /// The vector of IddObjects that constitute this IddFile.
     std::vector<IddObject> m_objects;
 
+    /// Index into m_objects by upper case object name, for getObject(const std::string&).
+    std::unordered_map<std::string, size_t> m_objectIndicesByName;
+
     /// Cache the Version IddObject
     mutable boost::optional<IddObject> m_versionObject;
 
@@ -5,6 +5,7 @@
 
 #include "IddKey.hpp"
 #include "IddKey_Impl.hpp"
+#include "IddTables.hpp"
 
 #include "IddRegex.hpp"
 
@@ -43,6 +44,12 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IddKey_Impl> IddKey_Impl::load(const IddKeyTable& table) {
+    std::shared_ptr<IddKey_Impl> result(new IddKey_Impl(table.name));
+    result->m_properties.note = table.note;
+    return result;
+  }
+
   std::ostream& IddKey_Impl::print(std::ostream& os) const {
     os << "       \\key " << m_name << '\n';
     return os;
@@ -99,6 +106,10 @@ OptionalIddKey IddKey::load(const std::string& name, const std::string& text) {
   }
 }
 
+IddKey IddKey::load(const IddKeyTable& table) {
+  return IddKey(detail::IddKey_Impl::load(table));
+}
+
 std::ostream& IddKey::print(std::ostream& os) const {
   return m_impl->print(os);
 }
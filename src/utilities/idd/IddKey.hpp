@@ -19,6 +19,7 @@
 namespace openstudio {
 
 struct IddKeyProperties;
+struct IddKeyTable;
 
 namespace detail {
   class IddKey_Impl;
@@ -64,6 +65,9 @@ class UTILITIES_API IddKey
   /** Load from text. */
   static boost::optional<IddKey> load(const std::string& name, const std::string& text);
 
+  /** Load from a table written by GenerateIddFactory. No text is parsed. */
+  static IddKey load(const IddKeyTable& table);
+
   /** Print to os in standard IDD format */
   std::ostream& print(std::ostream& os) const;
 
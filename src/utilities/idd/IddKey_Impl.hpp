@@ -17,6 +17,8 @@
 
 namespace openstudio {
 
+struct IddKeyTable;
+
 // private namespace
 namespace detail {
 
@@ -39,6 +41,9 @@ namespace detail {
     /// load by parsing text
     static std::shared_ptr<IddKey_Impl> load(const std::string& name, const std::string& text);
 
+    /// load from a table written by GenerateIddFactory
+    static std::shared_ptr<IddKey_Impl> load(const IddKeyTable& table);
+
     /// print idd
     std::ostream& print(std::ostream& os) const;
 
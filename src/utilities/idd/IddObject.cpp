@@ -7,7 +7,9 @@
 #include "IddObject_Impl.hpp"
 
 #include "ExtensibleIndex.hpp"
+#include "IddPropertyParser.hpp"
 #include "IddRegex.hpp"
+#include "IddTables.hpp"
 #include <utilities/idd/IddFactory.hxx>
 #include <utilities/idd/IddEnums.hxx>
 #include "IddKey.hpp"
@@ -393,6 +395,36 @@ namespace detail {
     return result;
   }
 
+  std::shared_ptr<IddObject_Impl> IddObject_Impl::load(const IddObjectTable& table, IddObjectType type) {
+    std::shared_ptr<IddObject_Impl> result(new IddObject_Impl(table.name, table.group, type));
+
+    IddObjectProperties& properties = result->m_properties;
+    properties.memo = table.memo;
+    properties.unique = table.unique;
+    properties.required = table.required;
+    properties.obsolete = table.obsolete;
+    properties.hasURL = table.hasURL;
+    properties.extensible = table.extensible;
+    properties.numExtensible = table.numExtensible;
+    properties.format = table.format;
+    properties.minFields = table.minFields;
+    if (table.hasMaxFields) {
+      properties.maxFields = table.maxFields;
+    }
+
+    result->m_fields.reserve(table.numFields);
+    for (unsigned i = 0; i < table.numFields; ++i) {
+      result->m_fields.push_back(IddField::load(table.fields[i], result->m_name));
+    }
+
+    // remove existing extensible fields and add them the the extensible list
+    if (properties.extensible) {
+      result->makeExtensible();
+    }
+
+    return result;
+  }
+
   /// print
   std::ostream& IddObject_Impl::print(std::ostream& os) const {
     if (m_fields.empty() && m_extensibleFields.empty()) {
@@ -546,50 +578,48 @@ namespace detail {
   }
 
   void IddObject_Impl::parseProperty(const std::string& text) {
-    smatch matches;
-    if (boost::regex_search(text, matches, iddRegex::memoProperty())) {
-      string memo(matches[1].first, matches[1].second);
-      openstudio::ascii_trim(memo);
-      if (m_properties.memo.empty()) {
-        m_properties.memo = memo;
-      } else {
-        m_properties.memo += "\n" + memo;
-      }
-
-    } else if (boost::regex_match(text, iddRegex::uniqueProperty())) {
-      m_properties.unique = true;
-
-    } else if (boost::regex_match(text, iddRegex::requiredObjectProperty())) {
-      m_properties.required = true;
-
-    } else if (boost::regex_match(text, iddRegex::obsoleteProperty())) {
-      m_properties.obsolete = true;
-
-    } else if (boost::regex_match(text, iddRegex::hasurlProperty())) {
-      m_properties.hasURL = true;
-
-    } else if (boost::regex_search(text, matches, iddRegex::extensibleProperty())) {
-      m_properties.extensible = true;
+    using iddPropertyParser::ObjectPropertyKind;
 
-      string numExtensible(matches[1].first, matches[1].second);
-      m_properties.numExtensible = boost::lexical_cast<unsigned>(numExtensible);
-
-    } else if (boost::regex_search(text, matches, iddRegex::formatProperty())) {
-      string format(matches[1].first, matches[1].second);
-      openstudio::ascii_trim(format);
-      m_properties.format = format;
-
-    } else if (boost::regex_search(text, matches, iddRegex::minFieldsProperty())) {
-      string minFields(matches[1].first, matches[1].second);
-      m_properties.minFields = boost::lexical_cast<unsigned>(minFields);
-
-    } else if (boost::regex_search(text, matches, iddRegex::maxFieldsProperty())) {
-      string maxFields(matches[1].first, matches[1].second);
-      m_properties.maxFields = boost::lexical_cast<unsigned>(maxFields);
-    } else {
+    boost::optional<iddPropertyParser::ObjectProperty> property = iddPropertyParser::parseObjectProperty(text);
+    if (!property) {
       // error, unknown property
       LOG_AND_THROW("Unknown property text '" << text << "' in object '" << m_name << "'");
     }
+
+    switch (property->kind) {
+      case ObjectPropertyKind::Memo:
+        if (m_properties.memo.empty()) {
+          m_properties.memo = property->value;
+        } else {
+          m_properties.memo += "\n" + property->value;
+        }
+        break;
+      case ObjectPropertyKind::Unique:
+        m_properties.unique = true;
+        break;
+      case ObjectPropertyKind::Required:
+        m_properties.required = true;
+        break;
+      case ObjectPropertyKind::Obsolete:
+        m_properties.obsolete = true;
+        break;
+      case ObjectPropertyKind::HasURL:
+        m_properties.hasURL = true;
+        break;
+      case ObjectPropertyKind::Extensible:
+        m_properties.extensible = true;
+        m_properties.numExtensible = boost::lexical_cast<unsigned>(property->value);
+        break;
+      case ObjectPropertyKind::Format:
+        m_properties.format = property->value;
+        break;
+      case ObjectPropertyKind::MinFields:
+        m_properties.minFields = boost::lexical_cast<unsigned>(property->value);
+        break;
+      case ObjectPropertyKind::MaxFields:
+        m_properties.maxFields = boost::lexical_cast<unsigned>(property->value);
+        break;
+    }
   }
 
   void IddObject_Impl::parseFields(const std::string& text) {
@@ -796,6 +826,10 @@ boost::optional<IddObject> IddObject::load(const std::string& name, const std::s
   return load(name, group, text, IddObjectType(IddObjectType::UserCustom));
 }
 
+IddObject IddObject::load(const IddObjectTable& table, IddObjectType type) {
+  return IddObject(detail::IddObject_Impl::load(table, type));
+}
+
 std::ostream& IddObject::print(std::ostream& os) const {
   return m_impl->print(os);
 }
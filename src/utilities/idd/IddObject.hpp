@@ -22,6 +22,7 @@ namespace openstudio {
 // forward declarations
 class ExtensibleIndex;
 struct IddObjectType;
+struct IddObjectTable;
 
 namespace detail {
   class IddObject_Impl;
@@ -176,6 +177,10 @@ class UTILITIES_API IddObject
   /** \overload Sets type to IddObjectType::UserCustom. */
   static boost::optional<IddObject> load(const std::string& name, const std::string& group, const std::string& text);
 
+  /** Load from a table written by GenerateIddFactory. Used by the IddFactory to construct its
+   *  objects without parsing any IDD text. */
+  static IddObject load(const IddObjectTable& table, IddObjectType type);
+
   /** Print this object to os, in standard IDD format. */
   std::ostream& print(std::ostream& os) const;
 
@@ -24,6 +24,7 @@ namespace openstudio {
 
 // forward declarations
 class ExtensibleIndex;
+struct IddObjectTable;
 
 namespace detail {
 
@@ -152,6 +153,9 @@ namespace detail {
     /** Load from name, group, type, and text. */
     static std::shared_ptr<IddObject_Impl> load(const std::string& name, const std::string& group, const std::string& text, IddObjectType type);
 
+    /** Load from a table written by GenerateIddFactory. */
+    static std::shared_ptr<IddObject_Impl> load(const IddObjectTable& table, IddObjectType type);
+
     // print
     std::ostream& print(std::ostream& os) const;
 
@@ -0,0 +1,203 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "IddPropertyParser.hpp"
+
+#include "IddRegex.hpp"
+
+#include "../core/ASCIIStrings.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+namespace openstudio {
+namespace iddPropertyParser {
+
+  namespace {
+
+    std::string captured(const boost::smatch& matches, int index) {
+      return {matches[index].first, matches[index].second};
+    }
+
+    std::string trimmedCapture(const boost::smatch& matches) {
+      std::string result = captured(matches, 1);
+      openstudio::ascii_trim(result);
+      return result;
+    }
+
+    // trimmed text captured by regex, none if regex does not match
+    boost::optional<std::string> trimmedValue(const std::string& text, const boost::regex& regex) {
+      boost::smatch matches;
+      if (!boost::regex_search(text, matches, regex)) {
+        return boost::none;
+      }
+      return trimmedCapture(matches);
+    }
+
+    boost::optional<FieldProperty> fieldProperty(FieldPropertyKind kind, boost::optional<std::string> value = std::string()) {
+      if (!value) {
+        return boost::none;
+      }
+      return FieldProperty{kind, std::move(*value)};
+    }
+
+  }  // namespace
+
+  boost::optional<ObjectProperty> parseObjectProperty(const std::string& text) {
+    boost::smatch matches;
+    if (boost::regex_search(text, matches, iddRegex::memoProperty())) {
+      return ObjectProperty{ObjectPropertyKind::Memo, trimmedCapture(matches)};
+    } else if (boost::regex_match(text, iddRegex::uniqueProperty())) {
+      return ObjectProperty{ObjectPropertyKind::Unique, std::string()};
+    } else if (boost::regex_match(text, iddRegex::requiredObjectProperty())) {
+      return ObjectProperty{ObjectPropertyKind::Required, std::string()};
+    } else if (boost::regex_match(text, iddRegex::obsoleteProperty())) {
+      return ObjectProperty{ObjectPropertyKind::Obsolete, std::string()};
+    } else if (boost::regex_match(text, iddRegex::hasurlProperty())) {
+      return ObjectProperty{ObjectPropertyKind::HasURL, std::string()};
+    } else if (boost::regex_search(text, matches, iddRegex::extensibleProperty())) {
+      return ObjectProperty{ObjectPropertyKind::Extensible, captured(matches, 1)};
+    } else if (boost::regex_search(text, matches, iddRegex::formatProperty())) {
+      return ObjectProperty{ObjectPropertyKind::Format, trimmedCapture(matches)};
+    } else if (boost::regex_search(text, matches, iddRegex::minFieldsProperty())) {
+      return ObjectProperty{ObjectPropertyKind::MinFields, captured(matches, 1)};
+    } else if (boost::regex_search(text, matches, iddRegex::maxFieldsProperty())) {
+      return ObjectProperty{ObjectPropertyKind::MaxFields, captured(matches, 1)};
+    }
+    return boost::none;
+  }
+
+  boost::optional<FieldProperty> parseFieldProperty(const std::string& text) {
+    // this function is called very often and has been identified as a bottleneck
+    // dispatch on the first letter so that only the likely regexes are run
+
+    if (text.empty()) {
+      return boost::none;
+    }
+
+    boost::smatch matches;
+    std::string lowerText = openstudio::ascii_to_lower_copy(text);
+
+    switch (lowerText[0]) {
+      case 'a': {
+        if (boost::algorithm::starts_with(lowerText, "autosizable")) {
+          return fieldProperty(FieldPropertyKind::Autosizable);
+        } else if (boost::algorithm::starts_with(lowerText, "autocalculatable")) {
+          return fieldProperty(FieldPropertyKind::Autocalculatable);
+        }
+        break;
+      }
+      case 'b': {
+        if (boost::algorithm::starts_with(lowerText, "begin-extensible")) {
+          return fieldProperty(FieldPropertyKind::BeginExtensible);
+        }
+        break;
+      }
+      case 'd': {
+        if (boost::algorithm::starts_with(lowerText, "default")) {
+          boost::optional<FieldProperty> result = fieldProperty(FieldPropertyKind::Default, trimmedValue(text, iddRegex::defaultProperty()));
+          if (result) {
+            result->automaticDefault = boost::regex_match(text, iddRegex::automaticDefault());
+          }
+          return result;
+        } else if (boost::algorithm::starts_with(lowerText, "deprecated")) {
+          return fieldProperty(FieldPropertyKind::Deprecated);
+        }
+        break;
+      }
+      case 'e': {
+        if (boost::algorithm::starts_with(lowerText, "external-list")) {
+          return fieldProperty(FieldPropertyKind::ExternalList, trimmedValue(text, iddRegex::externalListProperty()));
+        }
+        break;
+      }
+      case 'f': {
+        if (boost::algorithm::starts_with(lowerText, "field")) {
+          return fieldProperty(FieldPropertyKind::Field, trimmedValue(text, iddRegex::nameProperty()));
+        }
+        break;
+      }
+      case 'i': {
+        if (boost::algorithm::starts_with(lowerText, "ip-units")) {
+          return fieldProperty(FieldPropertyKind::IPUnits, trimmedValue(text, iddRegex::ipUnitsProperty()));
+        }
+        break;
+      }
+      case 'k': {
+        if (boost::algorithm::starts_with(lowerText, "key") && boost::regex_search(text, matches, iddRegex::keyProperty())) {
+          std::string keyText = captured(matches, 1);
+          boost::smatch keyMatches;
+          if (boost::regex_search(keyText, keyMatches, iddRegex::contentAndCommentLine())) {
+            FieldProperty result{FieldPropertyKind::Key, trimmedCapture(keyMatches)};
+            result.keyNote = captured(keyMatches, 2);
+            result.keyText = std::move(keyText);
+            return result;
+          }
+        }
+        break;
+      }
+      case 'm': {
+        if (boost::algorithm::starts_with(lowerText, "minimum")) {
+          if (boost::regex_search(text, matches, iddRegex::minExclusiveProperty())) {
+            return fieldProperty(FieldPropertyKind::MinimumExclusive, trimmedCapture(matches));
+          } else if (boost::regex_search(text, matches, iddRegex::minInclusiveProperty())) {
+            return fieldProperty(FieldPropertyKind::MinimumInclusive, trimmedCapture(matches));
+          }
+        } else if (boost::algorithm::starts_with(lowerText, "maximum")) {
+          if (boost::regex_search(text, matches, iddRegex::maxExclusiveProperty())) {
+            return fieldProperty(FieldPropertyKind::MaximumExclusive, trimmedCapture(matches));
+          } else if (boost::regex_search(text, matches, iddRegex::maxInclusiveProperty())) {
+            return fieldProperty(FieldPropertyKind::MaximumInclusive, trimmedCapture(matches));
+          }
+        } else if (boost::algorithm::starts_with(lowerText, "memo") && boost::regex_search(text, matches, iddRegex::memoProperty())) {
+          return fieldProperty(FieldPropertyKind::Memo, boost::algorithm::trim_copy(captured(matches, 1)));
+        }
+        break;
+      }
+      case 'n': {
+        if (boost::algorithm::starts_with(lowerText, "note") && boost::regex_search(text, matches, iddRegex::noteProperty())) {
+          return fieldProperty(FieldPropertyKind::Note, boost::algorithm::trim_copy(captured(matches, 1)));
+        }
+        break;
+      }
+      case 'o': {
+        if (boost::algorithm::starts_with(lowerText, "object-list")) {
+          return fieldProperty(FieldPropertyKind::ObjectList, trimmedValue(text, iddRegex::objectListProperty()));
+        }
+        break;
+      }
+      case 'r': {
+        if (boost::algorithm::starts_with(lowerText, "required-field")) {
+          return fieldProperty(FieldPropertyKind::Required);
+        } else if (boost::algorithm::starts_with(lowerText, "reference-class-name")) {
+          return fieldProperty(FieldPropertyKind::ReferenceClassName, trimmedValue(text, iddRegex::referenceClassNameProperty()));
+        } else if (boost::algorithm::starts_with(lowerText, "reference")) {
+          return fieldProperty(FieldPropertyKind::Reference, trimmedValue(text, iddRegex::referenceProperty()));
+        } else if (boost::algorithm::starts_with(lowerText, "retaincase")) {
+          return fieldProperty(FieldPropertyKind::RetainCase);
+        }
+        break;
+      }
+      case 't': {
+        if (boost::algorithm::starts_with(lowerText, "type")) {
+          return fieldProperty(FieldPropertyKind::Type, trimmedValue(text, iddRegex::typeProperty()));
+        }
+        break;
+      }
+      case 'u': {
+        // also catches \unitsBasedOnField, see FieldProperty::value
+        if (boost::algorithm::starts_with(lowerText, "units")) {
+          return fieldProperty(FieldPropertyKind::Units, trimmedValue(text, iddRegex::unitsProperty()));
+        }
+        break;
+      }
+      default:
+        break;
+    }
+
+    return boost::none;
+  }
+
+}  // namespace iddPropertyParser
+}  // namespace openstudio
@@ -0,0 +1,93 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDD_IDDPROPERTYPARSER_HPP
+#define UTILITIES_IDD_IDDPROPERTYPARSER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/optional.hpp>
+
+#include <string>
+
+namespace openstudio {
+namespace iddPropertyParser {
+
+  /// kinds of object properties, e.g. \\memo or \\extensible:4
+  enum class ObjectPropertyKind
+  {
+    Memo,
+    Unique,
+    Required,
+    Obsolete,
+    HasURL,
+    Extensible,
+    Format,
+    MinFields,
+    MaxFields
+  };
+
+  /// one object property read from IDD text
+  struct ObjectProperty
+  {
+    ObjectPropertyKind kind;
+    /// trimmed memo or format, number of fields for Extensible, MinFields and MaxFields, empty for flags
+    std::string value;
+  };
+
+  /// Parse the text of one object property, without the leading '\\'. Returns none if the property is unknown.
+  /// Shared by IddObject and GenerateIddFactory, so that static IDD tables match the parsed IDD.
+  UTILITIES_API boost::optional<ObjectProperty> parseObjectProperty(const std::string& text);
+
+  /// kinds of field properties, e.g. \\default or \\key
+  enum class FieldPropertyKind
+  {
+    Autosizable,
+    Autocalculatable,
+    BeginExtensible,
+    Default,
+    Deprecated,
+    ExternalList,
+    Field,
+    IPUnits,
+    Key,
+    MinimumExclusive,
+    MinimumInclusive,
+    MaximumExclusive,
+    MaximumInclusive,
+    Memo,
+    Note,
+    ObjectList,
+    Required,
+    ReferenceClassName,
+    Reference,
+    RetainCase,
+    Type,
+    Units
+  };
+
+  /// one field property read from IDD text
+  struct FieldProperty
+  {
+    FieldPropertyKind kind;
+    /// trimmed text following the property name, the key name for Key, empty for flags. \\unitsBasedOnField A2 is read
+    /// as Units with value "BasedOnField A2"
+    std::string value;
+    /// Default only, value is autosize or autocalculate
+    bool automaticDefault = false;
+    /// Key only, text following \\key, including any comment
+    std::string keyText;
+    /// Key only, comment following the key name
+    std::string keyNote;
+  };
+
+  /// Parse the text of one field property, without the leading '\\'. Returns none if the property is unknown or
+  /// cannot be read. Shared by IddField and GenerateIddFactory, so that static IDD tables match the parsed IDD.
+  UTILITIES_API boost::optional<FieldProperty> parseFieldProperty(const std::string& text);
+
+}  // namespace iddPropertyParser
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDD_IDDPROPERTYPARSER_HPP
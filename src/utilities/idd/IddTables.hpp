@@ -0,0 +1,81 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDD_IDDTABLES_HPP
+#define UTILITIES_IDD_IDDTABLES_HPP
+
+#include "IddFieldProperties.hpp"
+
+namespace openstudio {
+
+/** Static, pre-parsed description of an IddKey. Written by GenerateIddFactory so that the
+ *  IddFactory can construct its objects without parsing IDD text at runtime. */
+struct IddKeyTable
+{
+  const char* name = "";
+  const char* note = "";
+};
+
+/** Static, pre-parsed description of an IddField, see IddKeyTable. Unset optional properties are
+ *  nullptr, lists are given as a pointer to their first element and a size. */
+struct IddFieldTable
+{
+  const char* fieldId = "";
+  const char* name = "";
+  IddFieldType::domain type = IddFieldType::UnknownType;
+  const char* note = "";
+  bool required = false;
+  bool autosizable = false;
+  bool autocalculatable = false;
+  bool retaincase = false;
+  bool deprecated = false;
+  bool beginExtensible = false;
+  const char* units = nullptr;
+  const char* ipUnits = nullptr;
+  IddFieldProperties::BoundTypes minBoundType = IddFieldProperties::Unbounded;
+  double minBoundValue = 0.0;
+  const char* minBoundText = nullptr;
+  IddFieldProperties::BoundTypes maxBoundType = IddFieldProperties::Unbounded;
+  double maxBoundValue = 0.0;
+  const char* maxBoundText = nullptr;
+  const char* stringDefault = nullptr;
+  bool hasNumericDefault = false;
+  double numericDefault = 0.0;
+  const char* const* objectLists = nullptr;
+  unsigned numObjectLists = 0;
+  const char* const* references = nullptr;
+  unsigned numReferences = 0;
+  const char* const* referenceClassNames = nullptr;
+  unsigned numReferenceClassNames = 0;
+  const char* const* externalLists = nullptr;
+  unsigned numExternalLists = 0;
+  const IddKeyTable* keys = nullptr;
+  unsigned numKeys = 0;
+};
+
+/** Static, pre-parsed description of an IddObject, see IddKeyTable. Fields are listed as they
+ *  appear in the IDD, the extensible group is split off when the IddObject is constructed. */
+struct IddObjectTable
+{
+  const char* name = "";
+  const char* group = "";
+  const char* memo = "";
+  bool unique = false;
+  bool required = false;
+  bool obsolete = false;
+  bool hasURL = false;
+  bool extensible = false;
+  unsigned numExtensible = 0;
+  const char* format = "";
+  unsigned minFields = 0;
+  bool hasMaxFields = false;
+  unsigned maxFields = 0;
+  const IddFieldTable* fields = nullptr;
+  unsigned numFields = 0;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDD_IDDTABLES_HPP
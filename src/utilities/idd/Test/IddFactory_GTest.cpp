@@ -75,6 +75,24 @@ TEST_F(IddFixture, IddFactory_IddFile) {
   EXPECT_TRUE(file.objects().size() == objects.size());
 }
 
+TEST_F(IddFixture, IddFactory_StaticTablesMatchParsedIdd) {
+  // the factory builds its objects from tables written by GenerateIddFactory, check them against the parsed idds
+  for (const auto& [fileType, path] : {std::pair(IddFileType(IddFileType::OpenStudio), toPath("model/OpenStudio.idd")),
+                                       std::pair(IddFileType(IddFileType::EnergyPlus), toPath("energyplus/ProposedEnergy+.idd"))}) {
+    OptionalIddFile parsedFile = IddFile::load(resourcesPath() / path);
+    ASSERT_TRUE(parsedFile) << path;
+    IddFile file = IddFactory::instance().getIddFile(fileType);
+    for (const IddObject& parsedObject : parsedFile->objects()) {
+      OptionalIddObject object = file.getObject(parsedObject.name());
+      ASSERT_TRUE(object) << parsedObject.name();
+      EXPECT_EQ(parsedObject.group(), object->group()) << parsedObject.name();
+      EXPECT_TRUE(parsedObject.properties() == object->properties()) << parsedObject.name();
+      EXPECT_TRUE(parsedObject.nonextensibleFields() == object->nonextensibleFields()) << parsedObject.name();
+      EXPECT_TRUE(parsedObject.extensibleGroup() == object->extensibleGroup()) << parsedObject.name();
+    }
+  }
+}
+
 TEST_F(IddFixture, IddFactory_isInFile) {
   EXPECT_TRUE(IddFactory::instance().isInFile(IddObjectType::Building, IddFileType::EnergyPlus));
   EXPECT_FALSE(IddFactory::instance().isInFile(IddObjectType::Building, IddFileType::OpenStudio));
@@ -9,6 +9,8 @@
 #include "../IddFile.hpp"
 #include "../../core/Filesystem.hpp"
 #include "../../core/Assert.hpp"
+#include <utilities/idd/IddFactory.hxx>
+#include <utilities/idd/IddEnums.hxx>
 
 #include <resources.hxx>
 
@@ -68,6 +70,22 @@ static void BM_ParseOpenStudioIdd(benchmark::State& state, const std::string& te
   }
 }
 
+// The IddFactory builds each IddObject once, on first use, from the static tables written by GenerateIddFactory.
+// The first iteration of the first benchmark run therefore measures the cold start, later iterations the cached lookup.
+static void BM_IddFactoryGetIddFile(benchmark::State& state, IddFileType iddFileType) {
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    IddFile iddFile = IddFactory::instance().getIddFile(iddFileType);
+    benchmark::DoNotOptimize(iddFile);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_IddFactoryGetIddFile, EnergyPlusColdStart, IddFileType::EnergyPlus)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IddFactoryGetIddFile, OpenStudioColdStart, IddFileType::OpenStudio)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IddFactoryGetIddFile, EnergyPlus, IddFileType::EnergyPlus)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IddFactoryGetIddFile, OpenStudio, IddFileType::OpenStudio)->Unit(benchmark::kMillisecond);
+
 BENCHMARK_CAPTURE(BM_ParseEnergyPlusIdd, Old, std::string("Old"))->Unit(benchmark::kMillisecond);
 // BENCHMARK_CAPTURE(BM_ParseEnergyPlusIdd, New, std::string("New"));
 // BENCHMARK_CAPTURE(BM_ParseEnergyPlusIdd, NewParallel, std::string("NewParallel"));
@@ -12,6 +12,7 @@
   #include <utilities/idf/ImfFile.hpp>
   #include <utilities/idf/Workspace.hpp>
   #include <utilities/idf/Workspace_Impl.hpp>
+  #include <utilities/idf/WorkspaceTransaction.hpp>
   #include <utilities/idf/WorkspaceWatcher.hpp>
   #include <utilities/idf/WorkspaceExtensibleGroup.hpp>
   #include <utilities/idf/WorkspaceObject.hpp>
@@ -161,6 +162,8 @@
 %feature("director") WorkspaceWatcher;
 %include <utilities/idf/WorkspaceWatcher.hpp>
 
+%include <utilities/idf/WorkspaceTransaction.hpp>
+
 %extend openstudio::IdfObject{
   std::string __str__() const {
     std::ostringstream os;
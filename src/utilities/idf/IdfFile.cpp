@@ -5,7 +5,7 @@
 
 #include "IdfFile.hpp"
 #include <utilities/idf/IdfObject_Impl.hpp>  // needed for serialization
-#include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddRegex.hpp"
@@ -150,6 +150,41 @@ void IdfFile::addObjects(const std::vector<IdfObject>& objects) {
   }
 }
 
+void IdfFile::addObjectCopy(const IdfObject& object) {
+  if (object.m_impl->hasSeparatorInFields()) {
+    // print and load this one so that its values are split up just as before
+    std::stringstream ss;
+    object.print(ss);
+    m_load(ss);
+    return;
+  }
+
+  IddObject iddObject;  // Catchall
+  IddObjectType objectType = object.iddObject().type();
+  if (objectType == IddObjectType::CommentOnly) {
+    if (OptionalIddObject candidate = m_iddFileAndFactoryWrapper.getObject(IddObjectType::CommentOnly)) {
+      iddObject = *candidate;
+    }
+  } else if (objectType == IddObjectType::Catchall) {
+    // Catchall objects keep the object type in their first field, it may be known to this Idd, as when loading the printed object
+    if (object.numFields() > 0u) {
+      std::string objectName = object.getString(0).get();
+      if (OptionalIddObject candidate = m_iddFileAndFactoryWrapper.getObject(objectName)) {
+        iddObject = *candidate;
+      } else {
+        LOG(Warn, "Cannot find object type '" + objectName + "' in Idd. Placing data in Catchall object.");
+      }
+    }
+  } else {
+    if (OptionalIddObject candidate = m_iddFileAndFactoryWrapper.getObject(object.iddObject().name())) {
+      iddObject = *candidate;
+    } else {
+      LOG(Warn, "Cannot find object type '" + object.iddObject().name() + "' in Idd. Placing data in Catchall object.");
+    }
+  }
+  addObject(IdfObject(std::make_shared<detail::IdfObject_Impl>(*object.m_impl, iddObject)));
+}
+
 void IdfFile::insertObjectByIddObjectType(const IdfObject& object) {
   for (auto it = m_objects.begin(), itEnd = m_objects.end(); it != itEnd; ++it) {
     if (it == itEnd || object.iddObject().type() < it->iddObject().type()) {
@@ -498,53 +533,31 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
 
 bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
 
-  [[maybe_unused]] int lineNum = 0;  // Idf line number
-  int objectNum = 0;                 // number of objects, first is #1
-  std::string line;                  // temp string to help with reading
-  boost::smatch matches;             // matches to regular expressions
-  std::string comment;               // keep running comment
-  bool firstBlock = true;            // to capture first comment block as the header
+  int objectNum = 0;       // number of objects, first is #1
+  std::string comment;     // keep running comment
+  bool firstBlock = true;  // to capture first comment block as the header
+
+  // read the whole file in one go, this also makes sure that no matter what line endings come in,
+  // they are converted to '\n'
+  const std::string buffer = idfTokenizer::readBuffer(is);
 
   if (progressBar) {
-    is.seekg(0, std::ios_base::end);
-    int streamsize = static_cast<int>(is.tellg());
     progressBar->setMinimum(0);
-    progressBar->setMaximum(streamsize);
-    is.seekg(0, std::ios_base::beg);
+    progressBar->setMaximum(static_cast<int>(buffer.size()));
   }
 
-  // Use a boost filter to make sure that no matter what line endings come in,
-  // they are converted to what is expected by the current os
-  boost::iostreams::filtering_istream filt;
-
-  //#ifdef _POSIX_VERSION
-  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
-  //#else
-  //  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::dos));
-  //#endif
-  filt.push(is);
-
-  // read the file line by line using regexes
-  while (std::getline(filt, line)) {
-
-    if (line == "\r") {
-      // This is not a real line at all, just the vestiges from the
-      // previous windows formatted line being parsed on unix, skip it,
-      // don't even count it
-      continue;
-    }
+  // scan the buffer line by line, objects are parsed straight from slices of the buffer
+  idfTokenizer::LineReader reader(buffer);
+  std::string_view line;
+  while (reader.next(line)) {
 
-    ++lineNum;
+    idfTokenizer::LineType lineType = idfTokenizer::lineType(line);
 
-    if (progressBar) {
-      int current = static_cast<int>(is.tellg());
-      progressBar->setValue(current);
-    }
-
-    if (boost::regex_match(line, idfRegex::commentOnlyLine())) {
+    if (lineType == idfTokenizer::LineType::Comment) {
       // continue comment
-      comment += (line + idfRegex::newLinestring());
-    } else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())) {
+      comment.append(line);
+      comment += '\n';
+    } else if (lineType == idfTokenizer::LineType::Blank) {
       // end comment
       boost::trim(comment);
 
@@ -574,85 +587,81 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
       }
 
       //clear out comment
-      comment = "";
+      comment.clear();
 
     } else {
 
-      bool foundEndLine(false);
       firstBlock = false;
-      bool isVersion = false;
+
+      if (progressBar) {
+        progressBar->setValue(static_cast<int>(reader.lineBegin()));
+      }
 
       // peek at the object type and name for indexing in map
+      std::string_view objectTypeView;
       std::string objectType;
-
-      if (boost::regex_search(line, matches, idfRegex::line())) {
-        objectType = std::string(matches[1].first, matches[1].second);
-        boost::trim(objectType);
+      if (idfTokenizer::objectType(line, objectTypeView)) {
+        objectType = std::string(objectTypeView);
       } else {
         // can't figure out the object's type
         if (!versionOnly) {
-          LOG(Warn, "Unrecognizable object type '" + line + "'. Defaulting to 'Catchall'.");
+          LOG(Warn, "Unrecognizable object type '" << line << "'. Defaulting to 'Catchall'.");
         }
         objectType = "Catchall";
       }
-      if (boost::regex_match(objectType, iddRegex::versionObjectName())) {
-        isVersion = true;
-      }
+      bool isVersion = idfTokenizer::isVersionObjectType(objectType);
 
       // get the corresponding idd object entry
-
       OptionalIddObject iddObject = m_iddFileAndFactoryWrapper.getObject(objectType);
       if (!iddObject) {
         if (!versionOnly) {
           LOG(Warn, "Cannot find object type '" + objectType + "' in Idd. Placing data in Catchall object.");
         }
         iddObject = IddObject();
-        objectType = "Catchall";
       } else {
         OS_ASSERT(iddObject->type() != IddObjectType::Catchall);
       }
 
-      // put the text for this object in a new string with a newline
-      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
-      comment = "";
-
-      // check if this line also matches closing line object
-      if (boost::regex_match(line, idfRegex::objectEnd())) {
-        foundEndLine = true;
-      }
-
-      // continue reading until we have seen the entire object
-      // last line will be thrown away, requires empty line between objects in Idf
-      while ((!foundEndLine) && (std::getline(filt, line))) {
-        ++lineNum;
-
-        // add line to text, include newline separator
-        text += (line + idfRegex::newLinestring());
-
-        // check if we have found the last field
-        if (boost::regex_match(line, idfRegex::objectEnd())) {
-          foundEndLine = true;
-        }
+      // continue reading until we have seen the entire object, the object is the slice of the
+      // buffer between the start of its first line and the end of the line holding the ';'
+      size_t objectBegin = reader.lineBegin();
+      bool foundEndLine = idfTokenizer::isObjectEnd(line);
+      while (!foundEndLine && reader.next(line)) {
+        foundEndLine = idfTokenizer::isObjectEnd(line);
       }
+      std::string_view text(buffer.data() + objectBegin, reader.lineEnd() - objectBegin);
 
       // construct the object
       if (foundEndLine && (!versionOnly || isVersion)) {
-        OptionalIdfObject object = IdfObject::load(text, *iddObject);
-        if (!object) {
+        std::shared_ptr<detail::IdfObject_Impl> impl;
+        if (comment.empty()) {
+          impl = detail::IdfObject_Impl::load(text, *iddObject);
+        } else {
+          // preceding comment lines become the object's comment
+          comment += '\n';
+          comment.append(text);
+          impl = detail::IdfObject_Impl::load(comment, *iddObject);
+        }
+        comment.clear();
+
+        if (!impl) {
           LOG(Error, "Unable to construct IdfObject from text: " << '\n'
                                                                  << text << '\n'
                                                                  << "Throwing this object out and parsing the remainder of the file.");
           continue;
         } else {
+          IdfObject object(impl);
+
           // a valid Idf object to parse
-          if (object->iddObject().type() != IddObjectType::Catchall) {
+          if (object.iddObject().type() != IddObjectType::Catchall) {
             ++objectNum;
           }
 
           // put it in the object list
-          addObject(*object);
+          addObject(object);
         }
       }
+      comment.clear();
 
       if (versionOnly && isVersion) {
         // Increment objectNum to avoid triggering the warning below and return false
@@ -110,6 +110,11 @@ class UTILITIES_API IdfFile
   /** Append objects to the end of this file. */
   void addObjects(const std::vector<IdfObject>& objects);
 
+  /** Append a copy of object to the end of this file. The copy uses the IddObject of the same name
+   *  in this file's IddFile (or Catchall if there is none), just as if object had been printed and
+   *  loaded into this file, so objects can be moved between IddFiles without going through text. */
+  void addObjectCopy(const IdfObject& object);
+
   /** Insert object immediately before the first object in this file whose IddObjectType value
    *  is greater than object's. */
   void insertObjectByIddObjectType(const IdfObject& object);
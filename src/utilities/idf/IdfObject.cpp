@@ -7,7 +7,7 @@
 #include "IdfObject_Impl.hpp"
 
 #include "IdfExtensibleGroup.hpp"
-#include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddKey.hpp"
@@ -27,16 +27,50 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <charconv>
+#include <cmath>
 #include <iomanip>
 
 namespace openstudio {
 
 namespace detail {
 
+  namespace {
+
+    // Parses the plain decimal numbers that make up nearly all numeric fields with std::from_chars.
+    // Returns false for anything else (leading '+' or whitespace, hexadecimal, infinity, NaN,
+    // subnormals), which is left to boost::lexical_cast so that results do not change. Also returns
+    // false where the standard library has no floating point from_chars (e.g. libc++ on older macOS).
+    bool fastParseDouble(std::string_view text, double& result) {
+#if defined(__cpp_lib_to_chars)
+      const char* last = text.data() + text.size();
+      auto [ptr, ec] = std::from_chars(text.data(), last, result);
+      return (ec == std::errc()) && (ptr == last) && ((result == 0.0) || std::isnormal(result));
+#else
+      (void)text;
+      (void)result;
+      return false;
+#endif
+    }
+
+    // Same result as boost::lexical_cast<double>(text), including throwing boost::bad_lexical_cast
+    double parseDouble(const std::string& text) {
+      double result = 0.0;
+      if (fastParseDouble(text, result)) {
+        return result;
+      }
+      return boost::lexical_cast<double>(text);
+    }
+
+  }  // namespace
+
   // CONSTRUCTORS
 
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
-    : m_comment(other.comment()), m_iddObject(other.iddObject()), m_fields(other.fields()), m_fieldComments(other.fieldComments()) {
+    : m_comment(other.comment()),
+      m_iddObject(other.iddObject()),
+      m_fields(other.m_fields),
+      m_fieldComments(other.fieldComments()) {
     if (keepHandle) {
       OS_ASSERT(!other.handle().isNull());
       m_handle = other.handle();
@@ -97,12 +131,67 @@ namespace detail {
     resizeToMinFields();
   }
 
+  IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, const IddObject& iddObject)
+    : m_comment(other.m_comment),
+      m_iddObject(iddObject),
+      m_fields(other.m_fields),
+      m_fieldComments(other.m_fieldComments) {
+    if ((m_iddObject.type() == IddObjectType::Catchall) && (other.m_iddObject.type() != IddObjectType::Catchall)) {
+      // Catchall objects keep the object type in their first field
+      std::vector<std::string>& fields = m_fields.edit();
+      fields.insert(fields.begin(), other.m_iddObject.name());
+      if (!m_fieldComments.empty()) {
+        m_fieldComments.insert(m_fieldComments.begin(), std::string());
+      }
+    } else if ((m_iddObject.type() != IddObjectType::Catchall) && (other.m_iddObject.type() == IddObjectType::Catchall) && !m_fields.empty()) {
+      // the object type is the one in the first field, see IdfFile::addObjectCopy
+      std::vector<std::string>& fields = m_fields.edit();
+      fields.erase(fields.begin());
+      if (!m_fieldComments.empty()) {
+        m_fieldComments.erase(m_fieldComments.begin());
+      }
+    }
+
+    // drop the fields iddObject does not have, as parseFields does
+    for (unsigned i = 0, n = m_fields.size(); i < n; ++i) {
+      if (!(m_iddObject.isNonextensibleField(i) || m_iddObject.isExtensibleField(i))) {
+        LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' " << "cannot have field index of " << i << ". "
+                                         << "Cutting off IdfObject fields here, dropping " << n - i << " fields.");
+        m_fields.edit().resize(i);
+        if (m_fieldComments.size() > i) {
+          m_fieldComments.resize(i);
+        }
+        break;
+      }
+    }
+    resizeToMinFields();
+
+    if (m_iddObject.hasHandleField()) {
+      m_handle = toUUID(m_fields[0]);
+    }
+    if (m_handle.isNull()) {
+      m_handle = openstudio::createUUID();
+      if (m_iddObject.hasHandleField()) {
+        bool ok = setString(0, toString(m_handle));
+        OS_ASSERT(ok);
+      }
+    }
+  }
+
   // GETTERS
 
   Handle IdfObject_Impl::handle() const {
     return m_handle;
   }
 
+  bool IdfObject_Impl::hasSeparatorInFields() const {
+    return std::any_of(m_fields.begin(), m_fields.end(), [](const std::string& field) { return field.find_first_of(",;!") != std::string::npos; });
+  }
+
+  bool IdfObject_Impl::sharesFieldsWith(const IdfObject_Impl& other) const {
+    return m_fields.isSharedWith(other.m_fields);
+  }
+
   IddObject IdfObject_Impl::iddObject() const {
     return m_iddObject;
   }
@@ -214,12 +303,15 @@ namespace detail {
   }
 
   boost::optional<double> IdfObject_Impl::getDouble(unsigned index, bool returnDefault) const {
-    OptionalDouble result;
+    OptionalDouble result = plainNumber(index);
+    if (result) {
+      return result;
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
         try {
-          result = boost::lexical_cast<double>(*value);
+          result = parseDouble(*value);
         } catch (const std::exception&) {
           LOG(Error, "Could not convert '" << *value << "' to double");
         }
@@ -235,11 +327,19 @@ namespace detail {
 
   boost::optional<unsigned> IdfObject_Impl::getUnsigned(unsigned index, bool returnDefault) const {
     OptionalUnsigned result;
+    if (OptionalDouble parsed = plainNumber(index)) {
+      try {
+        result = boost::numeric_cast<unsigned>(*parsed);
+      } catch (const std::exception&) {
+        LOG(Error, "Could not convert '" << m_fields[index] << "' to unsigned");
+      }
+      return result;
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
         try {
-          auto temp = boost::lexical_cast<double>(*value);
+          auto temp = parseDouble(*value);
           result = boost::numeric_cast<unsigned>(temp);
         } catch (const std::exception&) {
           LOG(Error, "Could not convert '" << *value << "' to unsigned");
@@ -251,11 +351,19 @@ namespace detail {
 
   boost::optional<int> IdfObject_Impl::getInt(unsigned index, bool returnDefault) const {
     OptionalInt result;
+    if (OptionalDouble parsed = plainNumber(index)) {
+      try {
+        result = boost::numeric_cast<int>(*parsed);
+      } catch (const std::exception&) {
+        LOG(Error, "Could not convert '" << m_fields[index] << "' to int");
+      }
+      return result;
+    }
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
       if (!(istringEqual(*value, "") || istringEqual(*value, "autosize") || istringEqual(*value, "autocalculate"))) {
         try {
-          auto temp = boost::lexical_cast<double>(*value);
+          auto temp = parseDouble(*value);
           result = boost::numeric_cast<int>(temp);
         } catch (const std::exception&) {
           LOG(Error, "Could not convert '" << *value << "' to int");
@@ -372,18 +480,19 @@ namespace detail {
       OS_ASSERT(i < 2u);
       if (n == 0 && i == 1) {
         OS_ASSERT(!m_handle.isNull());
-        m_fields.push_back(toString(m_handle));
+        m_fields.edit().push_back(toString(m_handle));
         m_diffs.push_back(IdfObjectDiff(0u, boost::none, m_fields.back()));
       }
       n = numFields();
       if (i < n) {
         std::string oldName = m_fields[i];
-        m_fields[i] = newName;
+        m_fields.edit()[i] = newName;
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
       } else {
-        m_fields.push_back(newName);
+        m_fields.edit().push_back(newName);
         m_diffs.push_back(IdfObjectDiff(i, boost::none, newName));
       }
+      nameFieldChanged();
       //return decoded string since we might have made changes to it if its an EMS object.
       newName = decodeString(newName);
       return newName;  // success!
@@ -450,7 +559,7 @@ namespace detail {
         m_diffs.resize(diffSize);
 
         // resize fields
-        m_fields.resize(n);
+        m_fields.edit().resize(n);
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
@@ -460,7 +569,7 @@ namespace detail {
 
       OS_ASSERT(index < m_fields.size());
 
-      m_fields[index] = value;
+      m_fields.edit()[index] = value;
       m_diffs.emplace_back(index, oldValue, value);
       return result;
     }
@@ -562,7 +671,7 @@ namespace detail {
 
     // ok if nonextensible, or extensible w/ group size 1
     if (m_iddObject.isNonextensibleField(index) || (m_iddObject.isExtensibleField(index) && (m_iddObject.properties().numExtensible == 1))) {
-      m_fields.push_back(value);
+      m_fields.edit().push_back(value);
       m_diffs.push_back(IdfObjectDiff(index, boost::none, value));
       return true;
     }
@@ -600,7 +709,7 @@ namespace detail {
         m_diffs.resize(diffSize);
 
         // resize the fields
-        m_fields.resize(n);
+        m_fields.edit().resize(n);
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
@@ -620,7 +729,7 @@ namespace detail {
         wValues.resize(groupSize);
       }
 
-      m_fields.resize(n + groupSize);
+      m_fields.edit().resize(n + groupSize);
 
       for (unsigned i = 0; i < groupSize; ++i) {
 
@@ -630,7 +739,7 @@ namespace detail {
           m_diffs.resize(diffSize);
 
           // resize the fields
-          m_fields.resize(n);
+          m_fields.edit().resize(n);
           if (m_fieldComments.size() > n) {
             m_fieldComments.resize(n);
           }
@@ -786,7 +895,7 @@ namespace detail {
         m_diffs.push_back(IdfObjectDiff(numBeforePop - 1 - i, result[i], boost::none));
       }
 
-      m_fields.resize(numAfterPop);
+      m_fields.edit().resize(numAfterPop);
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(numAfterPop);
       }
@@ -930,7 +1039,7 @@ namespace detail {
     bool resized = false;
     if (n < iddN) {
       resized = true;
-      m_fields.resize(iddN);
+      m_fields.edit().resize(iddN);
     }
     if (!fill_default) {
       if (resized) {
@@ -947,9 +1056,12 @@ namespace detail {
       if (m_fields[index].empty()) {
         OptionalIddField iddField = m_iddObject.getField(index);
         if (iddField && iddField->properties().stringDefault) {
-          m_fields[index] = *(iddField->properties().stringDefault);
+          m_fields.edit()[index] = *(iddField->properties().stringDefault);
           dataChange = true;
           // m_diffs.push_back(IdfObjectDiff(index, boost::none, m_fields[index] ));
+          if (iddField->isNameField()) {
+            nameFieldChanged();
+          }
         }
       }
     }
@@ -1222,7 +1334,7 @@ namespace detail {
 
   // SERIALIZATION
 
-  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const std::string& text) {
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(std::string_view text) {
     std::shared_ptr<IdfObject_Impl> result;
     IdfObject_Impl idfObjectImpl;
 
@@ -1238,7 +1350,7 @@ namespace detail {
     return result;
   }
 
-  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(const std::string& text, const IddObject& iddObject) {
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::load(std::string_view text, const IddObject& iddObject) {
     std::shared_ptr<IdfObject_Impl> result;
     IdfObject_Impl idfObjectImpl(iddObject, false, true);
 
@@ -1400,7 +1512,7 @@ namespace detail {
     unsigned min_n = m_iddObject.numFieldsInDefaultObject();
     unsigned n = numFields();
     if (n < min_n) {
-      m_fields.resize(min_n);
+      m_fields.edit().resize(min_n);
       n = min_n;
     }
     // also make sure extensible groups are whole
@@ -1410,134 +1522,56 @@ namespace detail {
         int groupSize = m_iddObject.properties().numExtensible;
         int modulo = nExtFields % groupSize;
         if (modulo > 0) {
-          m_fields.resize(n + (groupSize - modulo));
+          m_fields.edit().resize(n + (groupSize - modulo));
         }
       }
     }
   }
 
-  void IdfObject_Impl::parse(const std::string& text, bool getIddFromFactory) {
-    std::string objectType;
-
-    // cut down on this text as we parse
-    std::string parsedText(text);
-
-    // get preceding comments
-    boost::smatch matches;
-    while (boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())) {
-      std::string comment(matches[1].first, matches[1].second);
-      std::string otherText(matches[2].first, matches[2].second);
-      boost::trim_left(otherText);
+  void IdfObject_Impl::parse(std::string_view text, bool getIddFromFactory) {
+    idfTokenizer::ObjectTokens tokens = idfTokenizer::scanObject(text);
 
-      // append the comment
-      if (!comment.empty()) {
-        m_comment += "!" + comment + idfRegex::newLinestring();
-      }
-
-      // reduce the parsed text
-      parsedText = otherText;
+    if (!tokens.hasObjectType) {
+      LOG_AND_THROW("Cannot extract an IdfObject type from text '" << text << "'");
     }
 
-    // the first entry will be the object type
-    if (boost::regex_search(parsedText, matches, idfRegex::line())) {
-      objectType = std::string(matches[1].first, matches[1].second);
-      boost::trim(objectType);
-      std::string commentOrOtherText(matches[2].first, matches[2].second);
-      boost::trim_left(commentOrOtherText);
-      std::string otherText(matches[3].first, matches[3].second);
-
-      if (getIddFromFactory) {
-        // find appropriate IddObject in IddFactory
-        OptionalIddObject candidate = IddFactory::instance().getObject(objectType);
-        if (candidate) {
-          m_iddObject = *candidate;
-        } else {
-          LOG(Warn, "IddObject type '" << objectType << "' not found in IddFactory. " << "Reverting to default Catchall object.");
-          OS_ASSERT(m_iddObject.name() == "Catchall");
-          m_fields.push_back(objectType);
-          objectType = "Catchall";
-        }
-      } else {
-        if (!boost::iequals(objectType, m_iddObject.name())) {
-          if (m_iddObject.type() != IddObjectType::Catchall) {
-            LOG(Error, "IdfObject type '" << objectType << "', does not equal its IddObject name '" << m_iddObject.name()
-                                          << "'. Reverting to default Catchall IddObject.");
-          }
-          m_iddObject = IddObject();
-          m_fields.push_back(objectType);
-          objectType = "Catchall";
-        }
-      }
-
-      if (boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())
-          || boost::regex_match(commentOrOtherText, commentRegex::whitespaceOnlyBlock())) {
-
-        // set comment
-        m_comment += commentOrOtherText;
-
-        // reduce the parsed text
-        parsedText = otherText;
+    std::string objectType(tokens.objectType);
+    if (getIddFromFactory) {
+      // find appropriate IddObject in IddFactory
+      OptionalIddObject candidate = IddFactory::instance().getObject(objectType);
+      if (candidate) {
+        m_iddObject = *candidate;
       } else {
-        // reduce the parsed text
-        parsedText = commentOrOtherText + otherText;
+        LOG(Warn, "IddObject type '" << objectType << "' not found in IddFactory. " << "Reverting to default Catchall object.");
+        OS_ASSERT(m_iddObject.name() == "Catchall");
+        m_fields.edit().push_back(objectType);
       }
-
     } else {
-      LOG_AND_THROW("Cannot extract an IdfObject type from text '" << parsedText << "'");
-    }
-
-    // get trailing comments
-    while (boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())) {
-      std::string comment(matches[1].first, matches[1].second);
-      std::string otherText(matches[2].first, matches[2].second);
-      boost::trim_left(otherText);
-
-      // append the comment
-      if (!comment.empty()) {
-        m_comment += "!" + comment + idfRegex::newLinestring();
+      if (!boost::iequals(objectType, m_iddObject.name())) {
+        if (m_iddObject.type() != IddObjectType::Catchall) {
+          LOG(Error, "IdfObject type '" << objectType << "', does not equal its IddObject name '" << m_iddObject.name()
+                                        << "'. Reverting to default Catchall IddObject.");
+        }
+        m_iddObject = IddObject();
+        m_fields.edit().push_back(objectType);
       }
-
-      // reduce the parsed text
-      parsedText = otherText;
     }
 
-    // remove trailing whitespace and new lines
-    boost::trim_right(m_comment);
+    m_comment += tokens.comment;
 
     // parse the fields
-    parseFields(parsedText);
+    parseFields(tokens.fieldText);
   }
 
-  void IdfObject_Impl::parseFields(const std::string& text) {
-    // match variables
-    boost::match_results<std::string::const_iterator> matches;
-
-    // cut down on this text as we parse
-    std::string::const_iterator start = text.begin();
-    std::string::const_iterator stop = text.end();
+  void IdfObject_Impl::parseFields(std::string_view text) {
+    idfTokenizer::FieldScanner scanner(text);
+    idfTokenizer::FieldToken token;
 
     // current idd field index
     unsigned iddFieldIndex = 0;
 
     // parse all the fields
-    while (boost::regex_search(start, stop, matches, idfRegex::line())) {
-      std::string fieldText(matches[1].first, matches[1].second);
-      boost::trim(fieldText);
-      std::string commentOrOtherText(matches[2].first, matches[2].second);
-      boost::trim(commentOrOtherText);
-
-      if (commentOrOtherText.empty() || boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())) {
-        // reduce the text
-        start = matches[3].first;
-        stop = matches[3].second;
-      } else {
-        // reduce the text; there may be multiple fields on this line
-        start = matches[2].first;
-        stop = matches[3].second;
-
-        // matches[2] is not a comment
-        commentOrOtherText.clear();
-      }
+    while (scanner.next(token)) {
 
       // get the idd field
       OptionalIddField iddField = m_iddObject.getField(iddFieldIndex);
@@ -1545,19 +1579,17 @@ namespace detail {
       if (iddField) {
 
         // add this to our fields
-        m_fields.push_back(fieldText);
+        m_fields.edit().emplace_back(token.value);
 
-        if (!commentOrOtherText.empty()) {
-          // drop default comments
-          if (!boost::regex_match(commentOrOtherText, commentRegex::editorCommentWhitespaceOnlyLine())) {
-            m_fieldComments.resize(m_fields.size());
-            m_fieldComments.back() = commentOrOtherText;
-          }
+        // drop default comments
+        if (!token.comment.empty() && !idfTokenizer::isEditorComment(token.comment)) {
+          m_fieldComments.resize(m_fields.size());
+          m_fieldComments.back() = token.comment;
         }
 
         // keep handle if this is a handle field
         if (iddField->properties().type == IddFieldType::HandleType) {
-          Handle candidate = toUUID(fieldText);
+          Handle candidate = toUUID(m_fields.back());
           if (!candidate.isNull()) {
             m_handle = candidate;
           }
@@ -1566,19 +1598,21 @@ namespace detail {
       } else {
         LOG(Error, "IdfObject of type '" << m_iddObject.name() << "' " << "cannot have field index of " << iddFieldIndex << ". "
                                          << "Cutting off IdfObject field parsing here, with the following text " << "remaining: " << '\n'
-                                         << fieldText << '\n'
-                                         << std::string(start, stop));
+                                         << token.value << '\n'
+                                         << scanner.remaining());
         return;
       }
 
       // increment current idd field index
       ++iddFieldIndex;
-    }  // while line matches
+    }
 
-    std::string unparsedText(start, stop);
-    boost::trim(unparsedText);
-    if (!unparsedText.empty()) {
-      LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " << '\n' << unparsedText);
+    std::string_view unparsedText = scanner.remaining();
+    auto unparsedBegin = unparsedText.find_first_not_of(" \t\n\v\f\r");
+    if (unparsedBegin != std::string_view::npos) {
+      auto unparsedEnd = unparsedText.find_last_not_of(" \t\n\v\f\r");
+      LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " << '\n'
+                                                                                          << unparsedText.substr(unparsedBegin, unparsedEnd - unparsedBegin + 1));
     }
   }
 
@@ -1587,12 +1621,12 @@ namespace detail {
   bool IdfObject_Impl::setIddObject(const IddObject& iddObject) {
     m_iddObject = iddObject;
     if (m_fields.size() < minFields()) {
-      m_fields.resize(minFields());
+      m_fields.edit().resize(minFields());
     } else {
       // pop any fields that the IddObject does not recognize
       for (unsigned i = 0, n = numFields(); i < n; ++i) {
         if (!(m_iddObject.isNonextensibleField(i) || m_iddObject.isExtensibleField(i))) {
-          m_fields.resize(i);
+          m_fields.edit().resize(i);
           if (m_fieldComments.size() > m_fields.size()) {
             m_fieldComments.resize(i);
           }
@@ -1603,6 +1637,14 @@ namespace detail {
     return true;
   }
 
+  boost::optional<double> IdfObject_Impl::plainNumber(unsigned index) const {
+    double result = 0.0;
+    if ((index < m_fields.size()) && !m_fields[index].empty() && fastParseDouble(m_fields[index], result)) {
+      return result;
+    }
+    return boost::none;
+  }
+
   UnsignedVector IdfObject_Impl::trimFieldIndices(const UnsignedVector& indices) const {
     unsigned n = m_fields.size();  // number of fields
     UnsignedVector result = indices;
@@ -1660,6 +1702,8 @@ namespace detail {
     return result;
   }
 
+  void IdfObject_Impl::nameFieldChanged() {}
+
   // QUERY HELPERS
 
   void IdfObject_Impl::populateValidityReport(ValidityReport& report, bool /*checkNames*/) const {
@@ -1948,7 +1992,7 @@ namespace detail {
   }
 
   std::vector<std::string> IdfObject_Impl::fields() const {
-    return m_fields;
+    return m_fields.get();
   }
 
   std::vector<std::string> IdfObject_Impl::fieldComments() const {
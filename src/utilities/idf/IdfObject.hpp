@@ -31,6 +31,7 @@ class StrictnessLevel;
 class Quantity;
 class OSOptionalQuantity;
 struct IdfObjectImplLess;
+class IdfFile;
 
 namespace detail {
   class IdfObject_Impl;
@@ -409,6 +410,7 @@ class UTILITIES_API IdfObject
   friend class detail::Workspace_Impl;        // for finding IdfObjects in a workspace
   friend class WorkspaceObject;               // for WorkspaceObject::idfObject()
   friend class Workspace;                     // for toIdfFile completion (constructs IdfObject from impl)
+  friend class IdfFile;                       // for IdfFile::load (constructs IdfObject from impl)
 
   /** Protected constructor from impl. */
   IdfObject(std::shared_ptr<detail::IdfObject_Impl> impl);
@@ -17,7 +17,9 @@
 
 #include <boost/optional.hpp>
 
+#include <memory>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <vector>
 
@@ -36,6 +38,63 @@ class OSOptionalQuantity;
 // private namespace
 namespace detail {
 
+  /** Field values of an IdfObject_Impl. Copies share one vector until either of them is changed through edit, so that
+   *  cloning a whole Workspace does not duplicate the text of the objects that are not changed afterwards. */
+  class CopyOnWriteFields
+  {
+   public:
+    CopyOnWriteFields() = default;
+
+    CopyOnWriteFields(const std::vector<std::string>& values)
+      : m_values(values.empty() ? nullptr : std::make_shared<std::vector<std::string>>(values)) {}
+
+    const std::vector<std::string>& get() const {
+      static const std::vector<std::string> empty;
+      return m_values ? *m_values : empty;
+    }
+
+    /** Values to change, copied first if they are shared with another object. */
+    std::vector<std::string>& edit() {
+      if (!m_values) {
+        m_values = std::make_shared<std::vector<std::string>>();
+      } else if (m_values.use_count() > 1) {
+        m_values = std::make_shared<std::vector<std::string>>(*m_values);
+      }
+      return *m_values;
+    }
+
+    bool isSharedWith(const CopyOnWriteFields& other) const {
+      return m_values && (m_values == other.m_values);
+    }
+
+    size_t size() const {
+      return get().size();
+    }
+
+    bool empty() const {
+      return get().empty();
+    }
+
+    const std::string& operator[](size_t index) const {
+      return (*m_values)[index];
+    }
+
+    const std::string& back() const {
+      return m_values->back();
+    }
+
+    std::vector<std::string>::const_iterator begin() const {
+      return get().begin();
+    }
+
+    std::vector<std::string>::const_iterator end() const {
+      return get().end();
+    }
+
+   private:
+    std::shared_ptr<std::vector<std::string>> m_values;
+  };
+
   /** Implementation of IdfObject. */
   class UTILITIES_API IdfObject_Impl
     : public std::enable_shared_from_this<IdfObject_Impl>
@@ -58,6 +117,10 @@ namespace detail {
     IdfObject_Impl(const Handle& handle, const std::string& comment, const IddObject& iddObject, const StringVector& fields,
                    const StringVector& fieldComments);
 
+    /** Copy of other that uses iddObject in place of other's IddObject, as if other had been printed
+     *  and loaded with iddObject. Used by IdfFile::addObjectCopy. */
+    IdfObject_Impl(const IdfObject_Impl& other, const IddObject& iddObject);
+
     virtual ~IdfObject_Impl() = default;
 
     //@}
@@ -67,6 +130,14 @@ namespace detail {
     /** Returns the handle associated with the object. */
     Handle handle() const;
 
+    /** Returns true if a field value holds a ',', ';' or '!'. Printing and loading such an object splits
+     *  the value up, so IdfFile::addObjectCopy cannot use the copy constructor above for it. */
+    bool hasSeparatorInFields() const;
+
+    /** Returns true if this object and other still share their field values, as an object and its clone do until either
+     *  of them is changed. */
+    bool sharesFieldsWith(const IdfObject_Impl& other) const;
+
     /** Get this object's IddObject. */
     IddObject iddObject() const;
 
@@ -310,11 +381,11 @@ namespace detail {
 
     /** Constructor from text. Parses text and queries the IddFactory for its IddObject. May create
      *  an invalid object. (May even be invalid at enums::Strictness level None.) */
-    static std::shared_ptr<IdfObject_Impl> load(const std::string& text);
+    static std::shared_ptr<IdfObject_Impl> load(std::string_view text);
 
     /** Constructor from text and an explicit iddObject. May create an invalid object. (May even
      *  be invalid at enums::Strictness level None.) */
-    static std::shared_ptr<IdfObject_Impl> load(const std::string& text, const IddObject& iddObject);
+    static std::shared_ptr<IdfObject_Impl> load(std::string_view text, const IddObject& iddObject);
 
     /** Serialize this object to os as Idf text. */
     std::ostream& print(std::ostream& os) const;
@@ -374,8 +445,8 @@ namespace detail {
     // idd object definition
     IddObject m_iddObject;
 
-    // idf fields
-    std::vector<std::string> m_fields;
+    // idf fields, shared with the objects this one was cloned from or to until changed
+    CopyOnWriteFields m_fields;
     std::vector<std::string> m_fieldComments;  // only populated if encounter non-empty, non-default comment
 
     // idf differences
@@ -402,6 +473,12 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const;
 
+    // SETTER HELPERS
+
+    /** Called right after the name field has been written, before any signals are emitted. Does
+     *  nothing here, WorkspaceObject_Impl uses it to keep the Workspace's name index up to date. */
+    virtual void nameFieldChanged();
+
    private:
     IdfObject_Impl() = default;
 
@@ -417,16 +494,20 @@ namespace detail {
     /* Parse IdfObject text. If getIddFromFactory, will first search for the IddObject using the
      * IddFactory, otherwise, assumes that m_iddObject was provided and is correct. (Will log
      * warning if the names do not match.) */
-    void parse(const std::string& text, bool getIddFromFactory);
+    void parse(std::string_view text, bool getIddFromFactory);
 
     // parse fields
-    void parseFields(const std::string& text);
+    void parseFields(std::string_view text);
 
     // GETTER AND SETTER HELPERS
 
     /** Set this object's IddObject to iddObject. */
     bool setIddObject(const IddObject& iddObject);
 
+    /** Returns m_fields[index] as a number if it is a plain decimal number, which can be read without
+     *  going through getString and boost::lexical_cast. */
+    boost::optional<double> plainNumber(unsigned index) const;
+
     // remove any indices that are outside m_fields' range
     UnsignedVector trimFieldIndices(const UnsignedVector& indices) const;
 
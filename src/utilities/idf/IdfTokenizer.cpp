@@ -0,0 +1,336 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "IdfTokenizer.hpp"
+
+#include <array>
+#include <cstring>
+#include <iterator>
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  namespace {
+
+    enum CharClass : unsigned char
+    {
+      Space = 1,      // same set of characters as \s in boost::regex and std::isspace in the classic locale
+      Blank = 2,      // same set of characters as \h in boost::regex
+      Delimiter = 4,  // ',', ';' and '!', new lines are found with memchr
+    };
+
+    constexpr std::array<unsigned char, 256> makeCharClasses() {
+      std::array<unsigned char, 256> result{};
+      for (unsigned char c : {' ', '\t', '\n', '\v', '\f', '\r'}) {
+        result[c] |= Space;
+      }
+      for (unsigned char c : {' ', '\t'}) {
+        result[c] |= Blank;
+      }
+      for (unsigned char c : {',', ';', '!'}) {
+        result[c] |= Delimiter;
+      }
+      return result;
+    }
+
+    // one lookup per character instead of a chain of comparisons
+    constexpr std::array<unsigned char, 256> charClasses = makeCharClasses();
+
+    inline bool hasClass(char c, unsigned char charClass) {
+      return (charClasses[static_cast<unsigned char>(c)] & charClass) != 0;
+    }
+
+    inline bool isSpace(char c) {
+      return hasClass(c, Space);
+    }
+
+    inline bool isBlank(char c) {
+      return hasClass(c, Blank);
+    }
+
+    size_t skipSpace(std::string_view text, size_t pos, size_t end) {
+      while ((pos < end) && isSpace(text[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    std::string_view trim(std::string_view text) {
+      size_t begin = skipSpace(text, 0, text.size());
+      size_t end = text.size();
+      while ((end > begin) && isSpace(text[end - 1])) {
+        --end;
+      }
+      return text.substr(begin, end - begin);
+    }
+
+    size_t findNewLine(std::string_view text, size_t pos) {
+      if (pos >= text.size()) {
+        return std::string_view::npos;
+      }
+      const void* found = std::memchr(text.data() + pos, '\n', text.size() - pos);
+      if (found == nullptr) {
+        return std::string_view::npos;
+      }
+      return static_cast<const char*>(found) - text.data();
+    }
+
+    // first character at or after pos in any of charClass, four characters per iteration since most are not
+    size_t findClass(std::string_view text, size_t pos, unsigned char charClass) {
+      const auto* data = reinterpret_cast<const unsigned char*>(text.data());
+      const size_t n = text.size();
+      for (; pos + 4 <= n; pos += 4) {
+        const unsigned char classes = charClasses[data[pos]] | charClasses[data[pos + 1]] | charClasses[data[pos + 2]] | charClasses[data[pos + 3]];
+        if ((classes & charClass) != 0) {
+          break;
+        }
+      }
+      for (; pos < n; ++pos) {
+        if ((charClasses[data[pos]] & charClass) != 0) {
+          return pos;
+        }
+      }
+      return std::string_view::npos;
+    }
+
+    size_t findDelimiter(std::string_view text, size_t pos) {
+      return findClass(text, pos, Delimiter);
+    }
+
+    // emulates boost::regex_search(text.begin() + from, text.end(), idfRegex::line()), where '^' matches at
+    // from and after every '\n'. on success matchBegin is the start of matches[1] and separator is the position
+    // of the ',' or ';' that ends it.
+    bool searchSeparator(std::string_view text, size_t from, size_t& matchBegin, size_t& separator) {
+      size_t begin = from;
+      while (true) {
+        size_t pos = findDelimiter(text, begin);
+        if (pos == std::string_view::npos) {
+          return false;
+        }
+        if (text[pos] != '!') {
+          matchBegin = begin;
+          separator = pos;
+          return true;
+        }
+        // no line starting between begin and this '!' can match, try the line after it
+        size_t newLine = findNewLine(text, pos);
+        if (newLine == std::string_view::npos) {
+          return false;
+        }
+        begin = newLine + 1;
+      }
+    }
+
+    // emulates the comment stripping loops of IdfObject_Impl::parse, that is repeated
+    // boost::regex_match(parsedText, idfRegex::commentOnlyLine()) followed by boost::trim_left
+    size_t stripComments(std::string_view text, size_t pos, std::string& comment) {
+      const size_t n = text.size();
+      while (true) {
+        size_t bang = skipSpace(text, pos, n);
+        if ((bang == n) || (text[bang] != '!')) {
+          return pos;
+        }
+        size_t newLine = findNewLine(text, bang);
+        size_t lineEnd = (newLine == std::string_view::npos) ? n : newLine;
+        if (lineEnd > bang + 1) {
+          comment += '!';
+          comment.append(text.data() + bang + 1, lineEnd - bang - 1);
+          comment += '\n';
+        }
+        pos = skipSpace(text, (newLine == std::string_view::npos) ? n : newLine + 1, n);
+      }
+    }
+
+  }  // namespace
+
+  std::string readBuffer(std::istream& is) {
+    std::string result;
+
+    // read in one go when the size of the stream is known
+    std::streampos begin = is.tellg();
+    if (begin != std::streampos(-1)) {
+      is.seekg(0, std::ios_base::end);
+      std::streampos end = is.tellg();
+      is.seekg(begin);
+      if (end > begin) {
+        result.resize(static_cast<size_t>(end - begin));
+        is.read(result.data(), static_cast<std::streamsize>(result.size()));
+        result.resize(static_cast<size_t>(is.gcount()));
+      }
+    }
+    if (result.empty()) {
+      is.clear();
+      result.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+    }
+
+    // convert line endings in place, nothing to do for files with unix line endings
+    const void* found = std::memchr(result.data(), '\r', result.size());
+    if (found != nullptr) {
+      auto out = static_cast<size_t>(static_cast<const char*>(found) - result.data());
+      for (size_t in = out, n = result.size(); in < n; ++in) {
+        char c = result[in];
+        if (c == '\r') {
+          if ((in + 1 < n) && (result[in + 1] == '\n')) {
+            continue;
+          }
+          c = '\n';
+        }
+        result[out++] = c;
+      }
+      result.resize(out);
+    }
+
+    return result;
+  }
+
+  LineType lineType(std::string_view line) {
+    size_t pos = skipSpace(line, 0, line.size());
+    if ((pos < line.size()) && (line[pos] == '!')) {
+      return LineType::Comment;
+    }
+    for (char c : line) {
+      if (!isBlank(c)) {
+        return LineType::Content;
+      }
+    }
+    return LineType::Blank;
+  }
+
+  bool isObjectEnd(std::string_view line) {
+    for (size_t pos = findDelimiter(line, 0); pos != std::string_view::npos; pos = findDelimiter(line, pos + 1)) {
+      if (line[pos] != ',') {
+        return line[pos] == ';';
+      }
+    }
+    return false;
+  }
+
+  bool objectType(std::string_view line, std::string_view& objectType) {
+    size_t pos = findDelimiter(line, 0);
+    if ((pos == std::string_view::npos) || (line[pos] == '!')) {
+      return false;
+    }
+    objectType = trim(line.substr(0, pos));
+    return true;
+  }
+
+  bool isVersionObjectType(std::string_view objectType) {
+    // ".*[vV]ersion.*"
+    for (size_t pos = objectType.find("ersion", 1); pos != std::string_view::npos; pos = objectType.find("ersion", pos + 1)) {
+      char c = objectType[pos - 1];
+      if ((c == 'v') || (c == 'V')) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool isEditorComment(std::string_view comment) {
+    // "^[\\h]*(?:!-([^\\n\\r\\v]*))?$"
+    if ((comment.size() < 2) || (comment[0] != '!') || (comment[1] != '-')) {
+      return false;
+    }
+    return comment.find_first_of("\n\r\v", 2) == std::string_view::npos;
+  }
+
+  LineReader::LineReader(std::string_view buffer) : m_buffer(buffer), m_lineBegin(0), m_lineEnd(0) {}
+
+  bool LineReader::next(std::string_view& line) {
+    if (m_lineEnd >= m_buffer.size()) {
+      return false;
+    }
+    m_lineBegin = m_lineEnd;
+    size_t newLine = findNewLine(m_buffer, m_lineBegin);
+    if (newLine == std::string_view::npos) {
+      line = m_buffer.substr(m_lineBegin);
+      m_lineEnd = m_buffer.size();
+    } else {
+      line = m_buffer.substr(m_lineBegin, newLine - m_lineBegin);
+      m_lineEnd = newLine + 1;
+    }
+    return true;
+  }
+
+  size_t LineReader::lineBegin() const {
+    return m_lineBegin;
+  }
+
+  size_t LineReader::lineEnd() const {
+    return m_lineEnd;
+  }
+
+  ObjectTokens scanObject(std::string_view text) {
+    ObjectTokens result;
+    const size_t n = text.size();
+
+    // get preceding comments
+    size_t pos = stripComments(text, 0, result.comment);
+
+    // the first entry will be the object type
+    size_t matchBegin = 0;
+    size_t separator = 0;
+    if (!searchSeparator(text, pos, matchBegin, separator)) {
+      return result;
+    }
+    result.hasObjectType = true;
+    result.objectType = trim(text.substr(matchBegin, separator - matchBegin));
+
+    // the rest of the line is either a comment, whitespace, or more fields
+    size_t newLine = findNewLine(text, separator + 1);
+    size_t nextLine = (newLine == std::string_view::npos) ? n : newLine + 1;
+    size_t afterSeparator = skipSpace(text, separator + 1, nextLine);
+    if (afterSeparator == nextLine) {
+      pos = nextLine;
+    } else if (text[afterSeparator] == '!') {
+      result.comment.append(text.data() + afterSeparator, nextLine - afterSeparator);
+      pos = nextLine;
+    } else {
+      pos = afterSeparator;
+    }
+
+    // get trailing comments
+    pos = stripComments(text, pos, result.comment);
+
+    // remove trailing whitespace and new lines
+    while (!result.comment.empty() && isSpace(result.comment.back())) {
+      result.comment.pop_back();
+    }
+
+    result.fieldText = text.substr(pos);
+    return result;
+  }
+
+  FieldScanner::FieldScanner(std::string_view fieldText) : m_text(fieldText), m_start(0) {}
+
+  bool FieldScanner::next(FieldToken& token) {
+    size_t matchBegin = 0;
+    size_t separator = 0;
+    if (!searchSeparator(m_text, m_start, matchBegin, separator)) {
+      return false;
+    }
+
+    token.value = trim(m_text.substr(matchBegin, separator - matchBegin));
+
+    size_t newLine = findNewLine(m_text, separator + 1);
+    size_t lineEnd = (newLine == std::string_view::npos) ? m_text.size() : newLine;
+    std::string_view commentOrOtherText = trim(m_text.substr(separator + 1, lineEnd - separator - 1));
+    if (commentOrOtherText.empty() || (commentOrOtherText[0] == '!')) {
+      token.comment = commentOrOtherText;
+      m_start = (newLine == std::string_view::npos) ? m_text.size() : newLine + 1;
+    } else {
+      // there may be multiple fields on this line
+      token.comment = std::string_view();
+      m_start = separator + 1;
+    }
+
+    return true;
+  }
+
+  std::string_view FieldScanner::remaining() const {
+    return m_text.substr(m_start);
+  }
+
+}  // namespace idfTokenizer
+}  // namespace openstudio
@@ -0,0 +1,124 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFTOKENIZER_HPP
+#define UTILITIES_IDF_IDFTOKENIZER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <istream>
+#include <string>
+#include <string_view>
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  /** Hand-written, single-pass replacement for the idfRegex based parsing of IDF/OSM text. Every function
+   *  here reproduces the behavior of the corresponding regular expression (noted in the comments) so that
+   *  IdfFile::load and IdfObject::load produce exactly the same objects and comments as before, but works
+   *  on std::string_view slices of one in-memory buffer and uses memchr style delimiter searches instead of
+   *  backtracking regexes. */
+
+  /** Reads the whole stream into a single buffer, converting "\r\n" and lone "\r" line endings to "\n"
+   *  (what boost::iostreams::newline_filter(newline::posix) did for the line based parser). */
+  UTILITIES_API std::string readBuffer(std::istream& is);
+
+  /** Classification of a single line (without its '\n'). */
+  enum class LineType
+  {
+    Blank,    // commentRegex::whitespaceOnlyLine, only ' ' and '\t'
+    Comment,  // idfRegex::commentOnlyLine, first non-whitespace character is '!'
+    Content   // anything else, starts or continues an object
+  };
+
+  UTILITIES_API LineType lineType(std::string_view line);
+
+  /** Returns true if line has a ';' that is not preceded by '!', same as idfRegex::objectEnd. */
+  UTILITIES_API bool isObjectEnd(std::string_view line);
+
+  /** Sets objectType to the trimmed text before the first ',' or ';' of line and returns true if that
+   *  separator is not preceded by '!', same as idfRegex::line applied to a single line. */
+  UTILITIES_API bool objectType(std::string_view line, std::string_view& objectType);
+
+  /** Same as boost::regex_match(objectType, iddRegex::versionObjectName()). */
+  UTILITIES_API bool isVersionObjectType(std::string_view objectType);
+
+  /** Same as boost::regex_match(comment, commentRegex::editorCommentWhitespaceOnlyLine()) for a trimmed,
+   *  non-empty field comment, i.e. a '!-' comment that the printer regenerates and need not be kept. */
+  UTILITIES_API bool isEditorComment(std::string_view comment);
+
+  /** Iterates over the lines of a buffer without copying them. */
+  class UTILITIES_API LineReader
+  {
+   public:
+    explicit LineReader(std::string_view buffer);
+
+    /** Sets line to the next line (without its '\n'), returns false at the end of the buffer. */
+    bool next(std::string_view& line);
+
+    /** Offset in the buffer of the first character of the line most recently returned by next. */
+    size_t lineBegin() const;
+
+    /** Offset in the buffer just past the line most recently returned by next, including its '\n'. */
+    size_t lineEnd() const;
+
+   private:
+    std::string_view m_buffer;
+    size_t m_lineBegin;
+    size_t m_lineEnd;
+  };
+
+  /** Object type, object comment and unparsed field text of the text of a single object, as split up by
+   *  IdfObject_Impl::parse. */
+  struct UTILITIES_API ObjectTokens
+  {
+    /** False if no object type could be extracted from the text. */
+    bool hasObjectType = false;
+
+    /** Trimmed object type, the text before the first separator. */
+    std::string_view objectType;
+
+    /** Comment lines preceding the object type and comments on the lines that follow it, one per line
+     *  and each starting with '!', right trimmed. */
+    std::string comment;
+
+    /** Remaining text, to be split into fields by FieldScanner. */
+    std::string_view fieldText;
+  };
+
+  UTILITIES_API ObjectTokens scanObject(std::string_view text);
+
+  /** One field as split up by IdfObject_Impl::parseFields. */
+  struct UTILITIES_API FieldToken
+  {
+    /** Trimmed field value. */
+    std::string_view value;
+
+    /** Trimmed comment following the value on the same line, starts with '!'. Empty if there is none, or if
+     *  another field follows the value on the same line. */
+    std::string_view comment;
+  };
+
+  /** Splits field text into fields, same as repeated boost::regex_search with idfRegex::line. */
+  class UTILITIES_API FieldScanner
+  {
+   public:
+    explicit FieldScanner(std::string_view fieldText);
+
+    /** Sets token to the next field, returns false when no more fields can be found. */
+    bool next(FieldToken& token);
+
+    /** Text that has not yet been assigned to a field. */
+    std::string_view remaining() const;
+
+   private:
+    std::string_view m_text;
+    size_t m_start;
+  };
+
+}  // namespace idfTokenizer
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDF_IDFTOKENIZER_HPP
@@ -7,12 +7,15 @@
 #include "IdfFixture.hpp"
 
 #include "../IdfFile.hpp"
+#include "../IdfObject_Impl.hpp"
 #include "../ValidityReport.hpp"
 
 #include "../../time/Time.hpp"
+#include "../../core/Filesystem.hpp"
 
 #include <resources.hxx>
 #include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/IddFactory.hxx>
 
 #include <iostream>
 #include <sstream>
@@ -132,3 +135,183 @@ TEST_F(IdfFixture, IdfFile_ObjectComments) {
   oFile->print(outFile);
 }
 */
+
+TEST_F(IdfFixture, IdfFile_TokenizerRoundTrip) {
+  std::vector<openstudio::path> paths{resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf"),
+                                      resourcesPath() / toPath("energyplus/Daylighting_School/in.idf"),
+                                      resourcesPath() / toPath("energyplus/SmallOffice/SmallOffice.idf")};
+  for (const openstudio::path& p : paths) {
+    openstudio::filesystem::ifstream inFile(p);
+    ASSERT_TRUE(inFile.is_open());
+    OptionalIdfFile file = IdfFile::load(inFile, IddFileType::EnergyPlus);
+    ASSERT_TRUE(file);
+    std::stringstream text;
+    file->print(text);
+
+    // printing and loading again gives back the same file
+    OptionalIdfFile reloaded = IdfFile::load(text, IddFileType::EnergyPlus);
+    ASSERT_TRUE(reloaded);
+    EXPECT_EQ(file->header(), reloaded->header());
+    ASSERT_EQ(file->numObjects(), reloaded->numObjects());
+    std::stringstream reloadedText;
+    reloaded->print(reloadedText);
+    EXPECT_EQ(text.str(), reloadedText.str()) << toString(p);
+  }
+
+  // comments, several fields on a line and mixed line endings
+  std::string text = "! Header line 1\r\n! Header line 2\n\n"
+                     "! Comment only object\r\n\r\n"
+                     "  ! Zone comment\n"
+                     "Zone,  ! Type comment\r"
+                     "  ! Another comment\n"
+                     "  Zone 1, 0, ! North Axis comment\n"
+                     "  0,  !- X Origin\n"
+                     "  ! not a field\n"
+                     "  0, 0;\n"
+                     "\n"
+                     "Timestep,4;\n";
+  std::stringstream ss(text);
+  OptionalIdfFile file = IdfFile::load(ss, IddFileType::EnergyPlus);
+  ASSERT_TRUE(file);
+  EXPECT_EQ("! Header line 1\n! Header line 2", file->header());
+
+  IdfObjectVector commentOnlyObjects = file->getObjectsByType(IddObjectType::CommentOnly);
+  ASSERT_EQ(1u, commentOnlyObjects.size());
+  EXPECT_EQ("! Comment only object", commentOnlyObjects[0].comment());
+
+  IdfObjectVector zones = file->getObjectsByType(IddObjectType::Zone);
+  ASSERT_EQ(1u, zones.size());
+  EXPECT_EQ("Zone 1", zones[0].nameString());
+  EXPECT_EQ("! Zone comment\n! Type comment\n! Another comment", zones[0].comment());
+  ASSERT_TRUE(zones[0].fieldComment(1));
+  EXPECT_EQ("! North Axis comment", zones[0].fieldComment(1).get());
+  EXPECT_EQ("0", zones[0].getString(4).get());
+
+  IdfObjectVector timesteps = file->getObjectsByType(IddObjectType::Timestep);
+  ASSERT_EQ(1u, timesteps.size());
+  EXPECT_EQ(4, timesteps[0].getInt(0).get());
+}
+
+TEST_F(IdfFixture, IdfFile_AddObjectCopyMatchesPrintAndLoad) {
+  openstudio::filesystem::ifstream inFile(resourcesPath() / toPath("energyplus/5ZoneAirCooled/in.idf"));
+  ASSERT_TRUE(inFile.is_open());
+  OptionalIdfFile original = IdfFile::load(inFile, IddFileType::EnergyPlus);
+  ASSERT_TRUE(original);
+
+  // same IDD, but as a separate IddFile, as VersionTranslator sees the IDD of each version
+  IddFile iddFile = IddFactory::instance().getIddFile(IddFileType::EnergyPlus);
+  IdfFile copied(iddFile);
+  copied.setHeader(original->header());
+  std::stringstream text;
+  text << original->header() << '\n' << '\n' << copied.versionObject().get();
+  for (const IdfObject& object : original->objects()) {
+    copied.addObjectCopy(object);
+    text << object;
+  }
+  OptionalIdfFile loaded = IdfFile::load(text, iddFile);
+  ASSERT_TRUE(loaded);
+
+  ASSERT_EQ(loaded->numObjects(), copied.numObjects());
+  std::stringstream loadedText;
+  std::stringstream copiedText;
+  loaded->print(loadedText);
+  copied.print(copiedText);
+  EXPECT_EQ(loadedText.str(), copiedText.str());
+
+  IdfObjectVector originalObjects = original->objects();
+  IdfObjectVector copiedObjects = copied.objects();
+  for (unsigned i = 0, n = originalObjects.size(); i < n; ++i) {
+    EXPECT_NE(originalObjects[i], copiedObjects[i]);
+    EXPECT_EQ(originalObjects[i].iddObject().name(), copiedObjects[i].iddObject().name());
+  }
+
+  // an IDD that drops a field of Zone and does not know Timestep
+  std::stringstream iddText;
+  iddText << "!IDD_Version 1.0.0" << '\n'
+          << '\n'
+          << "\\group Test" << '\n'
+          << '\n'
+          << "Version," << '\n'
+          << "  A1 ; \\field Version Identifier" << '\n'
+          << '\n'
+          << "Zone," << '\n'
+          << "  A1 , \\field Name" << '\n'
+          << "  N1 ; \\field Direction of Relative North" << '\n';
+  OptionalIddFile smallIddFile = IddFile::load(iddText);
+  ASSERT_TRUE(smallIddFile);
+  IdfFile small(*smallIddFile);
+  IdfObject zone(IddObjectType::Zone);
+  EXPECT_TRUE(zone.setName("Zone 1"));
+  EXPECT_TRUE(zone.setDouble(1, 30.0));
+  EXPECT_TRUE(zone.setDouble(2, 1.0));
+  small.addObjectCopy(zone);
+  small.addObjectCopy(IdfObject(IddObjectType::Timestep));
+  IdfObjectVector smallObjects = small.objects();
+  ASSERT_EQ(2u, smallObjects.size());
+  EXPECT_EQ("Zone", smallObjects[0].iddObject().name());
+  EXPECT_EQ(2u, smallObjects[0].numFields());
+  EXPECT_EQ("Zone 1", smallObjects[0].nameString());
+  ASSERT_TRUE(smallObjects[0].getDouble(1));
+  EXPECT_EQ(30.0, smallObjects[0].getDouble(1).get());
+  EXPECT_EQ(IddObjectType::Catchall, smallObjects[1].iddObject().type().value());
+  EXPECT_EQ("Timestep", smallObjects[1].getString(0).get());
+
+  // copying the Catchall objects back resolves them by the type in their first field, as loading their text does
+  IdfObject building(IddObjectType::Building);
+  EXPECT_TRUE(building.setName("Building 1"));
+  EXPECT_TRUE(building.setDouble(1, 30.0));
+  small.addObjectCopy(building);
+  smallObjects = small.objects();
+  ASSERT_EQ(3u, smallObjects.size());
+  EXPECT_EQ(IddObjectType::Catchall, smallObjects[2].iddObject().type().value());
+  IdfFile resolved(iddFile);
+  std::stringstream resolvedText;
+  resolvedText << resolved.versionObject().get();
+  for (const IdfObject& object : {smallObjects[1], smallObjects[2]}) {
+    resolved.addObjectCopy(object);
+    resolvedText << object;
+  }
+  OptionalIdfFile resolvedLoaded = IdfFile::load(resolvedText, iddFile);
+  ASSERT_TRUE(resolvedLoaded);
+  std::stringstream resolvedLoadedText;
+  std::stringstream resolvedCopiedText;
+  resolvedLoaded->print(resolvedLoadedText);
+  resolved.print(resolvedCopiedText);
+  EXPECT_EQ(resolvedLoadedText.str(), resolvedCopiedText.str());
+
+  IdfObjectVector resolvedObjects = resolved.objects();
+  ASSERT_EQ(2u, resolvedObjects.size());
+  EXPECT_EQ(IddObjectType::Timestep, resolvedObjects[0].iddObject().type().value());
+  EXPECT_EQ(IddObjectType::Building, resolvedObjects[1].iddObject().type().value());
+  EXPECT_EQ("Building 1", resolvedObjects[1].nameString());
+  ASSERT_TRUE(resolvedObjects[1].getDouble(1));
+  EXPECT_EQ(30.0, resolvedObjects[1].getDouble(1).get());
+
+  // IdfObject_Impl::pushString does not encode separators, printing and loading splits such values up and so must the copy
+  OptionalIdfObject variable = IdfObject::load("Output:Variable,*,Site Outdoor Air Drybulb Temperature;");
+  ASSERT_TRUE(variable);
+  EXPECT_TRUE(variable->getImpl<openstudio::detail::IdfObject_Impl>()->pushString("Hourly, Always On"));
+  OptionalIdfObject otherVariable = IdfObject::load("Output:Variable,*;");
+  ASSERT_TRUE(otherVariable);
+  EXPECT_TRUE(otherVariable->getImpl<openstudio::detail::IdfObject_Impl>()->pushString("Site Outdoor Air Wetbulb Temperature ! from the weather file"));
+  IdfFile separators(iddFile);
+  std::stringstream separatorsText;
+  separatorsText << separators.versionObject().get();
+  for (const IdfObject& object : {*variable, *otherVariable}) {
+    separators.addObjectCopy(object);
+    separatorsText << object;
+  }
+  OptionalIdfFile separatorsLoaded = IdfFile::load(separatorsText, iddFile);
+  ASSERT_TRUE(separatorsLoaded);
+  std::stringstream separatorsLoadedText;
+  std::stringstream separatorsCopiedText;
+  separatorsLoaded->print(separatorsLoadedText);
+  separators.print(separatorsCopiedText);
+  EXPECT_EQ(separatorsLoadedText.str(), separatorsCopiedText.str());
+
+  IdfObjectVector variables = separators.getObjectsByType(IddObjectType::Output_Variable);
+  ASSERT_EQ(2u, variables.size());
+  EXPECT_EQ("Hourly", variables[0].getString(2).get());
+  EXPECT_EQ("Always On", variables[0].getString(3).get());
+  EXPECT_EQ("Site Outdoor Air Wetbulb Temperature", variables[1].getString(1).get());
+}
@@ -1018,3 +1018,56 @@ TEST_F(IdfFixture, IdfObject_initializeFields) {
     EXPECT_EQ(0, intercepter.numOnDataChange);
   }
 }
+
+TEST_F(IdfFixture, IdfObject_GetDouble_FromChars) {
+  // plain decimal fields are parsed with std::from_chars, make sure they give the same numbers as boost::lexical_cast
+  IdfObject object(IddObjectType::BuildingSurface_Detailed);
+  EXPECT_FALSE(object.pushExtensibleGroup({"1.5", "+2", "1e-320"}).empty());
+  ASSERT_EQ(14u, object.numFields());
+
+  ASSERT_TRUE(object.getDouble(11));
+  EXPECT_EQ(1.5, object.getDouble(11).get());
+  // a leading '+' and subnormals are left to boost::lexical_cast
+  ASSERT_TRUE(object.getDouble(12));
+  EXPECT_EQ(2.0, object.getDouble(12).get());
+  ASSERT_TRUE(object.getInt(12));
+  EXPECT_EQ(2, object.getInt(12).get());
+  ASSERT_TRUE(object.getDouble(13));
+  EXPECT_EQ(boost::lexical_cast<double>("1e-320"), object.getDouble(13).get());
+
+  EXPECT_TRUE(object.setString(11, "abc"));
+  EXPECT_FALSE(object.getDouble(11));
+  EXPECT_TRUE(object.setDouble(11, 0.1));
+  EXPECT_EQ("0.1", object.getString(11).get());
+  ASSERT_TRUE(object.getDouble(11));
+  EXPECT_EQ(0.1, object.getDouble(11).get());
+
+  // values set from double are parsed back from their text
+  EXPECT_TRUE(object.setDouble(11, 1.0 / 3.0));
+  ASSERT_TRUE(object.getDouble(11));
+  EXPECT_EQ(boost::lexical_cast<double>(object.getString(11).get()), object.getDouble(11).get());
+
+  // replace the group
+  EXPECT_FALSE(object.popExtensibleGroup().empty());
+  EXPECT_FALSE(object.getDouble(11));
+  EXPECT_FALSE(object.pushExtensibleGroup({"7", "8", "9"}).empty());
+  ASSERT_TRUE(object.getDouble(11));
+  EXPECT_EQ(7.0, object.getDouble(11).get());
+  ASSERT_TRUE(object.getUnsigned(13));
+  EXPECT_EQ(9u, object.getUnsigned(13).get());
+
+  // clones keep their numbers, but do not share them
+  IdfObject clone = object.clone();
+  EXPECT_TRUE(object.setDouble(11, -4.25));
+  ASSERT_TRUE(clone.getDouble(11));
+  EXPECT_EQ(7.0, clone.getDouble(11).get());
+  ASSERT_TRUE(object.getDouble(11));
+  EXPECT_EQ(-4.25, object.getDouble(11).get());
+
+  // autocalculate is not a number
+  ASSERT_TRUE(object.iddObject().getField(9)->properties().autocalculatable);
+  EXPECT_TRUE(object.setDouble(9, 4.0));
+  EXPECT_TRUE(object.getDouble(9));
+  EXPECT_TRUE(object.setString(9, "autocalculate"));
+  EXPECT_FALSE(object.getDouble(9));
+}
@@ -27,6 +27,7 @@
 #include "../WorkspaceObject_Impl.hpp"
 
 #include "../../core/Optional.hpp"
+#include "../../idd/IddFile.hpp"
 
 using namespace openstudio;
 
@@ -488,6 +489,99 @@ TEST_F(IdfFixture, WorkspaceObject_Filter_Sources) {
   EXPECT_EQ(1, sourcesVector.size());
 }
 
+TEST_F(IdfFixture, WorkspaceObject_SourcesOfTypes) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  OptionalWorkspaceObject node = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject node2 = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  WorkspaceObjectVector spms;
+  for (int i = 0; i < 5; ++i) {
+    OptionalWorkspaceObject spm = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+    ASSERT_TRUE(spm);
+    EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node->handle()));
+    EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node->handle()));
+    spms.push_back(*spm);
+  }
+
+  EXPECT_EQ(5u, node->sources().size());
+  EXPECT_EQ(10u, node->numSources());
+  EXPECT_EQ(5u, node->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_Node).empty());
+
+  // the test is only run once per IddObjectType
+  int numTests = 0;
+  auto nodeImpl = node->getImpl<detail::WorkspaceObject_Impl>();
+  WorkspaceObjectVector sources = nodeImpl->getSourcesOfTypes([&numTests](const WorkspaceObject& source) {
+    ++numTests;
+    return (source.iddObject().type() == IddObjectType::OS_SetpointManager_MixedAir);
+  });
+  EXPECT_EQ(1, numTests);
+  EXPECT_EQ(node->sources(), sources);
+  EXPECT_TRUE(nodeImpl->getSourcesOfTypes([](const WorkspaceObject&) { return false; }).empty());
+
+  // moving a pointer updates both ends
+  EXPECT_TRUE(spms[0].setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node2->handle()));
+  EXPECT_EQ(5u, node->sources().size());
+  EXPECT_EQ(9u, node->numSources());
+  ASSERT_EQ(1u, node2->sources().size());
+  EXPECT_EQ(spms[0], node2->sources()[0]);
+  ASSERT_TRUE(spms[0].getTarget(OS_SetpointManager_MixedAirFields::FanInletNodeName));
+  EXPECT_EQ(node2->handle(), spms[0].getTarget(OS_SetpointManager_MixedAirFields::FanInletNodeName)->handle());
+
+  EXPECT_FALSE(spms[1].remove().empty());
+  EXPECT_EQ(4u, node->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
+  EXPECT_EQ(7u, node->numSources());
+}
+
+TEST_F(IdfFixture, WorkspaceObject_SourcesOfTypes_CustomIdd) {
+  // every object of a custom IDD has IddObjectType::UserCustom, so each source is tested on its own
+  std::stringstream iddText;
+  iddText << "!IDD_Version 1.0.0" << '\n'
+          << '\n'
+          << "\\group Test" << '\n'
+          << '\n'
+          << "Version," << '\n'
+          << "  A1 ; \\field Version Identifier" << '\n'
+          << '\n'
+          << "Zone," << '\n'
+          << "  A1 ; \\field Name" << '\n'
+          << "       \\reference ZoneNames" << '\n'
+          << '\n'
+          << "Lights," << '\n'
+          << "  A1 , \\field Name" << '\n'
+          << "  A2 ; \\field Zone Name" << '\n'
+          << "       \\type object-list" << '\n'
+          << "       \\object-list ZoneNames" << '\n'
+          << '\n'
+          << "People," << '\n'
+          << "  A1 , \\field Name" << '\n'
+          << "  A2 ; \\field Zone Name" << '\n'
+          << "       \\type object-list" << '\n'
+          << "       \\object-list ZoneNames" << '\n';
+  OptionalIddFile iddFile = IddFile::load(iddText);
+  ASSERT_TRUE(iddFile);
+
+  Workspace ws(*iddFile, StrictnessLevel::Draft);
+  OptionalWorkspaceObject zone = ws.addObject(IdfObject(iddFile->getObject("Zone").get()));
+  ASSERT_TRUE(zone);
+  EXPECT_TRUE(zone->setName("Zone 1"));
+  for (const std::string& type : {"Lights", "People", "Lights"}) {
+    OptionalWorkspaceObject source = ws.addObject(IdfObject(iddFile->getObject(type).get()));
+    ASSERT_TRUE(source);
+    EXPECT_TRUE(source->setPointer(1, zone->handle()));
+  }
+  ASSERT_EQ(3u, zone->sources().size());
+
+  int numTests = 0;
+  WorkspaceObjectVector lights = zone->getImpl<detail::WorkspaceObject_Impl>()->getSourcesOfTypes([&numTests](const WorkspaceObject& source) {
+    ++numTests;
+    return (source.iddObject().name() == "Lights");
+  });
+  EXPECT_EQ(3, numTests);
+  ASSERT_EQ(2u, lights.size());
+  EXPECT_EQ("Lights", lights[0].iddObject().name());
+  EXPECT_EQ("Lights", lights[1].iddObject().name());
+}
+
 TEST_F(IdfFixture, WorkspaceObject_SetDouble_NaN_and_Inf) {
 
   // try with an WorkspaceObject
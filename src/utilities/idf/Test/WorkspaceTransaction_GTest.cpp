@@ -0,0 +1,230 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+#include "../WorkspaceTransaction.hpp"
+#include "../WorkspaceWatcher.hpp"
+#include "../Workspace.hpp"
+#include "../Workspace_Impl.hpp"
+#include "../WorkspaceObject.hpp"
+#include "../WorkspaceObject_Impl.hpp"
+#include "../IdfExtensibleGroup.hpp"
+
+#include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
+#include <utilities/idd/IddEnums.hxx>
+
+#include <stdexcept>
+
+using namespace openstudio;
+
+namespace {
+
+// counts the signals of a workspace and one of its objects
+class SignalCounter : public Nano::Observer
+{
+ public:
+  SignalCounter(const Workspace& workspace, const WorkspaceObject& object) {
+    auto workspaceImpl = workspace.getImpl<detail::Workspace_Impl>();
+    workspaceImpl->detail::Workspace_Impl::onChange.connect<SignalCounter, &SignalCounter::workspaceChange>(this);
+    workspaceImpl->detail::Workspace_Impl::onImmediateChange.connect<SignalCounter, &SignalCounter::immediateWorkspaceChange>(this);
+    workspaceImpl->detail::Workspace_Impl::addWorkspaceObject.connect<SignalCounter, &SignalCounter::objectAdd>(this);
+
+    auto objectImpl = object.getImpl<detail::WorkspaceObject_Impl>();
+    objectImpl->detail::WorkspaceObject_Impl::onChange.connect<SignalCounter, &SignalCounter::change>(this);
+    objectImpl->detail::WorkspaceObject_Impl::onNameChange.connect<SignalCounter, &SignalCounter::nameChange>(this);
+    objectImpl->detail::WorkspaceObject_Impl::onDataChange.connect<SignalCounter, &SignalCounter::dataChange>(this);
+    objectImpl->detail::WorkspaceObject_Impl::onRelationshipChange.connect<SignalCounter, &SignalCounter::relationshipChange>(this);
+  }
+
+  void workspaceChange() {
+    ++workspaceChanges;
+  }
+
+  void immediateWorkspaceChange() {
+    ++immediateWorkspaceChanges;
+  }
+
+  void objectAdd(const WorkspaceObject& /*object*/, const IddObjectType& /*type*/, const UUID& /*handle*/) {
+    ++objectsAdded;
+  }
+
+  void change() {
+    ++changes;
+  }
+
+  void nameChange() {
+    ++nameChanges;
+  }
+
+  void dataChange() {
+    ++dataChanges;
+  }
+
+  void relationshipChange(int /*index*/, Handle /*newHandle*/, Handle /*oldHandle*/) {
+    ++relationshipChanges;
+  }
+
+  int workspaceChanges = 0;
+  int immediateWorkspaceChanges = 0;
+  int objectsAdded = 0;
+  int changes = 0;
+  int nameChanges = 0;
+  int dataChanges = 0;
+  int relationshipChanges = 0;
+};
+
+}  // namespace
+
+TEST_F(IdfFixture, WorkspaceTransaction_CoalescesSignals) {
+  Workspace workspace(epIdfFile);
+  WorkspaceObjectVector result = workspace.getObjectsByName("C5-1");
+  ASSERT_EQ(1u, result.size());
+  WorkspaceObject surface = result[0];
+  ASSERT_TRUE(surface.getTarget(BuildingSurface_DetailedFields::ConstructionName));
+  SignalCounter counter(workspace, surface);
+  WorkspaceWatcher watcher(workspace);
+
+  {
+    WorkspaceTransaction transaction(workspace);
+    EXPECT_TRUE(transaction.isOpen());
+    EXPECT_TRUE(workspace.getImpl<detail::Workspace_Impl>()->isBatchingSignals());
+
+    EXPECT_TRUE(surface.setName("Surface 1"));
+    EXPECT_TRUE(surface.setName("Surface 2"));
+    EXPECT_TRUE(surface.setString(BuildingSurface_DetailedFields::OutsideBoundaryCondition, "Surface"));
+    EXPECT_TRUE(surface.setString(BuildingSurface_DetailedFields::OutsideBoundaryCondition, "Outdoors"));
+    EXPECT_TRUE(surface.setPointer(BuildingSurface_DetailedFields::ConstructionName, Handle()));
+    ASSERT_TRUE(workspace.addObject(IdfObject(IddObjectType::Lights)));
+
+    // caches are still told right away
+    EXPECT_EQ(5, counter.changes);
+    EXPECT_LE(6, counter.immediateWorkspaceChanges);
+    EXPECT_EQ(0, counter.nameChanges);
+    EXPECT_EQ(0, counter.dataChanges);
+    EXPECT_EQ(0, counter.relationshipChanges);
+    EXPECT_EQ(0, counter.objectsAdded);
+    EXPECT_EQ(0, counter.workspaceChanges);
+    EXPECT_FALSE(watcher.dirty());
+    EXPECT_EQ("Surface 2", surface.nameString());
+
+    transaction.commit();
+    EXPECT_FALSE(transaction.isOpen());
+  }
+
+  EXPECT_FALSE(workspace.getImpl<detail::Workspace_Impl>()->isBatchingSignals());
+  EXPECT_EQ(1, counter.nameChanges);
+  EXPECT_EQ(1, counter.dataChanges);
+  EXPECT_EQ(1, counter.relationshipChanges);
+  EXPECT_EQ(1, counter.objectsAdded);
+  EXPECT_EQ(1, counter.workspaceChanges);
+  EXPECT_TRUE(watcher.dirty());
+  EXPECT_TRUE(watcher.objectAdded());
+  EXPECT_EQ("Surface 2", surface.nameString());
+  EXPECT_FALSE(surface.getTarget(BuildingSurface_DetailedFields::ConstructionName));
+
+  // an object added and removed in the same transaction is never announced
+  {
+    WorkspaceTransaction transaction(workspace);
+    OptionalWorkspaceObject lights = workspace.addObject(IdfObject(IddObjectType::Lights));
+    ASSERT_TRUE(lights);
+    EXPECT_TRUE(lights->remove().size() == 1u);
+  }
+  EXPECT_EQ(1, counter.objectsAdded);
+  EXPECT_EQ(2, counter.workspaceChanges);
+}
+
+TEST_F(IdfFixture, WorkspaceTransaction_Abort) {
+  Workspace workspace(epIdfFile);
+  WorkspaceObjectVector result = workspace.getObjectsByName("C5-1");
+  ASSERT_EQ(1u, result.size());
+  WorkspaceObject surface = result[0];
+  OptionalWorkspaceObject construction = surface.getTarget(BuildingSurface_DetailedFields::ConstructionName);
+  ASSERT_TRUE(construction);
+  std::string constructionName = construction->nameString();
+  unsigned constructionSources = construction->numSources();
+  std::string outsideBoundary = surface.getString(BuildingSurface_DetailedFields::OutsideBoundaryCondition).get();
+  unsigned numFields = surface.numFields();
+  unsigned numObjects = workspace.numObjects();
+  SignalCounter counter(workspace, surface);
+
+  {
+    WorkspaceTransaction transaction(workspace);
+    EXPECT_TRUE(surface.setName("Surface 1"));
+    EXPECT_TRUE(surface.setString(BuildingSurface_DetailedFields::OutsideBoundaryCondition, "Adiabatic"));
+    EXPECT_FALSE(surface.pushExtensibleGroup(StringVector{"1.0", "2.0", "3.0"}).empty());
+    ASSERT_TRUE(workspace.addObject(IdfObject(IddObjectType::Lights)));
+    EXPECT_FALSE(construction->remove().empty());
+    EXPECT_FALSE(construction->initialized());
+    EXPECT_FALSE(surface.getTarget(BuildingSurface_DetailedFields::ConstructionName));
+    transaction.abort();
+  }
+
+  // the removed object itself is put back, so handles to it work again
+  EXPECT_TRUE(construction->initialized());
+  EXPECT_EQ(constructionName, construction->nameString());
+  EXPECT_EQ(constructionSources, construction->numSources());
+
+  EXPECT_EQ("C5-1", surface.nameString());
+  EXPECT_EQ(outsideBoundary, surface.getString(BuildingSurface_DetailedFields::OutsideBoundaryCondition).get());
+  EXPECT_EQ(numFields, surface.numFields());
+  EXPECT_EQ(numObjects, workspace.numObjects());
+  OptionalWorkspaceObject target = surface.getTarget(BuildingSurface_DetailedFields::ConstructionName);
+  ASSERT_TRUE(target);
+  EXPECT_EQ(construction->handle(), target->handle());
+  EXPECT_EQ(construction->getImpl<detail::WorkspaceObject_Impl>(), target->getImpl<detail::WorkspaceObject_Impl>());
+  EXPECT_EQ(1u, workspace.getObjectsByName("C5-1").size());
+
+  // nothing that was undone is announced
+  EXPECT_EQ(0, counter.nameChanges);
+  EXPECT_EQ(0, counter.dataChanges);
+  EXPECT_EQ(0, counter.relationshipChanges);
+}
+
+TEST_F(IdfFixture, WorkspaceTransaction_AbortOnException) {
+  Workspace workspace(epIdfFile);
+  WorkspaceObjectVector result = workspace.getObjectsByName("C5-1");
+  ASSERT_EQ(1u, result.size());
+  WorkspaceObject surface = result[0];
+
+  try {
+    WorkspaceTransaction transaction(workspace);
+    EXPECT_TRUE(surface.setName("Surface 1"));
+    throw std::runtime_error("Measure failed");
+  } catch (const std::runtime_error&) {
+  }
+
+  EXPECT_EQ("C5-1", surface.nameString());
+  EXPECT_FALSE(workspace.getImpl<detail::Workspace_Impl>()->isBatchingSignals());
+}
+
+TEST_F(IdfFixture, WorkspaceTransaction_Nested) {
+  Workspace workspace(epIdfFile);
+  WorkspaceObjectVector result = workspace.getObjectsByName("C5-1");
+  ASSERT_EQ(1u, result.size());
+  WorkspaceObject surface = result[0];
+  SignalCounter counter(workspace, surface);
+
+  {
+    WorkspaceTransaction outer(workspace);
+    EXPECT_TRUE(surface.setName("Surface 1"));
+    {
+      WorkspaceTransaction inner(workspace);
+      EXPECT_TRUE(surface.setName("Surface 2"));
+      inner.abort();
+    }
+    EXPECT_EQ("Surface 1", surface.nameString());
+    {
+      WorkspaceTransaction inner(workspace);
+      EXPECT_TRUE(surface.setName("Surface 3"));
+    }
+    EXPECT_EQ(0, counter.nameChanges);
+    EXPECT_EQ(0, counter.workspaceChanges);
+  }
+
+  EXPECT_EQ("Surface 3", surface.nameString());
+  EXPECT_EQ(1, counter.nameChanges);
+  EXPECT_EQ(1, counter.workspaceChanges);
+}
@@ -16,6 +16,7 @@
 #include "../WorkspaceExtensibleGroup.hpp"
 
 #include "../../idd/IddEnums.hpp"
+#include "../../idd/IddFile.hpp"
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 #include <utilities/idd/Building_FieldEnums.hxx>
@@ -46,6 +47,7 @@
 using namespace openstudio;
 
 #include <iostream>
+#include <sstream>
 
 TEST_F(IdfFixture, IdfFile_Workspace_DefaultConstructor) {
   Workspace workspaceNone(StrictnessLevel::Minimal);
@@ -513,6 +515,38 @@ TEST_F(IdfFixture, Workspace_Clone) {
   EXPECT_FALSE(cloneHandles == wsHandles);
 }
 
+TEST_F(IdfFixture, Workspace_Clone_SharesFields) {
+  // a clone shares the field values of every object with the original until one side changes them
+  Workspace workspace(epIdfFile, StrictnessLevel::Minimal);
+  Workspace clone = workspace.clone(true);
+
+  WorkspaceObjectVector wsObjects = workspace.getObjectsByType(IddObjectType::Building);
+  ASSERT_EQ(1u, wsObjects.size());
+  OptionalWorkspaceObject cloneBuilding = clone.getObject(wsObjects[0].handle());
+  ASSERT_TRUE(cloneBuilding);
+  auto buildingImpl = wsObjects[0].getImpl<detail::IdfObject_Impl>();
+  auto cloneBuildingImpl = cloneBuilding->getImpl<detail::IdfObject_Impl>();
+  EXPECT_TRUE(cloneBuildingImpl->sharesFieldsWith(*buildingImpl));
+
+  std::string name = wsObjects[0].nameString();
+  EXPECT_TRUE(cloneBuilding->setName("MyNewBuildingName"));
+  EXPECT_FALSE(cloneBuildingImpl->sharesFieldsWith(*buildingImpl));
+  EXPECT_EQ(name, wsObjects[0].nameString());
+  EXPECT_EQ("MyNewBuildingName", cloneBuilding->nameString());
+
+  // changing the original leaves the clone as it was
+  wsObjects = workspace.getObjectsByType(IddObjectType::Zone);
+  ASSERT_FALSE(wsObjects.empty());
+  OptionalWorkspaceObject cloneZone = clone.getObject(wsObjects[0].handle());
+  ASSERT_TRUE(cloneZone);
+  EXPECT_TRUE(cloneZone->getImpl<detail::IdfObject_Impl>()->sharesFieldsWith(*wsObjects[0].getImpl<detail::IdfObject_Impl>()));
+  name = wsObjects[0].nameString();
+  EXPECT_TRUE(wsObjects[0].setName("MyNewZoneName"));
+  EXPECT_FALSE(cloneZone->getImpl<detail::IdfObject_Impl>()->sharesFieldsWith(*wsObjects[0].getImpl<detail::IdfObject_Impl>()));
+  EXPECT_EQ(name, cloneZone->nameString());
+  EXPECT_EQ("MyNewZoneName", wsObjects[0].nameString());
+}
+
 TEST_F(IdfFixture, Workspace_Insert) {
   Workspace workspace(epIdfFile, StrictnessLevel::Minimal);
   unsigned n = workspace.handles().size();
@@ -2028,6 +2062,63 @@ TEST_F(IdfFixture, Workspace_GetObjectsByNameUUID) {
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", false).size());
 }
 
+TEST_F(IdfFixture, Workspace_NameIndex) {
+  // StrictnessLevel::None so that names can be cleared
+  Workspace ws(StrictnessLevel::None, IddFileType::EnergyPlus);
+
+  boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  boost::optional<WorkspaceObject> zoneList = ws.addObject(IdfObject(IddObjectType::ZoneList));
+  ASSERT_TRUE(zoneList);
+  EXPECT_TRUE(zoneList->setName("Zone 2"));
+
+  // lookups are case insensitive and by type
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "ZONE 1"));
+  EXPECT_EQ(zone->handle(), ws.getObjectByTypeAndName(IddObjectType::Zone, "ZONE 1")->handle());
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::ZoneList, "Zone 1"));
+  EXPECT_EQ(1u, ws.getObjectsByTypeAndName(IddObjectType::ZoneList, "zone 1").size());
+  EXPECT_EQ(2u, ws.getObjectsByName("zone 1", false).size());
+
+  // renames through setName and setString
+  EXPECT_TRUE(zone->setName("Core Zone"));
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone 1").size());
+  EXPECT_EQ(1u, ws.getObjectsByName("core zone").size());
+  EXPECT_TRUE(zone->setString(ZoneFields::Name, "Perimeter Zone 3"));
+  EXPECT_EQ(0u, ws.getObjectsByName("Core Zone").size());
+  EXPECT_EQ(1u, ws.getObjectsByName("Perimeter Zone", false).size());
+  EXPECT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "perimeter zone 3"));
+
+  // objects with empty names can still be found
+  EXPECT_TRUE(zoneList->setName(""));
+  EXPECT_EQ(1u, ws.getObjectsByTypeAndName(IddObjectType::ZoneList, "").size());
+  EXPECT_EQ(0u, ws.getObjectsByName("Zone 2").size());
+
+  // removal
+  EXPECT_FALSE(zone->remove().empty());
+  EXPECT_EQ(0u, ws.getObjectsByName("Perimeter Zone 3").size());
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Perimeter Zone 3"));
+
+  // swap
+  Workspace other(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  ASSERT_TRUE(other.addObject(IdfObject(IddObjectType::Zone)));
+  ws.swap(other);
+  EXPECT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Zone 1"));
+  EXPECT_EQ(1u, other.getObjectsByTypeAndName(IddObjectType::ZoneList, "").size());
+  EXPECT_FALSE(other.getObjectByTypeAndName(IddObjectType::Zone, "Zone 1"));
+
+  // every object of a real file can be found by type and name
+  Workspace workspace(epIdfFile, StrictnessLevel::Draft);
+  for (const WorkspaceObject& object : workspace.objects()) {
+    boost::optional<std::string> name = object.name();
+    if (!name || name->empty()) {
+      continue;
+    }
+    boost::optional<WorkspaceObject> found = workspace.getObjectByTypeAndName(object.iddObject().type(), boost::to_upper_copy(*name));
+    ASSERT_TRUE(found) << object.briefDescription();
+    EXPECT_TRUE(istringEqual(*name, found->name().get()));
+  }
+}
+
 TEST_F(IdfFixture, Workspace_DuplicateObjectName) {
   Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
@@ -2102,3 +2193,105 @@ TEST_F(IdfFixture, Workspace_getObjects_Type_StringOverload) {
     EXPECT_EQ(expectedErrorMessage, std::string(e.what()));
   }
 }
+
+TEST_F(IdfFixture, Workspace_ObjectPool) {
+  // off by default
+  ASSERT_FALSE(Workspace::objectPoolingEnabled());
+  {
+    Workspace workspace(epIdfFile);
+    EXPECT_FALSE(workspace.getImpl<detail::Workspace_Impl>()->objectPool());
+    EXPECT_TRUE(workspace.getObjectByTypeAndName(IddObjectType::Zone, "SPACE1-1"));
+  }
+
+  Workspace::setObjectPoolingEnabled(true);
+  std::shared_ptr<detail::WorkspaceObjectPool> pool;
+  OptionalWorkspaceObject zone;
+  {
+    Workspace workspace(epIdfFile);
+    pool = workspace.getImpl<detail::Workspace_Impl>()->objectPool();
+    ASSERT_TRUE(pool);
+    EXPECT_EQ(workspace.numObjects(), pool->numBlocksInUse());
+    EXPECT_GT(workspace.numObjects(), pool->numSlabs());
+
+    // removed objects give their block back once nothing refers to them
+    OptionalWorkspaceObject lights = workspace.addObject(IdfObject(IddObjectType::Lights));
+    ASSERT_TRUE(lights);
+    EXPECT_EQ(workspace.numObjects(), pool->numBlocksInUse());
+    lights->remove();
+    lights.reset();
+    EXPECT_EQ(workspace.numObjects(), pool->numBlocksInUse());
+
+    zone = workspace.getObjectByTypeAndName(IddObjectType::Zone, "SPACE1-1");
+    ASSERT_TRUE(zone);
+  }
+
+  Workspace::setObjectPoolingEnabled(false);
+
+  // objects still held keep the pool, and all of its slabs, alive after the workspace is gone
+  EXPECT_EQ(1u, pool->numBlocksInUse());
+  EXPECT_LT(0u, pool->numSlabs());
+
+  // the slabs are released once the workspace and all of its objects are gone
+  zone.reset();
+  EXPECT_EQ(0u, pool->numBlocksInUse());
+  EXPECT_EQ(0u, pool->numSlabs());
+}
+
+TEST_F(IdfFixture, Workspace_ObjectPool_SlabGrowth) {
+  // slabs of 4, 8, 16 and 32 KB hold 960 blocks of 64 bytes, the slabs after that are capped at 64 KB
+  detail::WorkspaceObjectPool pool(1 << 12, 1 << 16);
+  std::vector<void*> blocks;
+  for (unsigned i = 0; i < 960; ++i) {
+    blocks.push_back(pool.allocate(64, 8));
+  }
+  EXPECT_EQ(4u, pool.numSlabs());
+  for (unsigned i = 0; i < 1100; ++i) {
+    blocks.push_back(pool.allocate(64, 8));
+  }
+  EXPECT_EQ(6u, pool.numSlabs());
+  EXPECT_EQ(blocks.size(), pool.numBlocksInUse());
+
+  // the slabs are given back once the last block is freed
+  for (void* block : blocks) {
+    pool.deallocate(block, 64, 8);
+  }
+  EXPECT_EQ(0u, pool.numBlocksInUse());
+  EXPECT_EQ(0u, pool.numSlabs());
+}
+
+TEST_F(IdfFixture, Workspace_Clone_CustomIddReferences) {
+  // every object of a custom IDD has IddObjectType::UserCustom, their reference lists must still be kept apart
+  std::stringstream iddText;
+  iddText << "!IDD_Version 1.0.0" << '\n'
+          << '\n'
+          << "\\group Test" << '\n'
+          << '\n'
+          << "Version," << '\n'
+          << "  A1 ; \\field Version Identifier" << '\n'
+          << '\n'
+          << "Zone," << '\n'
+          << "  A1 ; \\field Name" << '\n'
+          << "       \\reference ZoneNames" << '\n'
+          << '\n'
+          << "Schedule," << '\n'
+          << "  A1 ; \\field Name" << '\n'
+          << "       \\reference ScheduleNames" << '\n';
+  OptionalIddFile iddFile = IddFile::load(iddText);
+  ASSERT_TRUE(iddFile);
+
+  Workspace workspace(*iddFile, StrictnessLevel::Draft);
+  IdfObject zone(iddFile->getObject("Zone").get());
+  EXPECT_TRUE(zone.setName("Zone 1"));
+  IdfObject schedule(iddFile->getObject("Schedule").get());
+  EXPECT_TRUE(schedule.setName("Schedule 1"));
+  ASSERT_TRUE(workspace.addObject(zone));
+  ASSERT_TRUE(workspace.addObject(schedule));
+
+  Workspace clone = workspace.clone();
+  std::vector<WorkspaceObject> zones = clone.getObjectsByReference("ZoneNames");
+  ASSERT_EQ(1u, zones.size());
+  EXPECT_EQ("Zone 1", zones[0].nameString());
+  std::vector<WorkspaceObject> schedules = clone.getObjectsByReference("ScheduleNames");
+  ASSERT_EQ(1u, schedules.size());
+  EXPECT_EQ("Schedule 1", schedules[0].nameString());
+}
@@ -8,6 +8,8 @@
 
 #include "IdfFile.hpp"
 #include "ValidityReport.hpp"
+#include "WorkspaceObjectDiff.hpp"
+#include "WorkspaceObjectDiff_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
@@ -18,6 +20,8 @@
 #include "../core/StringHelpers.hpp"
 
 #include <boost/lexical_cast.hpp>
+#include <atomic>
+#include <map>
 #include <memory>
 
 using namespace std;
@@ -27,12 +31,36 @@ namespace openstudio {
 
 namespace detail {
 
+  // key of name in the name indices, folds case the same way istringEqual does
+  static std::string nameIndexKey(const std::string& name) {
+    std::string result(name);
+    for (char& c : result) {
+      c = static_cast<char>(toupper(c));
+    }
+    return result;
+  }
+
+  // workspaces allocate their objects from a pool only if this is set, off by default since any object kept alive holds on
+  // to every slab of its workspace's pool
+  static std::atomic<bool>& objectPoolingEnabledFlag() {
+    static std::atomic<bool> enabled(false);
+    return enabled;
+  }
+
+  static std::shared_ptr<WorkspaceObjectPool> newObjectPool() {
+    if (objectPoolingEnabledFlag()) {
+      return std::make_shared<WorkspaceObjectPool>();
+    }
+    return nullptr;
+  }
+
   // CONSTRUCTORS
 
   Workspace_Impl::Workspace_Impl(StrictnessLevel level, IddFileType iddFileType)
     : m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_objectPool(newObjectPool()),
       m_workspaceObjectOrder(std::make_shared<WorkspaceObjectOrder_Impl>(
         HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })) {
     m_workspaceObjectMap.reserve(1 << 15);
@@ -44,6 +72,7 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_objectPool(newObjectPool()),
       m_workspaceObjectOrder(std::make_shared<WorkspaceObjectOrder_Impl>(
         HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })) {
     m_workspaceObjectMap.reserve(1 << 15);
@@ -55,6 +84,7 @@ namespace detail {
       m_header(other.m_header),
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_objectPool(newObjectPool()),
       m_workspaceObjectOrder(std::make_shared<WorkspaceObjectOrder_Impl>(
         HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })) {
     // m_workspaceObjectOrder
@@ -75,6 +105,7 @@ namespace detail {
       m_header(),  // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_objectPool(newObjectPool()),
       m_workspaceObjectOrder(std::make_shared<WorkspaceObjectOrder_Impl>(
         HandleVector(), [this](const Handle& handle) -> boost::optional<WorkspaceObject> { return getObject(handle); })) {
     // m_workspaceObjectOrder
@@ -151,6 +182,10 @@ namespace detail {
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+
+    m_nameIndex.swap(otherImpl->m_nameIndex);
+    m_baseNameIndex.swap(otherImpl->m_baseNameIndex);
+    m_nameIndexKeys.swap(otherImpl->m_nameIndexKeys);
   }
 
   // GETTERS
@@ -314,7 +349,7 @@ namespace detail {
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByName(const std::string& name, bool exactMatch) const {
     WorkspaceObjectVector result;
     if (exactMatch) {
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      for (const WorkspaceObjectMap::value_type& p : nameIndexCandidates(m_nameIndex, name)) {
         if (OptionalString candidate = p.second->name()) {
           if (istringEqual(*candidate, name)) {
             result.push_back(WorkspaceObject(p.second));
@@ -323,7 +358,7 @@ namespace detail {
       }
     } else {
       std::string baseName = getBaseName(name);
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      for (const WorkspaceObjectMap::value_type& p : nameIndexCandidates(m_baseNameIndex, baseName)) {
         if (OptionalString candidate = p.second->name()) {
           if (baseNamesMatch(baseName, *candidate)) {
             result.push_back(WorkspaceObject(p.second));
@@ -358,10 +393,13 @@ namespace detail {
   }
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const {
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      OptionalString candidate = object.name();
+    for (const WorkspaceObjectMap::value_type& p : nameIndexCandidates(m_nameIndex, name)) {
+      if (p.second->iddObject().type() != objectType) {
+        continue;
+      }
+      OptionalString candidate = p.second->name();
       if (candidate && istringEqual(*candidate, name)) {
-        return object;
+        return WorkspaceObject(p.second);
       }
     }
     return boost::none;
@@ -370,10 +408,13 @@ namespace detail {
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByTypeAndName(IddObjectType objectType, const std::string& name) const {
     WorkspaceObjectVector result;
     std::string baseName = getBaseName(name);
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      if (OptionalString candidate = object.name()) {
+    for (const WorkspaceObjectMap::value_type& p : nameIndexCandidates(m_baseNameIndex, baseName)) {
+      if (p.second->iddObject().type() != objectType) {
+        continue;
+      }
+      if (OptionalString candidate = p.second->name()) {
         if (baseNamesMatch(baseName, *candidate)) {
-          result.push_back(object);
+          result.push_back(WorkspaceObject(p.second));
         }
       }
     }
@@ -411,10 +452,17 @@ namespace detail {
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByNameAndReference(const std::string& name,
                                                                                const std::vector<std::string>& referenceNames) const {
-    for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate, name)) {
-        return object;
+    for (const WorkspaceObjectMap::value_type& p : nameIndexCandidates(m_nameIndex, name)) {
+      OptionalString candidate = p.second->name();
+      if (!candidate || !istringEqual(*candidate, name)) {
+        continue;
+      }
+      // references may have been forwarded, so look in m_idfReferencesMap rather than at the IddObject
+      for (const std::string& referenceName : referenceNames) {
+        auto loc = m_idfReferencesMap.find(referenceName);
+        if ((loc != m_idfReferencesMap.end()) && (loc->second.find(p.first) != loc->second.end())) {
+          return WorkspaceObject(p.second);
+        }
       }
     }
     return boost::none;
@@ -424,6 +472,18 @@ namespace detail {
     return m_fastNaming;
   }
 
+  std::shared_ptr<WorkspaceObjectPool> Workspace_Impl::objectPool() const {
+    return m_objectPool;
+  }
+
+  bool Workspace_Impl::objectPoolingEnabled() {
+    return objectPoolingEnabledFlag();
+  }
+
+  void Workspace_Impl::setObjectPoolingEnabled(bool enabled) {
+    objectPoolingEnabledFlag() = enabled;
+  }
+
   // SETTERS
 
   bool Workspace_Impl::setStrictnessLevel(StrictnessLevel level) {
@@ -436,13 +496,13 @@ namespace detail {
 
   // Helper function to start the process of adding an object to the workspace.
   std::shared_ptr<WorkspaceObject_Impl> Workspace_Impl::createObject(const IdfObject& object, bool keepHandle) {
-    return WorkspaceObject_ImplPtr(new WorkspaceObject_Impl(object, this, keepHandle));
+    return makeObjectImpl<WorkspaceObject_Impl>(object, this, keepHandle);
   }
 
   // Helper function to start the process of adding a cloned object to the workspace.
   WorkspaceObject_ImplPtr Workspace_Impl::createObject(const std::shared_ptr<WorkspaceObject_Impl>& originalObjectImplPtr, bool keepHandle) {
     OS_ASSERT(originalObjectImplPtr);
-    return WorkspaceObject_ImplPtr(new WorkspaceObject_Impl(*originalObjectImplPtr, this, keepHandle));
+    return makeObjectImpl<WorkspaceObject_Impl>(*originalObjectImplPtr, this, keepHandle);
   }
 
   std::vector<WorkspaceObject> Workspace_Impl::addObjects(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs, bool checkNames) {
@@ -551,11 +611,27 @@ namespace detail {
 
     // step 1: add objects to maps
     HandleVector newHandles;
+    newHandles.reserve(objectImplPtrs.size());
+    m_workspaceObjectMap.reserve(m_workspaceObjectMap.size() + objectImplPtrs.size());
+    // many objects share a type, only ask the IddObject for its reference lists once per type
+    std::map<IddObjectType, StringVector> referencesByType;
     for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
       newHandles.push_back(ptr->handle());
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(), ptr));
       insertIntoIddObjectTypeMap(ptr);
-      insertIntoIdfReferencesMap(ptr);
+      const IddObject& iddObject = ptr->iddObject();
+      IddObjectType type = iddObject.type();
+      if ((type == IddObjectType::UserCustom) || (type == IddObjectType::Catchall)) {
+        // these IddObjects differ from one object to the next, the type says nothing about their references
+        insertIntoIdfReferencesMap(ptr);
+      } else {
+        auto referencesIt = referencesByType.find(type);
+        if (referencesIt == referencesByType.end()) {
+          referencesIt = referencesByType.emplace(type, iddObject.references()).first;
+        }
+        insertIntoIdfReferencesMap(ptr, referencesIt->second);
+      }
+      insertIntoNameIndex(ptr);
       this->progressValue.nano_emit(++i);
     }
 
@@ -590,6 +666,7 @@ namespace detail {
 
     // step 5: register initialization
     WorkspaceObjectVector newObjects;
+    newObjects.reserve(objectImplPtrs.size());
     for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
       ptr->setInitialized();
       newObjects.push_back(WorkspaceObject(ptr));
@@ -1371,9 +1448,18 @@ namespace detail {
       return true;
     }  // trivially satisfied
 
-    this->removeWorkspaceObject.nano_emit(WorkspaceObject(objectData->objectImplPtr), objectData->objectImplPtr->iddObject().type(),
-                                          objectData->handle);
-    this->removeWorkspaceObjectPtr.nano_emit(objectData->objectImplPtr, objectData->objectImplPtr->iddObject().type(), objectData->handle);
+    // an object added and removed again while reverting a batch was never announced
+    if (!m_revertingBatch) {
+      this->removeWorkspaceObject.nano_emit(WorkspaceObject(objectData->objectImplPtr), objectData->objectImplPtr->iddObject().type(),
+                                            objectData->handle);
+      this->removeWorkspaceObjectPtr.nano_emit(objectData->objectImplPtr, objectData->objectImplPtr->iddObject().type(), objectData->handle);
+    }
+
+    // keep the object and its pointers, so that a batch can add it back
+    BatchedChange batchedChange;
+    if ((m_batchDepth > 0) && !m_revertingBatch) {
+      batchedChange.removedObjects.push_back(removedObject(*objectData));
+    }
 
     // actual work of removing from maps--is always successful
     WorkspaceObjectVector sources = nominallyRemoveObject(handle);
@@ -1382,7 +1468,11 @@ namespace detail {
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
       registerRemovalOfObject(objectData->objectImplPtr, sources, removedHandles);
-      this->onChange.nano_emit();
+      // logged after the sources let go of the object, so that it is added back before they point to it again
+      if (!batchedChange.removedObjects.empty()) {
+        m_batchedChanges.push_back(std::move(batchedChange));
+      }
+      change();
       return true;
     } else {
       restoreObject(*objectData);
@@ -1404,10 +1494,19 @@ namespace detail {
       }
     }
 
-    for (SavedWorkspaceObject savedObject : objectData) {
-      this->removeWorkspaceObject.nano_emit(WorkspaceObject(savedObject.objectImplPtr), savedObject.objectImplPtr->iddObject().type(),
-                                            savedObject.handle);
-      this->removeWorkspaceObjectPtr.nano_emit(savedObject.objectImplPtr, savedObject.objectImplPtr->iddObject().type(), savedObject.handle);
+    if (!m_revertingBatch) {
+      for (SavedWorkspaceObject savedObject : objectData) {
+        this->removeWorkspaceObject.nano_emit(WorkspaceObject(savedObject.objectImplPtr), savedObject.objectImplPtr->iddObject().type(),
+                                              savedObject.handle);
+        this->removeWorkspaceObjectPtr.nano_emit(savedObject.objectImplPtr, savedObject.objectImplPtr->iddObject().type(), savedObject.handle);
+      }
+    }
+
+    BatchedChange batchedChange;
+    if ((m_batchDepth > 0) && !m_revertingBatch) {
+      for (const SavedWorkspaceObject& savedObject : objectData) {
+        batchedChange.removedObjects.push_back(removedObject(savedObject));
+      }
     }
 
     // actual work of removing from maps--is always successful
@@ -1415,7 +1514,10 @@ namespace detail {
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       registerRemovalOfObjects(objectData, sources, handles);
-      this->onChange.nano_emit();
+      if (!batchedChange.removedObjects.empty()) {
+        m_batchedChanges.push_back(std::move(batchedChange));
+      }
+      change();
       return true;
     } else {
       restoreObjects(objectData);
@@ -1525,6 +1627,23 @@ namespace detail {
     return iotmLoc->second.size();
   }
 
+  std::vector<IddObjectType> Workspace_Impl::iddObjectTypes() const {
+    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+    if (!versionIdd) {
+      return {};
+    }
+
+    std::vector<IddObjectType> result;
+    result.reserve(m_iddObjectTypeMap.size());
+    for (const auto& [type, objects] : m_iddObjectTypeMap) {
+      // objects of a custom IDD all share IddObjectType::UserCustom, so its version object cannot be told apart here
+      if (!objects.empty() && ((type != versionIdd->type()) || (type == IddObjectType::UserCustom))) {
+        result.push_back(type);
+      }
+    }
+    return result;
+  }
+
   unsigned Workspace_Impl::numObjectsOfType(const IddObject& objectType) const {
     return getObjectsByType(objectType).size();
   }
@@ -1846,6 +1965,19 @@ namespace detail {
     return objectName;
   }
 
+  const Workspace_Impl::WorkspaceObjectMap& Workspace_Impl::nameIndexCandidates(const NameIndex& index, const std::string& name) const {
+    // objects with empty names are not indexed
+    if (name.empty()) {
+      return m_workspaceObjectMap;
+    }
+    auto loc = index.find(nameIndexKey(name));
+    if (loc == index.end()) {
+      static const WorkspaceObjectMap noObjects;
+      return noObjects;
+    }
+    return loc->second;
+  }
+
   boost::optional<WorkspaceObject> Workspace_Impl::getEquivalentObject(const IdfObject& other) const {
     // never overwrite existing version object
     if (other.iddObject().isVersionObject()) {
@@ -1922,6 +2054,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
 
+    // NameIndex
+    insertIntoNameIndex(ptr);
+
     return true;
   }
 
@@ -1934,11 +2069,58 @@ namespace detail {
   }
 
   void Workspace_Impl::insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
-    StringVector references = objectImplPtr->iddObject().references();
+    insertIntoIdfReferencesMap(objectImplPtr, objectImplPtr->iddObject().references());
+  }
+
+  void Workspace_Impl::insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr, const StringVector& references) {
     for (const std::string& referenceName : references) {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    OptionalString name = objectImplPtr->name();
+    if (!name || name->empty()) {
+      return;
+    }
+    std::string key = nameIndexKey(*name);
+    m_nameIndex[key].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
+    // case folding does not touch the characters getBaseName looks at
+    std::string baseKey = getBaseName(key);
+    if (!baseKey.empty()) {
+      m_baseNameIndex[baseKey].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
+    }
+    m_nameIndexKeys[objectImplPtr->handle()] = key;
+  }
+
+  void Workspace_Impl::eraseFromNameIndex(const Handle& handle) {
+    auto keyLoc = m_nameIndexKeys.find(handle);
+    if (keyLoc == m_nameIndexKeys.end()) {
+      return;
+    }
+    auto erase = [&handle](NameIndex& index, const std::string& key) {
+      auto loc = index.find(key);
+      if (loc != index.end()) {
+        loc->second.erase(handle);
+        // erase entry if set is empty
+        if (loc->second.empty()) {
+          index.erase(loc);
+        }
+      }
+    };
+    erase(m_nameIndex, keyLoc->second);
+    erase(m_baseNameIndex, getBaseName(keyLoc->second));
+    m_nameIndexKeys.erase(keyLoc);
+  }
+
+  void Workspace_Impl::updateNameIndex(const Handle& handle) {
+    auto womIt = m_workspaceObjectMap.find(handle);
+    if (womIt == m_workspaceObjectMap.end()) {
+      return;
+    }
+    eraseFromNameIndex(handle);
+    insertIntoNameIndex(womIt->second);
+  }
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2130,6 +2312,9 @@ namespace detail {
       }
     }
 
+    // NameIndex
+    eraseFromNameIndex(handle);
+
     // IddObjectTypeMap
     auto iotmLoc = m_iddObjectTypeMap.find(objectImplPtr->iddObject().type());
     OS_ASSERT(iotmLoc != m_iddObjectTypeMap.end());
@@ -2182,12 +2367,22 @@ namespace detail {
     }
   }
 
-  void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object) {
+  void Workspace_Impl::registerAdditionOfObject(const WorkspaceObject& object, bool restored) {
     object.getImpl<WorkspaceObject_Impl>().get()->WorkspaceObject_Impl::onChange.connect<Workspace_Impl, &Workspace_Impl::change>(this);
-    auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
-    this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
-    this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
-    this->onChange.nano_emit();
+    if (m_batchDepth > 0) {
+      m_batchedAdditions.push_back(object);
+      if (!restored && !m_revertingBatch) {
+        BatchedChange batchedChange;
+        batchedChange.handle = object.handle();
+        batchedChange.added = true;
+        m_batchedChanges.push_back(std::move(batchedChange));
+      }
+    } else {
+      auto sh_ptr = object.getImpl<WorkspaceObject_Impl>();
+      this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
+      this->addWorkspaceObjectPtr.nano_emit(sh_ptr, object.iddObject().type(), object.handle());
+    }
+    change();
   }
 
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
@@ -2205,6 +2400,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
 
+    // NameIndex
+    insertIntoNameIndex(savedObject.objectImplPtr);
+
     // Fix Pointers
     savedObject.objectImplPtr->restorePointers();
 
@@ -2212,7 +2410,7 @@ namespace detail {
     WorkspaceObject workspaceObject(savedObject.objectImplPtr);
 
     // emit signals
-    registerAdditionOfObject(workspaceObject);
+    registerAdditionOfObject(workspaceObject, true);
   }
 
   void Workspace_Impl::restoreObjects(SavedWorkspaceObjectVector& savedObjects) {
@@ -2319,19 +2517,200 @@ namespace detail {
     return result;
   }
 
+  void Workspace_Impl::objectFieldsChange(const WorkspaceObject_Impl& /*object*/,
+                                          const std::vector<std::tuple<unsigned, Handle, Handle>>& /*relationshipChanges*/) {}
+
   void Workspace_Impl::change() {
-    this->onChange.nano_emit();
+    this->onImmediateChange.nano_emit();
+    if (m_batchDepth > 0) {
+      m_batchedChange = true;
+    } else {
+      this->onChange.nano_emit();
+    }
+  }
+
+  size_t Workspace_Impl::startBatch() {
+    ++m_batchDepth;
+    return m_batchedChanges.size();
+  }
+
+  void Workspace_Impl::commitBatch() {
+    OS_ASSERT(m_batchDepth > 0);
+    --m_batchDepth;
+    if (m_batchDepth == 0) {
+      m_batchedChanges.clear();
+      emitBatchedSignals();
+    }
+  }
+
+  void Workspace_Impl::abortBatch(size_t savepoint) {
+    OS_ASSERT(m_batchDepth > 0);
+    OS_ASSERT(savepoint <= m_batchedChanges.size());
+
+    // undo in reverse order, changes made while reverting are not recorded
+    m_revertingBatch = true;
+    while (m_batchedChanges.size() > savepoint) {
+      BatchedChange batchedChange = std::move(m_batchedChanges.back());
+      m_batchedChanges.pop_back();
+      revertBatchedChange(batchedChange);
+    }
+    m_revertingBatch = false;
+
+    --m_batchDepth;
+    if (m_batchDepth == 0) {
+      // nobody saw the changes that were undone, but objects that were removed and added back
+      // have to be announced again, they are the only additions still in the workspace
+      m_batchedObjectSignals.clear();
+      m_batchedObjectIndices.clear();
+      emitBatchedSignals();
+    }
+  }
+
+  bool Workspace_Impl::isBatchingSignals() const {
+    return (m_batchDepth > 0);
+  }
+
+  void Workspace_Impl::batchChangeSignals(const std::shared_ptr<WorkspaceObject_Impl>& object, std::vector<IdfObjectDiff> diffs, unsigned numFields,
+                                          bool nameChange, bool dataChange,
+                                          const std::vector<std::tuple<unsigned, Handle, Handle>>& relationshipChanges) {
+    OS_ASSERT(m_batchDepth > 0);
+
+    auto [it, inserted] = m_batchedObjectIndices.emplace(object.get(), m_batchedObjectSignals.size());
+    if (inserted) {
+      m_batchedObjectSignals.emplace_back();
+      m_batchedObjectSignals.back().object = object;
+    }
+    BatchedObjectSignals& signals = m_batchedObjectSignals[it->second];
+    signals.nameChange = signals.nameChange || nameChange;
+    signals.dataChange = signals.dataChange || dataChange;
+    for (const auto& [index, newHandle, oldHandle] : relationshipChanges) {
+      // keep the target from before the batch, so that a field set back to it is not reported
+      auto [relationshipIt, relationshipInserted] = signals.relationshipChanges.emplace(index, std::make_pair(newHandle, oldHandle));
+      if (!relationshipInserted) {
+        relationshipIt->second.first = newHandle;
+      }
+    }
+
+    if (!m_revertingBatch) {
+      BatchedChange batchedChange;
+      batchedChange.handle = object->handle();
+      batchedChange.diffs = std::move(diffs);
+      batchedChange.numFields = numFields;
+      m_batchedChanges.push_back(std::move(batchedChange));
+    }
+  }
+
+  Workspace_Impl::RemovedObject Workspace_Impl::removedObject(const SavedWorkspaceObject& savedObject) const {
+    RemovedObject result{savedObject, {}};
+    for (unsigned index : savedObject.objectImplPtr->objectListFields()) {
+      if (OptionalWorkspaceObject target = savedObject.objectImplPtr->getTarget(index)) {
+        result.targets.emplace_back(index, target->handle());
+      }
+    }
+    return result;
+  }
+
+  void Workspace_Impl::revertBatchedChange(const BatchedChange& batchedChange) {
+    if (!batchedChange.removedObjects.empty()) {
+      // put back the objects themselves, so that handles to them kept by callers work again
+      for (const RemovedObject& removedObject : batchedChange.removedObjects) {
+        SavedWorkspaceObject savedObject = removedObject.savedObject;
+        savedObject.objectImplPtr->reconnect(this, savedObject.handle);
+        restoreObject(savedObject);
+      }
+      // then their pointers, which may be to each other. Sources that pointed to them are reverted next.
+      for (const RemovedObject& removedObject : batchedChange.removedObjects) {
+        const WorkspaceObject_ImplPtr& objectImplPtr = removedObject.savedObject.objectImplPtr;
+        for (const auto& [index, targetHandle] : removedObject.targets) {
+          objectImplPtr->setPointer(index, targetHandle, false);
+        }
+        objectImplPtr->emitChangeSignals();
+      }
+      return;
+    }
+
+    OptionalWorkspaceObject object = getObject(batchedChange.handle);
+    if (!object) {
+      return;
+    }
+
+    if (batchedChange.added) {
+      removeObject(batchedChange.handle);
+      return;
+    }
+
+    std::shared_ptr<WorkspaceObject_Impl> objectImplPtr = object->getImpl<WorkspaceObject_Impl>();
+    for (auto it = batchedChange.diffs.rbegin(); it != batchedChange.diffs.rend(); ++it) {
+      OptionalUnsigned index = it->index();
+      if (!index) {
+        // object comment, the old one is not recorded
+        continue;
+      }
+      if (boost::optional<WorkspaceObjectDiff> workspaceObjectDiff = it->optionalCast<WorkspaceObjectDiff>()) {
+        objectImplPtr->setPointer(*index, workspaceObjectDiff->oldHandle().get_value_or(Handle()), false);
+      } else if (OptionalString oldValue = it->oldValue()) {
+        // also puts back popped fields, diffs are undone in reverse order
+        objectImplPtr->setString(*index, *oldValue, false);
+      }
+    }
+    // drop the fields added by the change
+    if (objectImplPtr->numFields() > batchedChange.numFields) {
+      objectImplPtr->restoreOriginalNumFields(batchedChange.numFields);
+    }
+    // clears the diffs, and lets the object clear its caches
+    objectImplPtr->emitChangeSignals();
+  }
+
+  void Workspace_Impl::emitBatchedSignals() {
+    // slots may change the workspace, or open a batch of their own
+    std::vector<WorkspaceObject> additions = std::move(m_batchedAdditions);
+    std::vector<BatchedObjectSignals> objectSignals = std::move(m_batchedObjectSignals);
+    bool workspaceChange = m_batchedChange;
+    m_batchedAdditions.clear();
+    m_batchedObjectSignals.clear();
+    m_batchedObjectIndices.clear();
+    m_batchedChange = false;
+
+    for (const WorkspaceObject& object : additions) {
+      // skip objects removed again before the end of the batch
+      if (object.initialized()) {
+        this->addWorkspaceObject.nano_emit(object, object.iddObject().type(), object.handle());
+        this->addWorkspaceObjectPtr.nano_emit(object.getImpl<WorkspaceObject_Impl>(), object.iddObject().type(), object.handle());
+      }
+    }
+
+    for (BatchedObjectSignals& signals : objectSignals) {
+      if (!signals.object->initialized()) {
+        continue;
+      }
+      for (const auto& [index, handles] : signals.relationshipChanges) {
+        if (handles.first != handles.second) {
+          signals.object->onRelationshipChange.nano_emit(index, handles.first, handles.second);
+        }
+      }
+      if (signals.nameChange) {
+        signals.object->onNameChange.nano_emit();
+      }
+      if (signals.dataChange) {
+        signals.object->onDataChange.nano_emit();
+      }
+    }
+
+    if (workspaceChange) {
+      this->onChange.nano_emit();
+    }
   }
 
   void Workspace_Impl::createAndAddClonedObjects(const std::shared_ptr<detail::Workspace_Impl>& /*thisImpl*/,
                                                  std::shared_ptr<detail::Workspace_Impl> cloneImpl, bool keepHandles) const {
     detail::WorkspaceObject_ImplPtrVector newObjectImplPtrs;
+    newObjectImplPtrs.reserve(m_workspaceObjectMap.size());
     HandleMap oldNewHandleMap;
-    for (const WorkspaceObject& object : allObjects()) {
-      newObjectImplPtrs.push_back(cloneImpl->createObject(object.getImpl<detail::WorkspaceObject_Impl>(), keepHandles));
-      Handle h = newObjectImplPtrs.back()->handle();
+    // walk the object map directly rather than allObjects(), which would build a vector of every object first
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      newObjectImplPtrs.push_back(cloneImpl->createObject(p.second, keepHandles));
       if (!keepHandles) {
-        oldNewHandleMap.insert(HandleMap::value_type(object.handle(), h));
+        oldNewHandleMap.insert(HandleMap::value_type(p.first, newObjectImplPtrs.back()->handle()));
       }
     }
     // add Object_ImplPtrs to clone's Workspace_Impl
@@ -2521,6 +2900,10 @@ bool Workspace::fastNaming() const {
   return m_impl->fastNaming();
 }
 
+bool Workspace::objectPoolingEnabled() {
+  return detail::Workspace_Impl::objectPoolingEnabled();
+}
+
 // SETTERS
 
 bool Workspace::setStrictnessLevel(StrictnessLevel level) {
@@ -2582,6 +2965,10 @@ void Workspace::setFastNaming(bool fastNaming) {
   m_impl->setFastNaming(fastNaming);
 }
 
+void Workspace::setObjectPoolingEnabled(bool enabled) {
+  detail::Workspace_Impl::setObjectPoolingEnabled(enabled);
+}
+
 // ORDER
 
 WorkspaceObjectOrder Workspace::order() {
@@ -210,6 +210,10 @@ class UTILITIES_API Workspace
    *  objects and does not do any name conflict checking. */
   bool fastNaming() const;
 
+  /** Returns true if Workspaces constructed from now on allocate their objects from a
+   *  per-Workspace pool rather than one heap allocation per object. Disabled by default. */
+  static bool objectPoolingEnabled();
+
   //@}
   /** @name Setters */
   //@{
@@ -316,6 +320,12 @@ class UTILITIES_API Workspace
    *  handle. */
   void setFastNaming(bool fastNaming);
 
+  /** Sets whether Workspaces constructed from now on allocate their objects from a pool. The
+   *  pool is released once the Workspace and all of its objects are destroyed, so a single
+   *  object kept from a large Workspace keeps all of its memory. Best suited to short-lived
+   *  processes that load large files. */
+  static void setObjectPoolingEnabled(bool enabled);
+
   //@}
   /** @name Object Order */
   //@{
@@ -31,6 +31,7 @@ namespace detail {
   WorkspaceObject_Impl::WorkspaceObject_Impl(const IdfObject& idfObject, Workspace_Impl* workspace, bool keepHandle)
     : IdfObject_Impl(*(idfObject.getImpl<detail::IdfObject_Impl>()), keepHandle),  // clones idfObject data
       m_initialized(false),
+      m_numFieldsAtLastChange(0),
       m_workspace(workspace) {
     if (!m_iddObject.objectLists().empty()) {
       // can nominally be source
@@ -45,6 +46,7 @@ namespace detail {
   WorkspaceObject_Impl::WorkspaceObject_Impl(const WorkspaceObject_Impl& other, Workspace_Impl* workspace, bool keepHandle)
     : IdfObject_Impl(other, keepHandle),
       m_initialized(false),
+      m_numFieldsAtLastChange(0),
       m_workspace(workspace),
       m_sourceData(other.m_sourceData),
       m_targetData(other.m_targetData) {}
@@ -108,6 +110,7 @@ namespace detail {
     OS_ASSERT(m_workspace);
     if (m_sourceData) {
       SourceData::pointer_set mappedPointers;
+      mappedPointers.reserve(m_sourceData->pointers.size());
       for (const ForwardPointer& fp : m_sourceData->pointers) {
         Handle th = openstudio::applyHandleMap(fp.targetHandle, oldNewHandleMap);
         if (th.isNull() && !fp.targetHandle.isNull() && !oldNewHandleMap.empty()) {
@@ -116,7 +119,7 @@ namespace detail {
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(), fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(), fp.fieldIndex, iddObject().type());
             th = fp.targetHandle;
           }
         }
@@ -129,10 +132,11 @@ namespace detail {
     }
     if (m_targetData) {
       TargetData::pointer_set mappedPointers;
+      mappedPointers.reserve(m_targetData->reversePointers.size());
       for (const ReversePointer& rp : m_targetData->reversePointers) {
         Handle sh = openstudio::applyHandleMap(rp.sourceHandle, oldNewHandleMap);
         if (!sh.isNull()) {
-          mappedPointers.insert(ReversePointer(sh, rp.fieldIndex));
+          mappedPointers.insert(ReversePointer(sh, rp.fieldIndex, rp.sourceType));
         }
       }
       m_targetData->reversePointers = mappedPointers;
@@ -289,13 +293,52 @@ namespace detail {
       return result;
     }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
+      // the sources of one type are contiguous, only those are looked up
+      auto it = m_targetData->reversePointers.lower_bound(type);
+      auto itEnd = m_targetData->reversePointers.upper_bound(type);
+      for (; it != itEnd; ++it) {
+        OS_ASSERT(!it->sourceHandle.isNull());
+        OptionalWorkspaceObject owo = this->workspace().getObject(it->sourceHandle);
         OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) {
+        result.push_back(*owo);
+      }
+      std::sort(result.begin(), result.end());
+      result.erase(std::unique(result.begin(), result.end()), result.end());
+    }
+    return result;
+  }
+
+  WorkspaceObjectVector WorkspaceObject_Impl::getSourcesOfTypes(const std::function<bool(const WorkspaceObject&)>& isWantedType) const {
+    WorkspaceObjectVector result;
+    if (!initialized()) {
+      return result;
+    }
+    if (m_targetData) {
+      auto it = m_targetData->reversePointers.begin();
+      auto itEnd = m_targetData->reversePointers.end();
+      while (it != itEnd) {
+        auto typeEnd = m_targetData->reversePointers.upper_bound(it->sourceType);
+        // UserCustom and Catchall objects of different IddObjects share one IddObjectType, so check each of those
+        bool checkEachSource = (it->sourceType == IddObjectType::UserCustom) || (it->sourceType == IddObjectType::Catchall);
+        OptionalWorkspaceObject owo = this->workspace().getObject(it->sourceHandle);
+        OS_ASSERT(owo);
+        if (checkEachSource) {
+          for (; it != typeEnd; ++it) {
+            owo = this->workspace().getObject(it->sourceHandle);
+            OS_ASSERT(owo);
+            if (isWantedType(*owo)) {
+              result.push_back(*owo);
+            }
+          }
+        } else if (isWantedType(*owo)) {
           result.push_back(*owo);
+          for (++it; it != typeEnd; ++it) {
+            owo = this->workspace().getObject(it->sourceHandle);
+            OS_ASSERT(owo);
+            result.push_back(*owo);
+          }
         }
+        it = typeEnd;
       }
       std::sort(result.begin(), result.end());
       result.erase(std::unique(result.begin(), result.end()), result.end());
@@ -860,7 +903,7 @@ namespace detail {
     }
 
     // construct new IdfObject from WorkspaceObject's data
-    IdfObject_ImplPtr result(new IdfObject_Impl(m_handle, m_comment, m_iddObject, m_fields, m_fieldComments));
+    IdfObject_ImplPtr result(new IdfObject_Impl(m_handle, m_comment, m_iddObject, m_fields.get(), m_fieldComments));
     // add name references based on WorkspaceObject's pointer data
     if (m_sourceData) {
       bool serializeHandle = m_iddObject.hasHandleField();
@@ -893,7 +936,7 @@ namespace detail {
     }
 
     // construct new IdfObject from WorkspaceObject's data
-    IdfObject_ImplPtr result(new IdfObject_Impl(m_handle, m_comment, m_iddObject, m_fields, m_fieldComments));
+    IdfObject_ImplPtr result(new IdfObject_Impl(m_handle, m_comment, m_iddObject, m_fields.get(), m_fieldComments));
     // add name references based on WorkspaceObject's pointer data
     if (m_sourceData) {
       bool serializeHandle = m_iddObject.hasHandleField();
@@ -930,6 +973,10 @@ namespace detail {
     bool nameChange = false;
     bool dataChange = false;
 
+    // hold back signals if the workspace is batching them, objects still being added are not watched yet
+    bool batched = initialized() && m_workspace->isBatchingSignals();
+    std::vector<std::tuple<unsigned, Handle, Handle>> relationshipChanges;
+
     for (const IdfObjectDiff& diff : m_diffs) {
 
       if (diff.isNull()) {
@@ -955,7 +1002,7 @@ namespace detail {
             oldHandle = workspaceObjectDiff.oldHandle().get();
           }
 
-          this->onRelationshipChange.nano_emit(*index, newHandle, oldHandle);
+          relationshipChanges.emplace_back(*index, newHandle, oldHandle);
 
         } else if (oIddField && oIddField->isNameField()) {
           nameChange = true;
@@ -965,23 +1012,39 @@ namespace detail {
       }
     }
 
-    if (nameChange) {
-      this->onNameChange.nano_emit();
+    if (initialized()) {
+      m_workspace->objectFieldsChange(*this, relationshipChanges);
     }
 
-    if (dataChange) {
-      this->onDataChange.nano_emit();
+    if (batched) {
+      m_workspace->batchChangeSignals(getObject<WorkspaceObject>().getImpl<WorkspaceObject_Impl>(), std::move(m_diffs), m_numFieldsAtLastChange,
+                                      nameChange, dataChange, relationshipChanges);
+    } else {
+      for (const auto& [index, newHandle, oldHandle] : relationshipChanges) {
+        this->onRelationshipChange.nano_emit(index, newHandle, oldHandle);
+      }
+
+      if (nameChange) {
+        this->onNameChange.nano_emit();
+      }
+
+      if (dataChange) {
+        this->onDataChange.nano_emit();
+      }
     }
 
+    // never held back, objects clear their caches on it
     this->onChange.nano_emit();
 
     m_diffs.clear();
+    m_numFieldsAtLastChange = numFields();
   }
 
   // PROTECTED
 
   void WorkspaceObject_Impl::setInitialized() {
     m_initialized = true;
+    m_numFieldsAtLastChange = numFields();
   }
 
   void WorkspaceObject_Impl::disconnect() {
@@ -990,6 +1053,13 @@ namespace detail {
     m_workspace = nullptr;
   }
 
+  void WorkspaceObject_Impl::reconnect(Workspace_Impl* workspace, const Handle& handle) {
+    m_handle = handle;
+    m_workspace = workspace;
+    m_diffs.clear();
+    m_numFieldsAtLastChange = numFields();
+  }
+
   // Pre-condition:  field index is a pointer, and its targetHandle is either null or valid in
   //                 m_workspace.
   // Post-condition: field index is a pointer with a null targetHandle.
@@ -999,7 +1069,7 @@ namespace detail {
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
       WorkspaceObject target = *oTarget;
-      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(m_handle, index);
+      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(m_handle, index, iddObject().type());
       // remove forwarded reference if no other source sets the same
       m_workspace->removeForwardedReferences(handle(), index, target);
     }
@@ -1007,19 +1077,16 @@ namespace detail {
     // forward pointer
     auto fpIt = getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers, index);
     OS_ASSERT(fpIt != m_sourceData->pointers.end());
-    m_sourceData->pointers.erase(fpIt);
-    std::pair<SourceData::pointer_set::iterator, bool> insertResult;
-    insertResult = m_sourceData->pointers.insert(ForwardPointer(index, Handle()));
-    OS_ASSERT(insertResult.second);
+    fpIt->targetHandle = Handle();
   }
 
   // Pre-condition:  Object sourceHandle points to this object from field index.
   // Post-condition: That information is removed from this object's m_targetData (in preparation for
   //                 a change to the source pointer).
-  void WorkspaceObject_Impl::nullifyReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::nullifyReversePointer(const Handle& sourceHandle, unsigned index, IddObjectType sourceType) {
     OS_ASSERT(!m_handle.isNull());
     OS_ASSERT(m_targetData);
-    auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle, index));
+    auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle, index, sourceType));
     OS_ASSERT(it != m_targetData->reversePointers.end());
     m_targetData->reversePointers.erase(it);
   }
@@ -1027,14 +1094,14 @@ namespace detail {
   // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
   // Post-condition: m_targetData indicates that object sourceHandle points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index, IddObjectType sourceType) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) {
       m_targetData = TargetData();
     }
     // automatically maintains uniqueness
     std::pair<TargetData::pointer_set::iterator, bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle, index));
+    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle, index, sourceType));
     OS_ASSERT(insertResult.second);
   }
 
@@ -1048,7 +1115,7 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(), h.end(), m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, ptr.fieldIndex, iddObject().type());
             }
           }
         }
@@ -1096,17 +1163,18 @@ namespace detail {
     // add pointer
     fpIt = getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers, index);
     if (fpIt != m_sourceData->pointers.end()) {
-      m_sourceData->pointers.erase(fpIt);
+      fpIt->targetHandle = targetHandle;
+    } else {
+      std::pair<SourceData::pointer_set::iterator, bool> insertResult;
+      insertResult = m_sourceData->pointers.insert(ForwardPointer(index, targetHandle));
+      OS_ASSERT(insertResult.second);
     }
-    std::pair<SourceData::pointer_set::iterator, bool> insertResult;
-    insertResult = m_sourceData->pointers.insert(ForwardPointer(index, targetHandle));
-    OS_ASSERT(insertResult.second);
 
     // add reverse pointer
     if (!targetHandle.isNull()) {
       OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
       OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, index);
+      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, index, iddObject().type());
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle, index, targetHandle);
     }
@@ -1176,7 +1244,7 @@ namespace detail {
     if ((index >= minFields()) && (numExtensibleGroups() == 0)) {
       // delete field
       m_diffs.push_back(IdfObjectDiff(index, m_fields[index], boost::none));
-      m_fields.pop_back();
+      m_fields.edit().pop_back();
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
       }
@@ -1295,6 +1363,14 @@ namespace detail {
     return result;
   }
 
+  // SETTER HELPERS
+
+  void WorkspaceObject_Impl::nameFieldChanged() {
+    if (m_workspace && !m_handle.isNull()) {
+      m_workspace->updateNameIndex(m_handle);
+    }
+  }
+
 }  // namespace detail
 
 bool WorkspaceObject::operator<(const WorkspaceObject& right) const {
@@ -0,0 +1,107 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "WorkspaceObjectPool.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+    constexpr std::size_t maxPooledBlockSize = 4096;
+  }
+
+  WorkspaceObjectPool::WorkspaceObjectPool(std::size_t initialSlabSize, std::size_t maxSlabSize)
+    : m_initialSlabSize(std::max(initialSlabSize, maxPooledBlockSize)),
+      m_maxSlabSize(std::max(maxSlabSize, m_initialSlabSize)),
+      m_nextSlabSize(m_initialSlabSize),
+      m_freeLists(maxPooledBlockSize / blockAlignment + 1, nullptr) {}
+
+  void* WorkspaceObjectPool::allocate(std::size_t bytes, std::size_t alignment) {
+    if (!pooled(bytes, alignment)) {
+      return ::operator new(bytes, std::align_val_t(alignment));
+    }
+
+    const std::size_t units = (bytes + blockAlignment - 1) / blockAlignment;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_numAllocations;
+    ++m_numBlocksInUse;
+
+    if (FreeBlock* block = m_freeLists[units]) {
+      m_freeLists[units] = block->next;
+      return block;
+    }
+
+    const std::size_t blockSize = units * blockAlignment;
+    if (static_cast<std::size_t>(m_slabEnd - m_slabPos) < blockSize) {
+      // the tail of the old slab is dropped, it is smaller than one block
+      m_slabs.emplace_back(new std::byte[m_nextSlabSize]);
+      m_slabPos = m_slabs.back().get();
+      m_slabEnd = m_slabPos + m_nextSlabSize;
+      m_nextSlabSize = std::min(2 * m_nextSlabSize, m_maxSlabSize);
+    }
+    void* result = m_slabPos;
+    m_slabPos += blockSize;
+    return result;
+  }
+
+  void WorkspaceObjectPool::deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+    if (!pooled(bytes, alignment)) {
+      ::operator delete(p, std::align_val_t(alignment));
+      return;
+    }
+
+    const std::size_t units = (bytes + blockAlignment - 1) / blockAlignment;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    OS_ASSERT(m_numBlocksInUse > 0);
+    --m_numBlocksInUse;
+    if (m_numBlocksInUse == 0) {
+      releaseSlabs();
+      return;
+    }
+    auto* block = static_cast<FreeBlock*>(p);
+    block->next = m_freeLists[units];
+    m_freeLists[units] = block;
+  }
+
+  std::size_t WorkspaceObjectPool::numAllocations() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numAllocations;
+  }
+
+  std::size_t WorkspaceObjectPool::numBlocksInUse() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numBlocksInUse;
+  }
+
+  std::size_t WorkspaceObjectPool::numSlabs() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slabs.size();
+  }
+
+  std::size_t WorkspaceObjectPool::maxBlockSize() {
+    return maxPooledBlockSize;
+  }
+
+  void WorkspaceObjectPool::releaseSlabs() {
+    m_slabs.clear();
+    m_slabPos = nullptr;
+    m_slabEnd = nullptr;
+    std::fill(m_freeLists.begin(), m_freeLists.end(), nullptr);
+    m_nextSlabSize = m_initialSlabSize;
+  }
+
+  bool WorkspaceObjectPool::pooled(std::size_t bytes, std::size_t alignment) const {
+    return (bytes > 0) && (bytes <= maxPooledBlockSize) && (alignment <= blockAlignment);
+  }
+
+}  // namespace detail
+}  // namespace openstudio
@@ -0,0 +1,120 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_WORKSPACEOBJECTPOOL_HPP
+#define UTILITIES_IDF_WORKSPACEOBJECTPOOL_HPP
+
+#include <utilities/UtilitiesAPI.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace openstudio {
+namespace detail {
+
+  /** Slab allocator for the WorkspaceObject_Impls of one Workspace. Blocks are carved from slabs
+   *  and recycled through per-size free lists, so that loading a large file does not make one heap
+   *  allocation per object. The first slab has initialSlabSize bytes and each further slab twice as
+   *  many as the one before, up to maxSlabSize, so small Workspaces stay small. Freed blocks go back
+   *  to the free lists, not to the heap: the slabs are only released once no block is in use, so a
+   *  single live object (e.g. a WorkspaceObject kept after its Workspace is gone) keeps every slab
+   *  of the pool alive. Blocks larger than maxBlockSize() are passed on to operator new. Thread-safe,
+   *  objects may be released from any thread. */
+  class UTILITIES_API WorkspaceObjectPool
+  {
+   public:
+    explicit WorkspaceObjectPool(std::size_t initialSlabSize = 1 << 12, std::size_t maxSlabSize = 1 << 20);
+
+    ~WorkspaceObjectPool() = default;
+
+    WorkspaceObjectPool(const WorkspaceObjectPool&) = delete;
+    WorkspaceObjectPool& operator=(const WorkspaceObjectPool&) = delete;
+
+    void* allocate(std::size_t bytes, std::size_t alignment);
+
+    void deallocate(void* p, std::size_t bytes, std::size_t alignment);
+
+    /** Returns the number of blocks handed out since construction. */
+    std::size_t numAllocations() const;
+
+    /** Returns the number of blocks currently in use. */
+    std::size_t numBlocksInUse() const;
+
+    /** Returns the number of slabs currently allocated from the heap. */
+    std::size_t numSlabs() const;
+
+    static std::size_t maxBlockSize();
+
+   private:
+    static constexpr std::size_t blockAlignment = alignof(std::max_align_t);
+
+    struct FreeBlock
+    {
+      FreeBlock* next;
+    };
+
+    bool pooled(std::size_t bytes, std::size_t alignment) const;
+
+    // give all slabs back to the heap, called with m_mutex held once no block is in use
+    void releaseSlabs();
+
+    mutable std::mutex m_mutex;
+    std::size_t m_initialSlabSize;
+    std::size_t m_maxSlabSize;
+    std::size_t m_nextSlabSize;
+    std::vector<std::unique_ptr<std::byte[]>> m_slabs;
+    std::byte* m_slabPos = nullptr;
+    std::byte* m_slabEnd = nullptr;
+    // indexed by block size in units of blockAlignment
+    std::vector<FreeBlock*> m_freeLists;
+    std::size_t m_numAllocations = 0;
+    std::size_t m_numBlocksInUse = 0;
+  };
+
+  /** Standard allocator over a shared WorkspaceObjectPool, for use with std::allocate_shared.
+   *  Each allocation keeps the pool alive, so objects may outlive their Workspace. */
+  template <class T>
+  class WorkspaceObjectPoolAllocator
+  {
+   public:
+    using value_type = T;
+
+    explicit WorkspaceObjectPoolAllocator(std::shared_ptr<WorkspaceObjectPool> pool) : m_pool(std::move(pool)) {}
+
+    template <class U>
+    WorkspaceObjectPoolAllocator(const WorkspaceObjectPoolAllocator<U>& other) : m_pool(other.pool()) {}
+
+    T* allocate(std::size_t n) {
+      return static_cast<T*>(m_pool->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+      m_pool->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    const std::shared_ptr<WorkspaceObjectPool>& pool() const {
+      return m_pool;
+    }
+
+    template <class U>
+    bool operator==(const WorkspaceObjectPoolAllocator<U>& other) const {
+      return m_pool == other.pool();
+    }
+
+    template <class U>
+    bool operator!=(const WorkspaceObjectPoolAllocator<U>& other) const {
+      return m_pool != other.pool();
+    }
+
+   private:
+    std::shared_ptr<WorkspaceObjectPool> m_pool;
+  };
+
+}  // namespace detail
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDF_WORKSPACEOBJECTPOOL_HPP
@@ -11,6 +11,11 @@
 
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
+#include <utilities/idd/IddEnums.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
 
 namespace openstudio {
 
@@ -22,6 +27,91 @@ namespace detail {
 
   class Workspace_Impl;  // forward declaration
 
+  /** Set of pointers kept as a vector sorted by Compare. Pointer sets are small and mostly read,
+   *  so a contiguous vector beats a node-based std::set on lookups and iteration. Iterators are
+   *  invalidated by insert and erase. */
+  template <class T, class Compare>
+  class SortedPointerVector
+  {
+   public:
+    using value_type = T;
+    using key_compare = Compare;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+    using size_type = typename std::vector<T>::size_type;
+
+    iterator begin() {
+      return m_pointers.begin();
+    }
+    const_iterator begin() const {
+      return m_pointers.begin();
+    }
+    iterator end() {
+      return m_pointers.end();
+    }
+    const_iterator end() const {
+      return m_pointers.end();
+    }
+
+    size_type size() const {
+      return m_pointers.size();
+    }
+    bool empty() const {
+      return m_pointers.empty();
+    }
+    void clear() {
+      m_pointers.clear();
+    }
+
+    template <class Key>
+    iterator lower_bound(const Key& key) {
+      return std::lower_bound(m_pointers.begin(), m_pointers.end(), key, Compare());
+    }
+    template <class Key>
+    const_iterator lower_bound(const Key& key) const {
+      return std::lower_bound(m_pointers.begin(), m_pointers.end(), key, Compare());
+    }
+    template <class Key>
+    iterator upper_bound(const Key& key) {
+      return std::upper_bound(m_pointers.begin(), m_pointers.end(), key, Compare());
+    }
+    template <class Key>
+    const_iterator upper_bound(const Key& key) const {
+      return std::upper_bound(m_pointers.begin(), m_pointers.end(), key, Compare());
+    }
+
+    template <class Key>
+    iterator find(const Key& key) {
+      auto it = lower_bound(key);
+      return ((it != m_pointers.end()) && !Compare()(key, *it)) ? it : m_pointers.end();
+    }
+    template <class Key>
+    const_iterator find(const Key& key) const {
+      auto it = lower_bound(key);
+      return ((it != m_pointers.end()) && !Compare()(key, *it)) ? it : m_pointers.end();
+    }
+
+    /** Inserts value unless an equivalent pointer is already in the set. */
+    std::pair<iterator, bool> insert(const T& value) {
+      auto it = lower_bound(value);
+      if ((it != m_pointers.end()) && !Compare()(value, *it)) {
+        return {it, false};
+      }
+      return {m_pointers.insert(it, value), true};
+    }
+
+    iterator erase(const_iterator it) {
+      return m_pointers.erase(it);
+    }
+
+    void reserve(size_type n) {
+      m_pointers.reserve(n);
+    }
+
+   private:
+    std::vector<T> m_pointers;
+  };
+
   struct UTILITIES_API ForwardPointer
   {
     unsigned fieldIndex;
@@ -32,7 +122,20 @@ namespace detail {
     ForwardPointer() : fieldIndex(0) {}
     ForwardPointer(unsigned i, const Handle& h) : fieldIndex(i), targetHandle(h) {}
   };
-  using ForwardPointerSet = std::set<ForwardPointer, FieldIndexLess<ForwardPointer>>;
+  struct UTILITIES_API ForwardPointerLess
+  {
+    bool operator()(const ForwardPointer& left, const ForwardPointer& right) const {
+      return (left.fieldIndex < right.fieldIndex);
+    }
+    bool operator()(const ForwardPointer& left, unsigned fieldIndex) const {
+      return (left.fieldIndex < fieldIndex);
+    }
+    bool operator()(unsigned fieldIndex, const ForwardPointer& right) const {
+      return (fieldIndex < right.fieldIndex);
+    }
+  };
+  /** Sorted by field index, so the pointer in a field is found by binary search. */
+  using ForwardPointerSet = SortedPointerVector<ForwardPointer, ForwardPointerLess>;
 
   struct UTILITIES_API SourceData
   {
@@ -49,21 +152,32 @@ namespace detail {
   {
     Handle sourceHandle;
     unsigned fieldIndex;
+    IddObjectType sourceType;
 
     ReversePointer() : fieldIndex(0) {}
-    ReversePointer(const Handle& h, unsigned i) : sourceHandle(h), fieldIndex(i) {}
+    ReversePointer(const Handle& h, unsigned i, IddObjectType t) : sourceHandle(h), fieldIndex(i), sourceType(t) {}
   };
   struct UTILITIES_API ReversePointerLess
   {
     bool operator()(const ReversePointer& left, const ReversePointer& right) const {
+      if (left.sourceType != right.sourceType) {
+        return (left.sourceType < right.sourceType);
+      }
       if (left.sourceHandle == right.sourceHandle) {
         return (left.fieldIndex < right.fieldIndex);
       } else {
         return (left.sourceHandle < right.sourceHandle);
       }
     }
+    bool operator()(const ReversePointer& left, IddObjectType sourceType) const {
+      return (left.sourceType < sourceType);
+    }
+    bool operator()(IddObjectType sourceType, const ReversePointer& right) const {
+      return (sourceType < right.sourceType);
+    }
   };
-  using ReversePointerSet = std::set<ReversePointer, ReversePointerLess>;
+  /** Sorted by source IddObjectType first, so the sources of one type are a contiguous range. */
+  using ReversePointerSet = SortedPointerVector<ReversePointer, ReversePointerLess>;
 
   struct UTILITIES_API TargetData
   {
@@ -86,6 +200,17 @@ namespace detail {
                         [fieldIndex](const auto& ptr_type) { return fieldIndexEqualTo<typename T::pointer_type>(ptr_type, fieldIndex); });
   }
 
+  // forward pointers are sorted by field index
+  template <>
+  inline ForwardPointerSet::iterator getIteratorAtFieldIndex<SourceData>(ForwardPointerSet& pointerSet, unsigned fieldIndex) {
+    return pointerSet.find(fieldIndex);
+  }
+
+  template <>
+  inline ForwardPointerSet::const_iterator getConstIteratorAtFieldIndex<SourceData>(const ForwardPointerSet& pointerSet, unsigned fieldIndex) {
+    return pointerSet.find(fieldIndex);
+  }
+
   class UTILITIES_API WorkspaceObject_Impl : public IdfObject_Impl
   {
    public:
@@ -146,6 +271,12 @@ namespace detail {
     /** Returns the objects of type that point to this object. */
     std::vector<WorkspaceObject> getSources(IddObjectType type) const;
 
+    /** Returns the objects that point to this object and whose IddObjectType passes isWantedType.
+     *  isWantedType is only called on one source of each IddObjectType, the other sources of
+     *  that type are taken or skipped along with it. UserCustom and Catchall sources are checked
+     *  one by one, as they do not share an IddObject. */
+    std::vector<WorkspaceObject> getSourcesOfTypes(const std::function<bool(const WorkspaceObject&)>& isWantedType) const;
+
     /** Provided for Workspace_Impl to get easy access to targetData. */
     ReversePointerSet getReversePointers() const;
 
@@ -284,12 +415,16 @@ namespace detail {
     /** Disconnects this object from its workspace. Nullifies m_workspace and m_handle. */
     void disconnect();
 
+    /** Undoes disconnect, for objects put back when a WorkspaceTransaction is aborted. Forgets the
+     *  changes made to the object while it was being removed. */
+    void reconnect(Workspace_Impl* workspace, const Handle& handle);
+
     /** Mechanics only exposed to Workspace_Impl for use in object removal. */
     void nullifyPointer(unsigned index);
 
-    void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
+    void nullifyReversePointer(const Handle& sourceHandle, unsigned index, IddObjectType sourceType);
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    void setReversePointer(const Handle& sourceHandle, unsigned index, IddObjectType sourceType);
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
@@ -311,8 +446,14 @@ namespace detail {
 
     virtual bool fieldIsNonnullIfRequired(unsigned index) const override;
 
+    // SETTER HELPERS
+
+    /** Updates the Workspace's name index. */
+    virtual void nameFieldChanged() override;
+
    private:
     bool m_initialized;
+    unsigned m_numFieldsAtLastChange;  // number of fields when m_diffs was last emptied, for WorkspaceTransaction::abort
     Workspace_Impl* m_workspace;
     OptionalSourceData m_sourceData;
     OptionalTargetData m_targetData;
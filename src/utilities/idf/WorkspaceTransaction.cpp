@@ -0,0 +1,55 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "WorkspaceTransaction.hpp"
+#include "Workspace_Impl.hpp"
+#include "../core/Assert.hpp"
+
+#include <exception>
+
+namespace openstudio {
+
+WorkspaceTransaction::WorkspaceTransaction(const Workspace& workspace)
+  : m_impl(workspace.getImpl<detail::Workspace_Impl>()),
+    m_savepoint(m_impl->startBatch()),
+    m_uncaughtExceptions(std::uncaught_exceptions()),
+    m_open(true) {}
+
+WorkspaceTransaction::~WorkspaceTransaction() {
+  if (!m_open) {
+    return;
+  }
+  try {
+    if (std::uncaught_exceptions() > m_uncaughtExceptions) {
+      abort();
+    } else {
+      commit();
+    }
+  } catch (const std::exception& e) {
+    LOG(Error, "Unable to close WorkspaceTransaction: " << e.what());
+  }
+}
+
+void WorkspaceTransaction::commit() {
+  if (!m_open) {
+    return;
+  }
+  m_open = false;
+  m_impl->commitBatch();
+}
+
+void WorkspaceTransaction::abort() {
+  if (!m_open) {
+    return;
+  }
+  m_open = false;
+  m_impl->abortBatch(m_savepoint);
+}
+
+bool WorkspaceTransaction::isOpen() const {
+  return m_open;
+}
+
+}  // namespace openstudio
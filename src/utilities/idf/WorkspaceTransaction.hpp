@@ -0,0 +1,77 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_WORKSPACETRANSACTION_HPP
+#define UTILITIES_IDF_WORKSPACETRANSACTION_HPP
+
+#include <utilities/UtilitiesAPI.hpp>
+#include <utilities/idf/Workspace.hpp>
+
+#include <memory>
+
+namespace openstudio {
+
+namespace detail {
+  class Workspace_Impl;
+}
+
+/** WorkspaceTransaction is a bulk edit scope on a Workspace. While it is open, the name, data and
+ *  relationship signals of the Workspace's objects, and the add and change signals of the
+ *  Workspace, are held back and then delivered once per object and kind when the transaction is
+ *  committed. Watchers such as WorkspaceWatcher and ComponentWatcher then react once to many edits
+ *  instead of once per field. Object onChange, Workspace onImmediateChange and remove signals are
+ *  still emitted immediately, so caches are cleared as soon as something changes.
+ *
+ *  abort undoes every change made since the transaction was opened; objects removed in the
+ *  meantime are put back as they were, so handles to them remain valid. The destructor commits an
+ *  open transaction, unless the scope is being left because of an exception, in which case it
+ *  aborts. Transactions nest; signals are only delivered when the outermost one commits, and
+ *  nested transactions must be closed before the ones that contain them. From Ruby or Python,
+ *  call commit or abort explicitly rather than relying on the destructor.
+ *
+ *  \code
+ *  {
+ *    WorkspaceTransaction transaction(model);
+ *    for (auto& space : model.getConcreteModelObjects<Space>()) {
+ *      space.setName(...);
+ *    }
+ *  } // one onNameChange per space, one onChange for the model
+ *  \endcode */
+class UTILITIES_API WorkspaceTransaction
+{
+ public:
+  /** Opens a transaction on workspace. */
+  explicit WorkspaceTransaction(const Workspace& workspace);
+
+  /** Commits the transaction if it is still open, or aborts it if an exception is being thrown. */
+  ~WorkspaceTransaction();
+
+  WorkspaceTransaction(const WorkspaceTransaction&) = delete;
+  WorkspaceTransaction& operator=(const WorkspaceTransaction&) = delete;
+
+  /** Keeps the changes, and delivers the held back signals if this is the outermost transaction.
+   *  Does nothing if the transaction is no longer open. */
+  void commit();
+
+  /** Undoes every change made since the transaction was opened: field changes are reverted, added
+   *  objects are removed and removed objects are added back. Object comments are not restored.
+   *  Does nothing if the transaction is no longer open. */
+  void abort();
+
+  /** Returns true until commit or abort is called. */
+  bool isOpen() const;
+
+ private:
+  std::shared_ptr<detail::Workspace_Impl> m_impl;
+  size_t m_savepoint;
+  int m_uncaughtExceptions;
+  bool m_open;
+
+  REGISTER_LOGGER("utilities.idf.WorkspaceTransaction");
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDF_WORKSPACETRANSACTION_HPP
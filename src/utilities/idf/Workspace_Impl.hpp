@@ -10,6 +10,7 @@
 
 #include <utilities/idf/WorkspaceObject_Impl.hpp>
 #include <utilities/idf/WorkspaceObjectOrder.hpp>
+#include <utilities/idf/WorkspaceObjectPool.hpp>
 #include <utilities/idf/ValidityEnums.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
@@ -25,6 +26,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <tuple>
 #include <unordered_map>
 
 namespace openstudio {
@@ -175,6 +177,16 @@ namespace detail {
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
+    /** Returns the pool this workspace allocates its objects from, if any. */
+    std::shared_ptr<WorkspaceObjectPool> objectPool() const;
+
+    /** Returns true if workspaces constructed from now on allocate their objects from a pool. */
+    static bool objectPoolingEnabled();
+
+    /** Sets whether workspaces constructed from now on allocate their objects from a pool. Existing
+     *  workspaces keep their setting. */
+    static void setObjectPoolingEnabled(bool enabled);
+
     //@}
     /** @name Setters */
     //@{
@@ -189,6 +201,16 @@ namespace detail {
     // Helper function to start the process of adding a cloned object to the workspace.
     virtual std::shared_ptr<WorkspaceObject_Impl> createObject(const std::shared_ptr<WorkspaceObject_Impl>& originalObjectImplPtr, bool keepHandle);
 
+    /** Constructs an object impl for this workspace, together with its reference count, in the
+     *  workspace's object pool if it has one. Use in createObject overrides instead of std::make_shared. */
+    template <class T, class... Args>
+    std::shared_ptr<T> makeObjectImpl(Args&&... args) const {
+      if (m_objectPool) {
+        return std::allocate_shared<T>(WorkspaceObjectPoolAllocator<T>(m_objectPool), std::forward<Args>(args)...);
+      }
+      return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
     virtual std::vector<WorkspaceObject> addObjects(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs, bool checkNames);
 
     virtual std::vector<WorkspaceObject> addObjects(std::vector<std::shared_ptr<WorkspaceObject_Impl>>& objectImplPtrs,
@@ -340,6 +362,10 @@ namespace detail {
     /** Return the number of objects of IddObjectType type in the workspace. */
     unsigned numObjectsOfType(IddObjectType type) const;
 
+    /** Return the IddObjectTypes that have at least one object in the workspace. Like objects(false), the type of the
+     *  version object is left out. */
+    std::vector<IddObjectType> iddObjectTypes() const;
+
     /** Return the number of objects by full IddObject type. */
     unsigned numObjectsOfType(const IddObject& objectType) const;
 
@@ -416,6 +442,12 @@ namespace detail {
     // void onChange() const;
     mutable Nano::Signal<void()> onChange;
 
+    /** Emitted on any change to this Workspace and its contents, like onChange, but never held back
+     *  by a WorkspaceTransaction. For clearing caches that must not be used once the Workspace has
+     *  changed, even in the middle of a transaction. */
+    // void onImmediateChange() const;
+    mutable Nano::Signal<void()> onImmediateChange;
+
     /** Send an object being deleted from the workspace. OS_ASSERT(!object.initialized())
      *  should pass, as should OS_ASSERT(object.handle().isNull()). */
     // void removeWorkspaceObject(const WorkspaceObject& object, const openstudio::IddObjectType& iddObjectType, const openstudio::UUID& handle) const;
@@ -440,6 +472,48 @@ namespace detail {
 
     void change();
 
+    /** Files the object with handle under its current name in the name indices. Called by
+     *  WorkspaceObject_Impl whenever its name field is written. Objects that have not been added
+     *  yet are ignored, they are indexed when they are added. */
+    void updateNameIndex(const Handle& handle);
+
+    /** Called by WorkspaceObject_Impl whenever fields of an object in this Workspace change, before
+     *  any signal is emitted and even while a batch is open. relationshipChanges holds the index, new
+     *  target and old target of each object list field that changed. Does nothing here, derived
+     *  classes use it to keep caches current without listening to every change. */
+    virtual void objectFieldsChange(const WorkspaceObject_Impl& object, const std::vector<std::tuple<unsigned, Handle, Handle>>& relationshipChanges);
+
+    /** @name Batched Signals
+     *
+     *  While a batch is open, the name, data and relationship signals of objects, the add signals
+     *  and onChange of this Workspace are held back and delivered once, coalesced per object and
+     *  kind, when the outermost batch is committed. Object onChange and Workspace onImmediateChange
+     *  are still emitted right away so that caches can be cleared. Remove signals are also emitted right away, since
+     *  they must be sent while the object is still in the Workspace. Use WorkspaceTransaction rather
+     *  than calling these directly. */
+    //@{
+
+    /** Opens a batch, batches nest. Returns a savepoint that abortBatch can return to. */
+    size_t startBatch();
+
+    /** Closes the innermost batch. Held back signals are delivered if it was the outermost one. */
+    void commitBatch();
+
+    /** Closes the innermost batch, undoing every change made since savepoint: field changes are
+     *  reverted, added objects are removed and removed objects are added back. Object comments
+     *  are not restored. */
+    void abortBatch(size_t savepoint);
+
+    /** Returns true if a batch is open. */
+    bool isBatchingSignals() const;
+
+    /** Holds back the signals for diffs, called by WorkspaceObject_Impl::emitChangeSignals. numFields is the number of
+     *  fields the object had before the changes in diffs. */
+    void batchChangeSignals(const std::shared_ptr<WorkspaceObject_Impl>& object, std::vector<IdfObjectDiff> diffs, unsigned numFields,
+                            bool nameChange, bool dataChange, const std::vector<std::tuple<unsigned, Handle, Handle>>& relationshipChanges);
+
+    //@}
+
    protected:
     // helper for non-virtual part of clone implementation
     void createAndAddClonedObjects(const std::shared_ptr<Workspace_Impl>& thisImpl, std::shared_ptr<Workspace_Impl> cloneImpl,
@@ -456,6 +530,7 @@ namespace detail {
     std::string m_header;                                 // header for the IdfFile
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper;  // IDD file to be used for validity checking
     bool m_fastNaming;
+    std::shared_ptr<WorkspaceObjectPool> m_objectPool;  // shared with the objects allocated from it, may be null
 
     using WorkspaceObjectMap = std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid>>;
     WorkspaceObjectMap m_workspaceObjectMap;
@@ -471,6 +546,14 @@ namespace detail {
     using IdfReferencesMap = std::unordered_map<std::string, WorkspaceObjectMap>;  // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // case insensitive maps of name, and of base name (see getBaseName), to set of objects identified
+    // by UUID. objects with empty names are not indexed. the key each object is filed under is kept
+    // in m_nameIndexKeys so that the object can be found again after its name changes.
+    using NameIndex = std::unordered_map<std::string, WorkspaceObjectMap>;
+    NameIndex m_nameIndex;
+    NameIndex m_baseNameIndex;
+    std::unordered_map<Handle, std::string, boost::hash<boost::uuids::uuid>> m_nameIndexKeys;
+
     // data object for undos
     struct SavedWorkspaceObject
     {
@@ -482,6 +565,41 @@ namespace detail {
     using OptionalSavedWorkspaceObject = boost::optional<SavedWorkspaceObject>;
     using SavedWorkspaceObjectVector = std::vector<SavedWorkspaceObject>;
 
+    // signals held back for one object while a batch is open
+    struct BatchedObjectSignals
+    {
+      std::shared_ptr<WorkspaceObject_Impl> object;
+      bool nameChange = false;
+      bool dataChange = false;
+      // field index to (new target, target before the batch)
+      std::map<unsigned, std::pair<Handle, Handle>> relationshipChanges;
+    };
+
+    // an object removed while a batch is open, kept so that aborting the batch can put the same object back
+    struct RemovedObject
+    {
+      SavedWorkspaceObject savedObject;
+      std::vector<std::pair<unsigned, Handle>> targets;  // pointer fields and their targets before removal
+    };
+
+    // one undoable change made while a batch is open
+    struct BatchedChange
+    {
+      Handle handle;                              // object whose fields changed, or that was added
+      std::vector<IdfObjectDiff> diffs;           // field changes, in the order they were made
+      unsigned numFields = 0;                     // number of fields of the object before the field changes
+      std::vector<RemovedObject> removedObjects;  // objects removed together
+      bool added = false;
+    };
+
+    unsigned m_batchDepth = 0;
+    bool m_revertingBatch = false;
+    bool m_batchedChange = false;
+    std::vector<BatchedObjectSignals> m_batchedObjectSignals;
+    std::unordered_map<const WorkspaceObject_Impl*, size_t> m_batchedObjectIndices;
+    std::vector<WorkspaceObject> m_batchedAdditions;
+    std::vector<BatchedChange> m_batchedChanges;
+
     // GETTERS
 
     // Change over from a HandleSet to a std::vector<Handle>.
@@ -498,6 +616,10 @@ namespace detail {
 
     boost::optional<WorkspaceObject> getEquivalentObject(const IdfObject& other) const;
 
+    /** Returns the objects filed under name in index. These are all of the objects that may match
+     *  name, callers must still compare the names. If name is empty, returns all objects. */
+    const WorkspaceObjectMap& nameIndexCandidates(const NameIndex& index, const std::string& name) const;
+
     // SETTERS
 
     // Replace m_iddFactoryWrapper if workspace remains valid.
@@ -512,6 +634,12 @@ namespace detail {
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object, const std::vector<std::string>& references);
+
+    void insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void eraseFromNameIndex(const Handle& handle);
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other, const std::vector<unsigned>& toIgnore);
 
@@ -544,7 +672,17 @@ namespace detail {
     void registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects, const std::vector<std::vector<WorkspaceObject>>& sources,
                                   const std::vector<Handle>& removedHandles);
 
-    void registerAdditionOfObject(const WorkspaceObject& object);
+    // restored is true if the object is being put back after a failed removal
+    void registerAdditionOfObject(const WorkspaceObject& object, bool restored = false);
+
+    // what is needed to put the object back if the batch is aborted
+    RemovedObject removedObject(const SavedWorkspaceObject& savedObject) const;
+
+    // undo change, while reverting a batch
+    void revertBatchedChange(const BatchedChange& change);
+
+    // deliver the signals held back by the outermost batch
+    void emitBatchedSignals();
 
     // QUERIES
 
@@ -6,6 +6,10 @@
 #include <benchmark/benchmark.h>
 
 #include "../IdfObject.hpp"
+#include "../IdfExtensibleGroup.hpp"
+
+#include "../../idd/IddEnums.hpp"
+#include <utilities/idd/IddEnums.hxx>
 
 #include <string>
 
@@ -41,3 +45,33 @@ static void BM_ParseAirLoopHVAC(benchmark::State& state) {
 };
 
 BENCHMARK(BM_ParseAirLoopHVAC);
+
+// Reads and writes the vertices of a surface, as the geometry code does
+static void BM_IdfObjectGetDouble(benchmark::State& state) {
+  IdfObject idfObject(IddObjectType::BuildingSurface_Detailed);
+  for (int i = 0; i < 20; ++i) {
+    idfObject.pushExtensibleGroup({"1.5", "-20.25", "3.048"});
+  }
+
+  for (auto _ : state) {
+    for (unsigned i = 11, n = idfObject.numFields(); i < n; ++i) {
+      benchmark::DoNotOptimize(idfObject.getDouble(i));
+    }
+  }
+}
+
+static void BM_IdfObjectSetDouble(benchmark::State& state) {
+  IdfObject idfObject(IddObjectType::BuildingSurface_Detailed);
+  for (int i = 0; i < 20; ++i) {
+    idfObject.pushExtensibleGroup({"1.5", "-20.25", "3.048"});
+  }
+
+  for (auto _ : state) {
+    for (unsigned i = 11, n = idfObject.numFields(); i < n; ++i) {
+      idfObject.setDouble(i, 0.1 * i);
+    }
+  }
+}
+
+BENCHMARK(BM_IdfObjectGetDouble);
+BENCHMARK(BM_IdfObjectSetDouble);
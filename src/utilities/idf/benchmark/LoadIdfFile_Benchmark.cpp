@@ -6,15 +6,51 @@
 #include <benchmark/benchmark.h>
 
 #include "../IdfFile.hpp"
+#include "../IdfObject.hpp"
+#include "../IdfRegex.hpp"
+#include "../IdfTokenizer.hpp"
+#include "../Workspace.hpp"
+#include "../Workspace_Impl.hpp"
 #include "../../core/Filesystem.hpp"
 #include "../../core/Assert.hpp"
+#include "../../idd/CommentRegex.hpp"
 
 #include <resources.hxx>
+#include <utilities/idd/IddEnums.hxx>
 
 #include <OpenStudio.hxx>
 
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/regex.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
 using namespace openstudio;
 
+// Count heap allocations so that the Workspace benchmarks can report them. Replacing the global operator new
+// only catches allocations made through this executable's operator new: on Windows each DLL links its own,
+// so allocations made inside openstudio_utilities.dll are not counted there and heap_allocations is too low
+static std::atomic<size_t> numHeapAllocations(0);
+
+void* operator new(std::size_t size) {
+  ++numHeapAllocations;
+  if (void* p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*size*/) noexcept {
+  std::free(p);
+}
+
 static void BM_LoadIdfFile(benchmark::State& state, const std::string& testCase) {
 
   path idfPath = resourcesPath() / toPath(testCase);
@@ -24,6 +60,157 @@ static void BM_LoadIdfFile(benchmark::State& state, const std::string& testCase)
   }
 }
 
+// Split a file into objects and field values without building any IdfObject, once with idfTokenizer as IdfFile::load
+// does and once with the idfRegex expressions the loader used before it, kept here only for comparison
+static void BM_ScanIdfTokenizer(benchmark::State& state, const std::string& testCase) {
+
+  openstudio::filesystem::ifstream file(resourcesPath() / toPath(testCase));
+  const std::string buffer = idfTokenizer::readBuffer(file);
+
+  for (auto _ : state) {
+    size_t numFields = 0;
+    idfTokenizer::LineReader reader(buffer);
+    std::string_view line;
+    while (reader.next(line)) {
+      if (idfTokenizer::lineType(line) != idfTokenizer::LineType::Content) {
+        continue;
+      }
+      std::string_view objectType;
+      benchmark::DoNotOptimize(idfTokenizer::objectType(line, objectType));
+      size_t objectBegin = reader.lineBegin();
+      bool foundEndLine = idfTokenizer::isObjectEnd(line);
+      while (!foundEndLine && reader.next(line)) {
+        foundEndLine = idfTokenizer::isObjectEnd(line);
+      }
+      std::string_view text = std::string_view(buffer).substr(objectBegin, reader.lineEnd() - objectBegin);
+      idfTokenizer::ObjectTokens tokens = idfTokenizer::scanObject(text);
+      idfTokenizer::FieldScanner scanner(tokens.fieldText);
+      idfTokenizer::FieldToken token;
+      while (scanner.next(token)) {
+        ++numFields;
+      }
+    }
+    benchmark::DoNotOptimize(numFields);
+  }
+}
+
+static void BM_ScanIdfRegex(benchmark::State& state, const std::string& testCase) {
+
+  openstudio::filesystem::ifstream file(resourcesPath() / toPath(testCase));
+  const std::string buffer = idfTokenizer::readBuffer(file);
+
+  for (auto _ : state) {
+    size_t numFields = 0;
+    std::istringstream is(buffer);
+    std::string line;
+    boost::smatch matches;
+    while (std::getline(is, line)) {
+      if (boost::regex_match(line, idfRegex::commentOnlyLine()) || boost::regex_match(line, commentRegex::whitespaceOnlyLine())) {
+        continue;
+      }
+      if (boost::regex_search(line, matches, idfRegex::line())) {
+        std::string objectType(matches[1].first, matches[1].second);
+        boost::trim(objectType);
+        benchmark::DoNotOptimize(objectType);
+      }
+      std::string text(line + idfRegex::newLinestring());
+      bool foundEndLine = boost::regex_match(line, idfRegex::objectEnd());
+      while (!foundEndLine && std::getline(is, line)) {
+        text += (line + idfRegex::newLinestring());
+        foundEndLine = boost::regex_match(line, idfRegex::objectEnd());
+      }
+      // the object type, then one field per match
+      size_t numMatches = 0;
+      std::string::const_iterator start = text.begin();
+      while (boost::regex_search(start, text.cend(), matches, idfRegex::line())) {
+        std::string fieldText(matches[1].first, matches[1].second);
+        boost::trim(fieldText);
+        std::string commentOrOtherText(matches[2].first, matches[2].second);
+        boost::trim(commentOrOtherText);
+        start = (commentOrOtherText.empty() || boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())) ? matches[3].first
+                                                                                                                      : matches[2].first;
+        ++numMatches;
+      }
+      if (numMatches > 0) {
+        numFields += numMatches - 1;
+      }
+    }
+    benchmark::DoNotOptimize(numFields);
+  }
+}
+
+// Load from a stream with a known IddFileType, as VersionTranslator does
+static void BM_LoadIdfFileFromStream(benchmark::State& state, const std::string& testCase, IddFileType iddFileType) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+
+  for (auto _ : state) {
+    openstudio::filesystem::ifstream file(idfPath);
+    OptionalIdfFile oIdfFile = IdfFile::load(file, iddFileType);
+  }
+}
+
+// One VersionTranslator hop: hand every object to the next version's IdfFile, either by printing and reloading
+// the text as the updaters used to or by copying the objects in memory with IdfFile::addObjectCopy
+static void BM_IdfFileHopPrintAndLoad(benchmark::State& state, const std::string& testCase, IddFileType iddFileType) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+  OptionalIdfFile oIdfFile = IdfFile::load(idfPath, iddFileType);
+  OS_ASSERT(oIdfFile);
+
+  for (auto _ : state) {
+    std::stringstream ss;
+    ss << *oIdfFile;
+    OptionalIdfFile result = IdfFile::load(ss, iddFileType);
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+static void BM_IdfFileHopAddObjectCopy(benchmark::State& state, const std::string& testCase, IddFileType iddFileType) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+  OptionalIdfFile oIdfFile = IdfFile::load(idfPath, iddFileType);
+  OS_ASSERT(oIdfFile);
+
+  for (auto _ : state) {
+    IdfFile result(iddFileType);
+    result.setHeader(oIdfFile->header());
+    for (const IdfObject& object : oIdfFile->objects()) {
+      result.addObjectCopy(object);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+// Build a Workspace from an already loaded IdfFile, with or without a per-Workspace object pool
+static void BM_LoadWorkspace(benchmark::State& state, const std::string& testCase, bool objectPooling) {
+
+  path idfPath = resourcesPath() / toPath(testCase);
+  OptionalIdfFile oIdfFile = IdfFile::load(idfPath);
+  OS_ASSERT(oIdfFile);
+
+  bool wasEnabled = Workspace::objectPoolingEnabled();
+  Workspace::setObjectPoolingEnabled(objectPooling);
+
+  size_t heapAllocations = 0;
+  size_t slabs = 0;
+  for (auto _ : state) {
+    size_t before = numHeapAllocations;
+    Workspace workspace(*oIdfFile);
+    heapAllocations += numHeapAllocations - before;
+    if (auto pool = workspace.getImpl<detail::Workspace_Impl>()->objectPool()) {
+      slabs += pool->numSlabs();
+    }
+    benchmark::DoNotOptimize(workspace);
+  }
+
+  Workspace::setObjectPoolingEnabled(wasEnabled);
+
+  state.counters["heap_allocations"] = benchmark::Counter(static_cast<double>(heapAllocations), benchmark::Counter::kAvgIterations);
+  state.counters["slabs"] = benchmark::Counter(static_cast<double>(slabs), benchmark::Counter::kAvgIterations);
+  state.counters["objects"] = static_cast<double>(oIdfFile->objects().size());
+}
+
 BENCHMARK_CAPTURE(BM_LoadIdfFile, 5ZoneAirCooled, std::string("energyplus/5ZoneAirCooled/in.idf"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_LoadIdfFile, Daylighting_School, std::string("energyplus/Daylighting_School/in.idf"))->Unit(benchmark::kMillisecond);
 BENCHMARK_CAPTURE(BM_LoadIdfFile, SmallOffice, std::string("energyplus/SmallOffice/SmallOffice.idf"))->Unit(benchmark::kMillisecond);
@@ -34,3 +221,34 @@ BENCHMARK_CAPTURE(BM_LoadIdfFile, RefBldgLargeOffice, std::string("energyplus/Re
 BENCHMARK_CAPTURE(BM_LoadIdfFile, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))->Unit(benchmark::kMillisecond);
 
 BENCHMARK_CAPTURE(BM_LoadIdfFile, exampleModel_osm, std::string("model/exampleModel.osm"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_ScanIdfTokenizer, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ScanIdfRegex, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ScanIdfTokenizer, exampleModel_osm, std::string("model/exampleModel.osm"))->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_ScanIdfRegex, exampleModel_osm, std::string("model/exampleModel.osm"))->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_LoadIdfFileFromStream, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"), IddFileType::EnergyPlus)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileFromStream, RefBldgLargeOffice, std::string("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf"),
+                  IddFileType::EnergyPlus)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadIdfFileFromStream, exampleModel_osm, std::string("model/exampleModel.osm"), IddFileType::OpenStudio)
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_IdfFileHopPrintAndLoad, exampleModel_osm, std::string("model/exampleModel.osm"), IddFileType::OpenStudio)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IdfFileHopAddObjectCopy, exampleModel_osm, std::string("model/exampleModel.osm"), IddFileType::OpenStudio)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IdfFileHopPrintAndLoad, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"), IddFileType::EnergyPlus)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_IdfFileHopAddObjectCopy, HospitalBaseline, std::string("energyplus/HospitalBaseline/in.idf"), IddFileType::EnergyPlus)
+  ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_LoadWorkspace, HospitalBaseline_Pooled, std::string("energyplus/HospitalBaseline/in.idf"), true)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadWorkspace, HospitalBaseline_Unpooled, std::string("energyplus/HospitalBaseline/in.idf"), false)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadWorkspace, RefBldgLargeOffice_Pooled, std::string("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf"), true)
+  ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_LoadWorkspace, RefBldgLargeOffice_Unpooled, std::string("energyplus/RefLargeOffice/RefBldgLargeOfficeNew2004_Chicago.idf"),
+                  false)
+  ->Unit(benchmark::kMillisecond);
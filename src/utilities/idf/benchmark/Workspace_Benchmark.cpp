@@ -89,6 +89,26 @@ static void BM_WorkspaceSetNameWithoutAnyChecks(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// Looks up every Space by type and by name, as ForwardTranslator and measures do
+static void BM_WorkspaceGetObjectByName(benchmark::State& state) {
+  Workspace w = setUpWorkspaceWithNObjectsOfEveryType(state.range(0));
+
+  std::vector<std::string> names;
+  for (const auto& obj : w.getObjectsByType(IddObjectType::OS_Space)) {
+    names.push_back(obj.nameString());
+  }
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    for (const auto& name : names) {
+      benchmark::DoNotOptimize(w.getObjectByTypeAndName(IddObjectType::OS_Space, name));
+      benchmark::DoNotOptimize(w.getObjectsByName(name));
+    }
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -99,3 +119,5 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->A
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
 
 BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
+
+BENCHMARK(BM_WorkspaceGetObjectByName)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(2, 2048)->Complexity();
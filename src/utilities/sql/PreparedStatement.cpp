@@ -52,6 +52,11 @@ int PreparedStatement::execute() {
   return code;
 }
 
+void PreparedStatement::reset() {
+  sqlite3_reset(m_statement);
+  sqlite3_clear_bindings(m_statement);
+}
+
 boost::optional<double> PreparedStatement::execAndReturnFirstDouble() const {
   boost::optional<double> value;
   if (m_db) {
@@ -59,6 +64,8 @@ boost::optional<double> PreparedStatement::execAndReturnFirstDouble() const {
     if (code == SQLITE_ROW) {
       value = sqlite3_column_double(m_statement, 0);
     }
+    // reset so that the statement can be executed again
+    sqlite3_reset(m_statement);
   }
   return value;
 }
@@ -70,6 +77,8 @@ boost::optional<int> PreparedStatement::execAndReturnFirstInt() const {
     if (code == SQLITE_ROW) {
       value = sqlite3_column_int(m_statement, 0);
     }
+    // reset so that the statement can be executed again
+    sqlite3_reset(m_statement);
   }
   return value;
 }
@@ -81,6 +90,8 @@ boost::optional<std::string> PreparedStatement::execAndReturnFirstString() const
     if (code == SQLITE_ROW) {
       value = columnText(sqlite3_column_text(m_statement, 0));
     }
+    // reset so that the statement can be executed again
+    sqlite3_reset(m_statement);
   }
   return value;
 }
@@ -108,6 +119,7 @@ boost::optional<std::vector<double>> PreparedStatement::execAndReturnVectorOfDou
       }
 
     }  // end loop
+    sqlite3_reset(m_statement);
   }
 
   return valueVector;
@@ -135,6 +147,7 @@ boost::optional<std::vector<int>> PreparedStatement::execAndReturnVectorOfInt()
       }
 
     }  // end loop
+    sqlite3_reset(m_statement);
   }
 
   return valueVector;
@@ -162,6 +175,7 @@ boost::optional<std::vector<std::string>> PreparedStatement::execAndReturnVector
       }
 
     }  // end loop
+    sqlite3_reset(m_statement);
   }
   return valueVector;
 }
@@ -114,6 +114,9 @@ class UTILITIES_API PreparedStatement
   // Executes a **SINGLE** statement
   int execute();
 
+  // Resets the statement so it can be executed again and clears its bindings
+  void reset();
+
   [[nodiscard]] boost::optional<double> execAndReturnFirstDouble() const;
 
   [[nodiscard]] boost::optional<int> execAndReturnFirstInt() const;
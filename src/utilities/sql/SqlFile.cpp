@@ -2139,6 +2139,15 @@ SqlFileTimeSeriesQueryVector SqlFile::expandQuery(const SqlFileTimeSeriesQuery&
   return result;
 }
 
+Matrix SqlFile::timeSeriesValues(const std::string& envPeriod, const std::string& reportingFrequency,
+                                 const std::vector<std::string>& timeSeriesNames, const std::vector<std::string>& keyValues) {
+  Matrix result;
+  if (m_impl) {
+    result = m_impl->timeSeriesValues(envPeriod, reportingFrequency, timeSeriesNames, keyValues);
+  }
+  return result;
+}
+
 TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   TimeSeriesVector result;
   if (m_impl) {
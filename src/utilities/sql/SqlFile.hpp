@@ -1126,6 +1126,14 @@ class UTILITIES_API SqlFile
   boost::optional<TimeSeries> timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName,
                                          const std::string& keyValue);
 
+  /** Returns the values of several time series matching envPeriod and reportingFrequency as a Matrix with one row per time step
+   *  and one column per (timeSeriesNames[i], keyValues[i]) pair. The rows are the time steps of
+   *  timeSeries(envPeriod, reportingFrequency, timeSeriesNames[i], keyValues[i]) for any i. All the values are read in a single
+   *  query per data table, which is much faster than calling timeSeries for each pair when many variables are needed.
+   *  Returns an empty Matrix if a pair is not found or if the time series are not reported at the same time steps. */
+  Matrix timeSeriesValues(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::string>& timeSeriesNames,
+                          const std::vector<std::string>& keyValues);
+
   /** Expands query to create a vector of all matching queries. The returned queries will have
    *  one environment period, one reporting frequency, and one time series name specified. The
    *  returned queries will also be "vetted". */
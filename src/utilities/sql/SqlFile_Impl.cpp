@@ -425,12 +425,41 @@ namespace detail {
 
   bool SqlFile_Impl::close() {
     if (m_connectionOpen) {
+      clearStatementCache();
       sqlite3_close(m_db);
       m_connectionOpen = false;
     }
     return true;
   }
 
+  PreparedStatement& SqlFile_Impl::cachedStatement(const std::string& statement) const {
+    auto it = m_statementCacheIndex.find(statement);
+    if (it != m_statementCacheIndex.end()) {
+      // move to the front, it is now the most recently used
+      m_statementCache.splice(m_statementCache.begin(), m_statementCache, it->second);
+      PreparedStatement& stmt = *m_statementCache.front().second;
+      stmt.reset();
+      return stmt;
+    }
+
+    // prepare first, if this throws the cache is left untouched
+    auto stmt = std::make_unique<PreparedStatement>(statement, m_db, false);
+
+    if (m_statementCache.size() >= m_statementCacheSize) {
+      m_statementCacheIndex.erase(m_statementCache.back().first);
+      m_statementCache.pop_back();
+    }
+
+    m_statementCache.emplace_front(statement, std::move(stmt));
+    m_statementCacheIndex[statement] = m_statementCache.begin();
+    return *m_statementCache.front().second;
+  }
+
+  void SqlFile_Impl::clearStatementCache() const {
+    m_statementCacheIndex.clear();
+    m_statementCache.clear();
+  }
+
   bool SqlFile_Impl::reopen() {
     bool result = true;
     try {
@@ -452,6 +481,7 @@ namespace detail {
     m_connectionOpen = (code == 0);
     if (m_connectionOpen) {  // create index on dictionaryIndex for large table reportvariabledata
       if (!isValidConnection()) {
+        clearStatementCache();
         sqlite3_close(m_db);
         m_connectionOpen = false;
         throw openstudio::Exception("OpenStudio is not compatible with this file.");
@@ -1261,15 +1291,16 @@ namespace detail {
   boost::optional<EndUses> SqlFile_Impl::endUses() const {
     EndUses result;
 
+    // Same statement for every fuel type and category, so it is only prepared once
+    const std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
+                              "(ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName = ?) and (RowName = ?) and "
+                              "(Units = ?)";
+
     for (EndUseFuelType fuelType : result.fuelTypes()) {
       std::string units = result.getUnitsForFuelType(fuelType);
       for (EndUseCategoryType category : result.categories()) {
 
-        std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
-                            "(ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='"
-                            + fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-        boost::optional<double> value = execAndReturnFirstDouble(query);
+        boost::optional<double> value = execAndReturnFirstDouble(query, fuelType.valueDescription(), category.valueDescription(), units);
         OS_ASSERT(value);
 
         if (*value != 0.0) {
@@ -3279,6 +3310,135 @@ namespace detail {
     return ts;
   }
 
+  Matrix SqlFile_Impl::timeSeriesValues(const std::string& envPeriod, const std::string& reportingFrequency,
+                                        const std::vector<std::string>& timeSeriesNames, const std::vector<std::string>& keyValues) {
+    if (!m_db || timeSeriesNames.empty()) {
+      return {};
+    }
+
+    if (timeSeriesNames.size() != keyValues.size()) {
+      LOG(Error, "Got " << timeSeriesNames.size() << " time series names but " << keyValues.size() << " key values");
+      return {};
+    }
+
+    std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+    const auto& index = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+
+    // table -> dictionary index -> columns of the result holding that variable
+    std::map<std::string, std::map<int, std::vector<size_t>>> columnsByTable;
+    boost::optional<DataDictionaryItem> firstItem;
+    for (size_t i = 0; i < timeSeriesNames.size(); ++i) {
+      auto it = index.find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesNames[i], keyValues[i]));
+      if (it == index.end()) {
+        it = index.find(boost::make_tuple(queryEnvPeriod, reportingFrequency, timeSeriesNames[i], boost::to_upper_copy(keyValues[i])));
+      }
+      if (it == index.end()) {
+        LOG(Debug, "Tuple: " << queryEnvPeriod << ", " << reportingFrequency << ", " << timeSeriesNames[i] << ", " << keyValues[i]
+                             << " not found in data dictionary.");
+        return {};
+      }
+      if (!firstItem) {
+        firstItem = *it;
+      }
+      columnsByTable[it->table][it->recordIndex].push_back(i);
+    }
+
+    auto dictionaryIndexColumn = [](const std::string& table) {
+      return (table == "ReportMeterData") ? std::string("ReportMeterDataDictionaryIndex") : std::string("ReportVariableDataDictionaryIndex");
+    };
+
+    // every variable is reported at the same time steps, so the first one gives the number of rows
+    std::string countStatement = "SELECT COUNT(*) FROM " + firstItem->table + " dt INNER JOIN Time ON Time.TimeIndex = dt.TimeIndex WHERE dt."
+                                 + dictionaryIndexColumn(firstItem->table) + "=? AND Time.EnvironmentPeriodIndex=?";
+    boost::optional<int> nRows = execAndReturnFirstInt(countStatement, firstItem->recordIndex, firstItem->envPeriodIndex);
+    if (!nRows || (*nRows == 0)) {
+      return {};
+    }
+
+    const size_t nColumns = timeSeriesNames.size();
+    Matrix result(*nRows, nColumns);
+    std::vector<int> rowsFilled(nColumns, 0);
+    std::vector<int> timeIndices;
+    timeIndices.reserve(*nRows);
+
+    for (const auto& [table, columnsByDictionaryIndex] : columnsByTable) {
+      std::stringstream s;
+      s << "SELECT dt.TimeIndex, dt." << dictionaryIndexColumn(table) << ", dt.VariableValue FROM " << table;
+      s << " dt INNER JOIN Time ON Time.TimeIndex = dt.TimeIndex";
+      s << " WHERE dt." << dictionaryIndexColumn(table) << " IN (";
+      for (auto it = columnsByDictionaryIndex.begin(); it != columnsByDictionaryIndex.end(); ++it) {
+        if (it != columnsByDictionaryIndex.begin()) {
+          s << ", ";
+        }
+        s << it->first;
+      }
+      s << ") AND Time.EnvironmentPeriodIndex = " << firstItem->envPeriodIndex;
+      s << " ORDER BY dt.TimeIndex";
+
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      LOG(Debug, "SQL Query:" << '\n' << s.str());
+      if (sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
+        LOG(Error, "Error preparing statement for table " << table << ": " << sqlite3_errmsg(m_db));
+        sqlite3_finalize(sqlStmtPtr);
+        return {};
+      }
+
+      // the first table read sets the time index of each row, the others must match it
+      const bool setsRows = timeIndices.empty();
+      int row = -1;
+      bool consistent = true;
+      int code = sqlite3_step(sqlStmtPtr);
+      while (code == SQLITE_ROW) {
+        int timeIndex = sqlite3_column_int(sqlStmtPtr, 0);
+        if ((row < 0) || (timeIndex != timeIndices[row])) {
+          ++row;
+          if (setsRows && (row < *nRows)) {
+            timeIndices.push_back(timeIndex);
+          } else if ((row >= static_cast<int>(timeIndices.size())) || (timeIndices[row] != timeIndex)) {
+            consistent = false;
+            break;
+          }
+        }
+        auto columns = columnsByDictionaryIndex.find(sqlite3_column_int(sqlStmtPtr, 1));
+        if (columns != columnsByDictionaryIndex.end()) {
+          double value = sqlite3_column_double(sqlStmtPtr, 2);
+          for (size_t column : columns->second) {
+            // a gap or a second value at the same time step means this variable does not line up with the others
+            if (rowsFilled[column] != row) {
+              consistent = false;
+              break;
+            }
+            result(row, column) = value;
+            ++rowsFilled[column];
+          }
+        }
+        if (!consistent) {
+          break;
+        }
+        code = sqlite3_step(sqlStmtPtr);
+      }
+
+      // must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+
+      if (!consistent) {
+        LOG(Warn, "Time series for envPeriod = '" << queryEnvPeriod << "', reportingFrequency = '" << reportingFrequency
+                                                  << "' are not reported at the same time steps");
+        return {};
+      }
+    }
+
+    for (int filled : rowsFilled) {
+      if (filled != *nRows) {
+        LOG(Warn, "Time series for envPeriod = '" << queryEnvPeriod << "', reportingFrequency = '" << reportingFrequency
+                                                  << "' are not reported at the same time steps");
+        return {};
+      }
+    }
+
+    return result;
+  }
+
   SqlFileTimeSeriesQueryVector SqlFile_Impl::expandQuery(const SqlFileTimeSeriesQuery& query) {
 
     SqlFileTimeSeriesQueryVector result;
@@ -21,7 +21,10 @@
 
 #include <boost/optional.hpp>
 
+#include <list>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct sqlite3;
@@ -1074,6 +1077,11 @@ namespace detail {
     boost::optional<TimeSeries> timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName,
                                            const std::string& keyValue);
 
+    // return the values of several timeseries matching envPeriod and reportingFrequency, one column per (timeSeriesNames[i], keyValues[i])
+    // and one row per time step, read in a single pass over each data table
+    Matrix timeSeriesValues(const std::string& envPeriod, const std::string& reportingFrequency, const std::vector<std::string>& timeSeriesNames,
+                            const std::vector<std::string>& keyValues);
+
     /** Expands query to create a vector of all matching queries. The returned queries will have
        *  one environment period, one reporting frequency, and one time series name specified. The
        *  returned queries will also be "vetted". */
@@ -1178,7 +1186,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<double> execAndReturnFirstDouble(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
         return stmt.execAndReturnFirstDouble();
       }
       return boost::none;
@@ -1189,7 +1197,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<int> execAndReturnFirstInt(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
         return stmt.execAndReturnFirstInt();
       }
       return boost::none;
@@ -1200,7 +1208,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::string> execAndReturnFirstString(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
         return stmt.execAndReturnFirstString();
       }
       return boost::none;
@@ -1211,7 +1219,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<double>> execAndReturnVectorOfDouble(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
         return stmt.execAndReturnVectorOfDouble();
       }
       return boost::none;
@@ -1222,7 +1230,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<int>> execAndReturnVectorOfInt(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
         return stmt.execAndReturnVectorOfInt();
       }
       return boost::none;
@@ -1233,7 +1241,7 @@ namespace detail {
     template <typename... Args>
     boost::optional<std::vector<std::string>> execAndReturnVectorOfString(const std::string& statement, Args&&... args) const {
       if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
+        PreparedStatement& stmt = cachedStatement(statement, args...);
         return stmt.execAndReturnVectorOfString();
       }
       return boost::none;
@@ -1336,6 +1344,23 @@ namespace detail {
 
     void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
+    // returns the prepared statement for statement with args bound, reusing the one from an earlier call if it is still cached
+    // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
+    template <typename... Args>
+    PreparedStatement& cachedStatement(const std::string& statement, Args&&... args) const {
+      PreparedStatement& stmt = cachedStatement(statement);
+      if (!stmt.bindAll(args...)) {
+        throw std::runtime_error("Error bindings args with statement: " + statement);
+      }
+      return stmt;
+    }
+
+    // returns the reset prepared statement for statement, preparing it and evicting the least recently used one if needed
+    PreparedStatement& cachedStatement(const std::string& statement) const;
+
+    // finalizes all cached statements, must be done before the connection is closed
+    void clearStatementCache() const;
+
     openstudio::path m_path;
     bool m_connectionOpen;
     DataDictionaryTable m_dataDictionary;
@@ -1350,6 +1375,12 @@ namespace detail {
 
     bool m_illuminanceMapHasOnly2RefPts;
 
+    // read statements kept prepared across calls, most recently used first
+    using StatementCache = std::list<std::pair<std::string, std::unique_ptr<PreparedStatement>>>;
+    static constexpr size_t m_statementCacheSize = 64;
+    mutable StatementCache m_statementCache;
+    mutable std::unordered_map<std::string, StatementCache::iterator> m_statementCacheIndex;
+
     REGISTER_LOGGER("openstudio.energyplus.SqlFile");
   };
 
@@ -293,6 +293,126 @@ TEST_F(SqlFileFixture, CreateSqlFile) {
   }
 }
 
+TEST_F(SqlFileFixture, CreateSqlFile_TimeSeriesValues) {
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileTimeSeriesValuesTest.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+  c.standardHolidays();
+
+  TimeSeries timeSeries1(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(std::vector<double>{100, 10, 1, 100.5}), "lux");
+  TimeSeries timeSeries2(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(std::vector<double>{1, 2, 3, 4}), "lux");
+  TimeSeries timeSeries3(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(std::vector<double>{20.5, 21.5, 22.5}), "C");
+
+  {
+    openstudio::SqlFile sql(outfile, openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+                            openstudio::DateTime::now(), c);
+    EXPECT_TRUE(sql.connectionOpen());
+
+    sql.insertTimeSeriesData("Sum", "Zone", "Zone", "WINDOW 1", "Daylight Luminance", openstudio::ReportingFrequency::Hourly,
+                             boost::optional<std::string>(), "lux", timeSeries1);
+    sql.insertTimeSeriesData("Sum", "Zone", "Zone", "WINDOW 2", "Daylight Luminance", openstudio::ReportingFrequency::Hourly,
+                             boost::optional<std::string>(), "lux", timeSeries2);
+    sql.insertTimeSeriesData("Average", "Zone", "Zone", "ZONE 1", "Zone Mean Air Temperature", openstudio::ReportingFrequency::Hourly,
+                             boost::optional<std::string>(), "C", timeSeries3);
+  }
+
+  {
+    openstudio::SqlFile sql(outfile);
+    EXPECT_TRUE(sql.connectionOpen());
+    std::vector<std::string> envPeriods = sql.availableEnvPeriods();
+    ASSERT_EQ(1u, envPeriods.size());
+    std::vector<std::string> reportingFrequencies = sql.availableReportingFrequencies(envPeriods[0]);
+    ASSERT_EQ(1u, reportingFrequencies.size());
+
+    // Columns are in the order requested, the same variable can be asked for twice, key values are not case sensitive
+    Matrix values = sql.timeSeriesValues(envPeriods[0], reportingFrequencies[0], {"Daylight Luminance", "Daylight Luminance", "Daylight Luminance"},
+                                         {"WINDOW 2", "WINDOW 1", "Window 2"});
+    ASSERT_EQ(4u, values.size1());
+    ASSERT_EQ(3u, values.size2());
+    for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(timeSeries2.values()[i], values(i, 0));
+      EXPECT_EQ(timeSeries1.values()[i], values(i, 1));
+      EXPECT_EQ(timeSeries2.values()[i], values(i, 2));
+    }
+
+    // Matches what timeSeries returns for each variable
+    boost::optional<TimeSeries> ts = sql.timeSeries(envPeriods[0], reportingFrequencies[0], "Daylight Luminance", "WINDOW 1");
+    ASSERT_TRUE(ts);
+    ASSERT_EQ(ts->values().size(), values.size1());
+    for (unsigned i = 0; i < ts->values().size(); ++i) {
+      EXPECT_EQ(ts->values()[i], values(i, 1));
+    }
+
+    // Not reported at the same time steps
+    Matrix notAligned = sql.timeSeriesValues(envPeriods[0], reportingFrequencies[0], {"Daylight Luminance", "Zone Mean Air Temperature"},
+                                             {"WINDOW 1", "ZONE 1"});
+    EXPECT_EQ(0u, notAligned.size1());
+    notAligned = sql.timeSeriesValues(envPeriods[0], reportingFrequencies[0], {"Zone Mean Air Temperature", "Daylight Luminance"},
+                                      {"ZONE 1", "WINDOW 1"});
+    EXPECT_EQ(0u, notAligned.size1());
+
+    // Unknown variable, or names and key values that do not pair up
+    Matrix notFound = sql.timeSeriesValues(envPeriods[0], reportingFrequencies[0], {"Daylight Luminance", "NotAVariable"}, {"WINDOW 1", "WINDOW 1"});
+    EXPECT_EQ(0u, notFound.size1());
+    notFound = sql.timeSeriesValues(envPeriods[0], reportingFrequencies[0], {"Daylight Luminance"}, {"WINDOW 1", "WINDOW 2"});
+    EXPECT_EQ(0u, notFound.size1());
+  }
+}
+
+TEST_F(SqlFileFixture, CreateSqlFile_StatementCache) {
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileStatementCacheTest.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+  TimeSeries timeSeries(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(std::vector<double>{100, 10, 1, 100.5}), "lux");
+
+  openstudio::SqlFile sql(outfile, openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+                          openstudio::DateTime::now(), c);
+  ASSERT_TRUE(sql.connectionOpen());
+  sql.insertTimeSeriesData("Sum", "Zone", "Zone", "WINDOW 1", "Daylight Luminance", openstudio::ReportingFrequency::Hourly,
+                           boost::optional<std::string>(), "lux", timeSeries);
+
+  const std::string byIndex = "SELECT Value FROM ReportData WHERE ReportDataIndex = ?";
+  boost::optional<std::vector<int>> indices = sql.execAndReturnVectorOfInt("SELECT ReportDataIndex FROM ReportData ORDER BY ReportDataIndex");
+  ASSERT_TRUE(indices);
+  ASSERT_EQ(4u, indices->size());
+
+  // The same statement is reused with new bindings
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    for (unsigned i = 0; i < 4; ++i) {
+      boost::optional<double> value = sql.execAndReturnFirstDouble(byIndex, (*indices)[i]);
+      ASSERT_TRUE(value);
+      EXPECT_EQ(timeSeries.values()[i], *value);
+    }
+  }
+
+  // Only the first row was read, running it again starts over
+  const std::string allValues = "SELECT Value FROM ReportData ORDER BY ReportDataIndex";
+  EXPECT_EQ(100.0, sql.execAndReturnFirstDouble(allValues).get());
+  EXPECT_EQ(100.0, sql.execAndReturnFirstDouble(allValues).get());
+  EXPECT_EQ(4u, sql.execAndReturnVectorOfDouble(allValues)->size());
+
+  // Wrong number of bindings throws, and does not affect the next call
+  EXPECT_ANY_THROW(sql.execAndReturnFirstDouble(byIndex, (*indices)[0], (*indices)[1]));
+  EXPECT_EQ(10.0, sql.execAndReturnFirstDouble(byIndex, (*indices)[1]).get());
+
+  // More distinct statements than the cache holds
+  for (int i = 0; i < 200; ++i) {
+    EXPECT_EQ(i, sql.execAndReturnFirstInt("SELECT " + std::to_string(i)).get());
+  }
+  EXPECT_EQ(1.0, sql.execAndReturnFirstDouble(byIndex, (*indices)[2]).get());
+
+  // Cached statements do not survive the connection
+  EXPECT_TRUE(sql.close());
+  EXPECT_TRUE(sql.reopen());
+  EXPECT_EQ(100.5, sql.execAndReturnFirstDouble(byIndex, (*indices)[3]).get());
+}
+
 TEST_F(SqlFileFixture, AnnualTotalCosts) {
 
   struct SqlResults
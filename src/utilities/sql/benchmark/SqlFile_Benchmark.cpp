@@ -0,0 +1,58 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../SqlFile.hpp"
+#include "../../data/EndUses.hpp"
+#include "../../core/Assert.hpp"
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+static SqlFile openSqlFile() {
+  SqlFile sqlFile(resourcesPath() / toPath("energyplus/5ZoneAirCooled/eplusout.sql"));
+  OS_ASSERT(sqlFile.connectionOpen());
+  return sqlFile;
+}
+
+// Builds the EndUses object, which runs the same tabular query for every fuel type and category
+static void BM_SqlFileEndUses(benchmark::State& state) {
+  SqlFile sqlFile = openSqlFile();
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sqlFile.endUses());
+  }
+}
+
+// What a reporting measure typically does: many separate tabular getters
+static void BM_SqlFileTabularGetters(benchmark::State& state) {
+  SqlFile sqlFile = openSqlFile();
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sqlFile.netSiteEnergy());
+    benchmark::DoNotOptimize(sqlFile.totalSiteEnergy());
+    benchmark::DoNotOptimize(sqlFile.electricityHeating());
+    benchmark::DoNotOptimize(sqlFile.electricityCooling());
+    benchmark::DoNotOptimize(sqlFile.electricityInteriorLighting());
+    benchmark::DoNotOptimize(sqlFile.electricityFans());
+    benchmark::DoNotOptimize(sqlFile.naturalGasHeating());
+    benchmark::DoNotOptimize(sqlFile.hoursSimulated());
+    for (const auto& fuelType : EndUses::fuelTypes()) {
+      for (const auto& category : EndUses::categories()) {
+        for (int month = 1; month <= 12; ++month) {
+          benchmark::DoNotOptimize(sqlFile.energyConsumptionByMonth(fuelType, category, MonthOfYear(month)));
+        }
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_SqlFileEndUses)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_SqlFileTabularGetters)->Unit(benchmark::kMillisecond);
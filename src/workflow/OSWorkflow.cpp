@@ -78,7 +78,8 @@ OSWorkflow::OSWorkflow(const WorkflowRunOptions& t_workflowRunOptions, ScriptEng
     m_post_process_only(t_workflowRunOptions.post_process_only),
     m_show_stdout(t_workflowRunOptions.show_stdout),
     m_add_timings(t_workflowRunOptions.add_timings),
-    m_style_stdout(t_workflowRunOptions.style_stdout) {
+    m_style_stdout(t_workflowRunOptions.style_stdout),
+    m_share_energyplus_install(t_workflowRunOptions.share_energyplus_install) {
 
   runner.setRegisterMsgAlsoLogs(true);
 
@@ -71,6 +71,8 @@ class OSWorkflow
   bool m_detailed_timings = true;
   bool m_style_stdout = false;
 
+  bool m_share_energyplus_install = false;
+
   /** @name Jobs */
   //@{
   // Jobs
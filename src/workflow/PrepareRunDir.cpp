@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include "PrepareRunDir.hpp"
+
+#include "../utilities/core/ASCIIStrings.hpp"
+#include "../utilities/core/ApplicationPathHelpers.hpp"
+
+#include <fmt/format.h>
+
+#include <boost/regex.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string_view>
+
+namespace openstudio {
+namespace workflow {
+
+  namespace {
+
+    // Makes targetPath point to the same file as sourcePath, without copying its content when the filesystem allows it
+    void linkOrCopyFile(const openstudio::filesystem::path& sourcePath, const openstudio::filesystem::path& targetPath) {
+      boost::system::error_code ec;
+      boost::filesystem::remove(targetPath, ec);
+
+      boost::filesystem::create_hard_link(sourcePath, targetPath, ec);
+      if (!ec) {
+        return;
+      }
+
+      boost::filesystem::create_symlink(sourcePath, targetPath, ec);
+      if (!ec) {
+        return;
+      }
+
+      openstudio::filesystem::copy_file(sourcePath, targetPath, openstudio::filesystem::copy_options::overwrite_existing);
+    }
+
+  }  // namespace
+
+  PrepareRunDirResults::PrepareRunDirResults(openstudio::filesystem::path runDirPath, openstudio::filesystem::path energyPlusDirectory,
+                                             bool shareEnergyPlusInstall)
+    : m_runDirPath(std::move(runDirPath)), m_shareEnergyPlusInstall(shareEnergyPlusInstall) {
+    if (!m_shareEnergyPlusInstall) {
+      m_curDirPath = boost::filesystem::current_path();
+      LOG(Debug, "Original Directory: " << m_curDirPath);
+      LOG(Debug, "Changing To run directory: " << m_runDirPath);
+      boost::filesystem::current_path(m_runDirPath);
+    }
+
+    // TODO: is this really necessary?! the part that copies the idd ini epjson in particular I question
+    static constexpr std::array<std::string_view, 3> copyFileExtensions{".idd", ".ini", ".epjson"};
+#if defined _WIN32
+    static const boost::regex energyplusRegex(R"(^energyplus.exe$)");
+    static const boost::regex expandObjectsRegex(R"(^expandobjects.exe$)");
+#else
+    static const boost::regex energyplusRegex(R"(^energyplus\d{0,4}$)");
+    static const boost::regex expandObjectsRegex(R"(^expandobjects\d{0,4}$)");
+#endif
+    boost::smatch matches;
+
+    if (energyPlusDirectory.empty()) {
+      energyPlusDirectory = openstudio::getEnergyPlusDirectory();
+    }
+
+    for (const auto& dirEnt : openstudio::filesystem::directory_iterator{energyPlusDirectory}) {
+      const auto& dirEntryPath = dirEnt.path();
+      if (!openstudio::filesystem::is_regular_file(dirEntryPath)) {
+        continue;
+      }
+      auto lower_ext = openstudio::ascii_to_lower_copy(dirEntryPath.extension().string());
+      if (std::find(copyFileExtensions.cbegin(), copyFileExtensions.cend(), lower_ext) != copyFileExtensions.cend()) {
+        auto targetPath = m_runDirPath / dirEntryPath.filename();
+        if (m_shareEnergyPlusInstall) {
+          linkOrCopyFile(dirEntryPath, targetPath);
+        } else {
+          openstudio::filesystem::copy_file(dirEntryPath, targetPath, openstudio::filesystem::copy_options::overwrite_existing);
+        }
+        copiedEnergyPlusFiles.emplace_back(std::move(targetPath));
+      } else {
+        auto lower_filename = openstudio::ascii_to_lower_copy(dirEntryPath.filename().string());
+        if (boost::regex_match(lower_filename, matches, energyplusRegex)) {
+          energyPlusExe = dirEntryPath;
+        } else if (boost::regex_match(lower_filename, matches, expandObjectsRegex)) {
+          expandObjectsExe = dirEntryPath;
+        }
+      }
+    }
+
+    if (energyPlusExe.empty()) {
+      throw std::runtime_error(fmt::format("Could not find EnergyPlus executable in {}\n", energyPlusDirectory.string()));
+    }
+
+    if (expandObjectsExe.empty()) {
+      throw std::runtime_error(fmt::format("Could not find ExpandObjects executable in {}\n", energyPlusDirectory.string()));
+    }
+
+    // for (const auto& filePath : copiedEnergyPlusFiles) {
+    //   fmt::print("{}\n", filePath.string());
+    // }
+
+    LOG(Info, "EnergyPlus executable path is " << energyPlusExe);
+    LOG(Info, "ExpandObjects executable path is " << expandObjectsExe);
+  }
+
+  PrepareRunDirResults::~PrepareRunDirResults() {
+    // Removing a link leaves the file in the EnergyPlus install untouched
+    LOG(Info, "Removing any copied EnergyPlus files");
+    for (const auto& filePath : copiedEnergyPlusFiles) {
+      openstudio::filesystem::remove(filePath);
+    }
+
+    for (const auto& p : {m_runDirPath / "packaged_measures", m_runDirPath / "Energy+.ini"}) {
+      openstudio::filesystem::remove_all(p);
+    }
+
+    if (!m_shareEnergyPlusInstall) {
+      LOG(Debug, "Changing Current Directory back to: " << m_curDirPath);
+      boost::filesystem::current_path(m_curDirPath);
+    }
+  }
+
+  bool PrepareRunDirResults::shareEnergyPlusInstall() const {
+    return m_shareEnergyPlusInstall;
+  }
+
+}  // namespace workflow
+}  // namespace openstudio
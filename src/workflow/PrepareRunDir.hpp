@@ -0,0 +1,54 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#ifndef WORKFLOW_PREPARERUNDIR_HPP
+#define WORKFLOW_PREPARERUNDIR_HPP
+
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/Logger.hpp"
+
+#include <vector>
+
+namespace openstudio {
+namespace workflow {
+
+  /** PrepareRunDirResults is an RAII helper
+    * This will locate E+ exes, copy idd/epsjon to run Directory, and Chdir to the runDirectory.
+    * It uses RAII to cleanup after itself (remove copied files, chdir back to original directory)
+    *
+    * When shareEnergyPlusInstall is true, the idd/ini/epjson files are hard linked (or symlinked) from the EnergyPlus install
+    * instead of copied, and the current directory of the process is left alone: the caller must start ExpandObjects and
+    * EnergyPlus in runDirPath itself. This only covers the EnergyPlus step: OSWorkflow::applyMeasures still changes the current
+    * directory while each measure runs, so workflows with measures cannot run concurrently in the same process. */
+  struct PrepareRunDirResults
+  {
+    openstudio::filesystem::path energyPlusExe;                       // NOLINT(misc-non-private-member-variables-in-classes)
+    openstudio::filesystem::path expandObjectsExe;                    // NOLINT(misc-non-private-member-variables-in-classes)
+    std::vector<openstudio::filesystem::path> copiedEnergyPlusFiles;  // NOLINT(misc-non-private-member-variables-in-classes)
+
+    // Doing this with a destructor to ensure that the directory gets cleaned up even if I throw an exception, and I can't forget to do it
+    explicit PrepareRunDirResults(openstudio::filesystem::path runDirPath, openstudio::filesystem::path energyPlusDirectory = {},
+                                  bool shareEnergyPlusInstall = false);
+
+    PrepareRunDirResults(const PrepareRunDirResults&) = delete;
+    PrepareRunDirResults(PrepareRunDirResults&&) = delete;
+    PrepareRunDirResults& operator=(const PrepareRunDirResults&) = delete;
+    PrepareRunDirResults& operator=(PrepareRunDirResults&&) = delete;
+
+    ~PrepareRunDirResults();
+
+    bool shareEnergyPlusInstall() const;
+
+   private:
+    REGISTER_LOGGER("openstudio.OSWorkflow.prepareEnergyPlusDir");
+    openstudio::filesystem::path m_runDirPath;
+    openstudio::filesystem::path m_curDirPath;
+    bool m_shareEnergyPlusInstall;
+  };
+
+}  // namespace workflow
+}  // namespace openstudio
+
+#endif  // WORKFLOW_PREPARERUNDIR_HPP
@@ -5,6 +5,7 @@
 
 #include "OSWorkflow.hpp"
 
+#include "PrepareRunDir.hpp"
 #include "Util.hpp"
 
 #include "../model/Model.hpp"
@@ -35,104 +36,10 @@
 
 namespace openstudio {
 
-/** PrepareRunDirResults is an RAII helper
-  * This will locate E+ exes, copy idd/epsjon to run Directory, and Chdir to the runDirectory.
-  * It uses RAII to cleanup after itself (remove copied files, chdir back to original directory) */
-struct PrepareRunDirResults
-{
-  openstudio::filesystem::path energyPlusExe;                       // NOLINT(misc-non-private-member-variables-in-classes)
-  openstudio::filesystem::path expandObjectsExe;                    // NOLINT(misc-non-private-member-variables-in-classes)
-  std::vector<openstudio::filesystem::path> copiedEnergyPlusFiles;  // NOLINT(misc-non-private-member-variables-in-classes)
-
-  // Doing this with a destructor to ensure that the directory gets cleaned up even if I throw an exception, and I can't forget to do it
-  explicit PrepareRunDirResults(openstudio::filesystem::path runDirPath, openstudio::filesystem::path energyPlusDirectory = {})
-    : m_runDirPath(std::move(runDirPath)) {
-    LOG(Debug, "Original Directory: " << m_curDirPath);
-    LOG(Debug, "Changing To run directory: " << m_runDirPath);
-    boost::filesystem::current_path(m_runDirPath);
-
-    // TODO: is this really necessary?! the part that copies the idd ini epjson in particular I question
-    static constexpr std::array<std::string_view, 3> copyFileExtensions{".idd", ".ini", ".epjson"};
-#if defined _WIN32
-    static const boost::regex energyplusRegex(R"(^energyplus.exe$)");
-    static const boost::regex expandObjectsRegex(R"(^expandobjects.exe$)");
-#else
-    static const boost::regex energyplusRegex(R"(^energyplus\d{0,4}$)");
-    static const boost::regex expandObjectsRegex(R"(^expandobjects\d{0,4}$)");
-#endif
-    boost::smatch matches;
-
-    if (energyPlusDirectory.empty()) {
-      energyPlusDirectory = openstudio::getEnergyPlusDirectory();
-    }
-
-    for (const auto& dirEnt : openstudio::filesystem::directory_iterator{energyPlusDirectory}) {
-      const auto& dirEntryPath = dirEnt.path();
-      if (!openstudio::filesystem::is_regular_file(dirEntryPath)) {
-        continue;
-      }
-      auto lower_ext = openstudio::ascii_to_lower_copy(dirEntryPath.extension().string());
-      if (std::find(copyFileExtensions.cbegin(), copyFileExtensions.cend(), lower_ext) != copyFileExtensions.cend()) {
-        auto targetPath = m_runDirPath / dirEntryPath.filename();
-        openstudio::filesystem::copy_file(dirEntryPath, targetPath, openstudio::filesystem::copy_options::overwrite_existing);
-        copiedEnergyPlusFiles.emplace_back(std::move(targetPath));
-      } else {
-        auto lower_filename = openstudio::ascii_to_lower_copy(dirEntryPath.filename().string());
-        if (boost::regex_match(lower_filename, matches, energyplusRegex)) {
-          energyPlusExe = dirEntryPath;
-        } else if (boost::regex_match(lower_filename, matches, expandObjectsRegex)) {
-          expandObjectsExe = dirEntryPath;
-        }
-      }
-    }
-
-    if (energyPlusExe.empty()) {
-      throw std::runtime_error(fmt::format("Could not find EnergyPlus executable in {}\n", energyPlusDirectory.string()));
-    }
-
-    if (expandObjectsExe.empty()) {
-      throw std::runtime_error(fmt::format("Could not find ExpandObjects executable in {}\n", energyPlusDirectory.string()));
-    }
-
-    // for (const auto& filePath : copiedEnergyPlusFiles) {
-    //   fmt::print("{}\n", filePath.string());
-    // }
-
-    LOG(Info, "EnergyPlus executable path is " << energyPlusExe);
-    LOG(Info, "ExpandObjects executable path is " << expandObjectsExe);
-  }
-
-  PrepareRunDirResults(const PrepareRunDirResults&) noexcept = default;
-  PrepareRunDirResults(PrepareRunDirResults&&) noexcept = default;
-  PrepareRunDirResults& operator=(const PrepareRunDirResults&) noexcept = default;
-  PrepareRunDirResults& operator=(PrepareRunDirResults&&) noexcept = default;
-
-  ~PrepareRunDirResults() {
-    LOG(Info, "Removing any copied EnergyPlus files");
-    for (const auto& filePath : copiedEnergyPlusFiles) {
-      openstudio::filesystem::remove(filePath);
-    }
-
-    for (const auto& p : {m_runDirPath / "packaged_measures", m_runDirPath / "Energy+.ini"}) {
-      openstudio::filesystem::remove_all(p);
-    }
-
-    LOG(Debug, "Changing Current Directory back to: " << m_curDirPath);
-    boost::filesystem::current_path(m_curDirPath);
-  }
-
- private:
-  REGISTER_LOGGER("openstudio.OSWorkflow.prepareEnergyPlusDir");
-  openstudio::filesystem::path m_runDirPath;
-  openstudio::filesystem::path m_curDirPath = boost::filesystem::current_path();
-};
-
 void OSWorkflow::runEnergyPlus() {
 
   state = State::EnergyPlus;
 
-  constexpr bool useBoostProcess = true;
-
   if (runner.halted()) {
     LOG(Info, "Workflow halted, skipping the EnergyPlus simulation");
     return;
@@ -146,7 +53,7 @@ void OSWorkflow::runEnergyPlus() {
   // Eg here I'm supposed to wrap all of the above in a try/catch, so I can ensure that clean_directory is called, then reraise the exception...
   try {
     auto runDirPath = workflowJSON.absoluteRunDir();
-    PrepareRunDirResults runDirResults(runDirPath);
+    workflow::PrepareRunDirResults runDirResults(runDirPath, {}, m_share_energyplus_install);
     LOG(Info, "Starting simulation in run directory: " << runDirPath);
 
     auto inIDF = runDirPath / "in.idf";
@@ -158,16 +65,14 @@ void OSWorkflow::runEnergyPlus() {
     // TODO: workflow-gem was manually running expandObjects prior to the potential serialization to json
     // Should we rather pass -x to the E+ cmd line?
     if (!workflowJSON.runOptions()->skipExpandObjects()) {
-      const std::string cmd = fmt::format("\"{}\"", openstudio::toString(runDirResults.expandObjectsExe.native()));
-      LOG(Info, "Running command '" << cmd << "'");
+      LOG(Info, "Running command '\"" << openstudio::toString(runDirResults.expandObjectsExe.native()) << "\"'");
 
       int result = 0;
-      detailedTimeBlock("Running ExpandObjects", [this, /*&cmd,*/ &result, &runDirResults, &stdout_ofs] {
-        // result = std::system(cmd.c_str());
+      detailedTimeBlock("Running ExpandObjects", [this, &result, &runDirResults, &runDirPath, &stdout_ofs] {
         namespace bp = boost::process;
         bp::ipstream is;
         std::string line;
-        bp::child c(runDirResults.expandObjectsExe, bp::std_out > is);
+        bp::child c(runDirResults.expandObjectsExe, bp::std_out > is, bp::start_dir(runDirPath));
         while (c.running() && std::getline(is, line)) {
           stdout_ofs << openstudio::ascii_trim_right(line) << '\n';  // Fix for windows...
           if (m_show_stdout) {
@@ -207,33 +112,27 @@ void OSWorkflow::runEnergyPlus() {
 
     // TODO: eventually we should change this system call to be an API call to libenergyplusapi (but we need E+ to add cmake exports)
     // cf https://github.com/NREL/EnergyPlus/pull/9712 and my proof of concept at https://github.com/jmarrec/EnergyPlus-Cpp-Demo
-    const std::string cmd = fmt::format("\"{}\" {}", openstudio::toString(runDirResults.energyPlusExe.native()), inIDF.filename().string());
-    LOG(Info, "Running command '" << cmd << "'");
+    LOG(Info, "Running command '\"" << openstudio::toString(runDirResults.energyPlusExe.native()) << "\" " << inIDF.filename().string() << "'");
 
     // boost::process allows redirecting stdout / stderr easily, but I can no longer debug in LLDB, which is annoying
     // Edit: actually std::system has the same issue... it captures a SIGVTALRM
     // Disable with: `pro hand -p true -s false SIGVTALRM`
     int result = 0;
 
-    if constexpr (useBoostProcess) {
-      detailedTimeBlock("Running EnergyPlus", [this, /*&cmd,*/ &result, &runDirResults, &inIDF, &stdout_ofs] {
-        // result = std::system(cmd.c_str());
-        namespace bp = boost::process;
-        bp::ipstream is;
-        std::string line;
-        bp::child c(runDirResults.energyPlusExe, inIDF.filename(), (bp::std_out & bp::std_err) > is);
-        while (c.running() && std::getline(is, line)) {
-          stdout_ofs << openstudio::ascii_trim_right(line) << '\n';  // Fix for windows...
-          if (m_show_stdout) {
-            fmt::print("{}\n", line);
-          }
+    detailedTimeBlock("Running EnergyPlus", [this, &result, &runDirResults, &runDirPath, &inIDF, &stdout_ofs] {
+      namespace bp = boost::process;
+      bp::ipstream is;
+      std::string line;
+      bp::child c(runDirResults.energyPlusExe, inIDF.filename(), (bp::std_out & bp::std_err) > is, bp::start_dir(runDirPath));
+      while (c.running() && std::getline(is, line)) {
+        stdout_ofs << openstudio::ascii_trim_right(line) << '\n';  // Fix for windows...
+        if (m_show_stdout) {
+          fmt::print("{}\n", line);
         }
-        c.wait();
-        result = c.exit_code();
-      });
-    } else {
-      detailedTimeBlock("Running EnergyPlus", [&cmd, &result] { result = std::system(cmd.c_str()); });
-    }
+      }
+      c.wait();
+      result = c.exit_code();
+    });
 
     LOG(Info, "EnergyPlus returned '" << result << "'");
     if (result != 0) {
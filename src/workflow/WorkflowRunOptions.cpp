@@ -16,6 +16,7 @@ void WorkflowRunOptions::debug_print() const {
   fmt::print("show_stdout={}\n", this->show_stdout);
   fmt::print("add_timings={}\n", this->add_timings);
   fmt::print("style_stdout={}\n", this->style_stdout);
+  fmt::print("share_energyplus_install={}\n", this->share_energyplus_install);
   fmt::print("socket_port={}\n", this->socket_port);
 
   fmt::print("\nrunOptions={}\n", this->runOptions.string());
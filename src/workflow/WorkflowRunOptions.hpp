@@ -26,6 +26,9 @@ struct WorkflowRunOptions
   bool add_timings = false;
   bool style_stdout = false;
 
+  // Link the EnergyPlus support files into the run directory instead of copying them, and do not chdir for the EnergyPlus step
+  bool share_energyplus_install = false;
+
   // TODO: Remove
   unsigned socket_port = 0;
 
@@ -0,0 +1,60 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include "../PrepareRunDir.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <fmt/format.h>
+
+#include <fstream>
+#include <string>
+
+static void writeFile(const openstudio::path& p, size_t size) {
+  std::ofstream ofs(p.string(), std::ios::binary | std::ios::trunc);
+  const std::string chunk(1024, 'x');
+  for (size_t i = 0; i < size / chunk.size(); ++i) {
+    ofs << chunk;
+  }
+}
+
+// A fake EnergyPlus install with support files of realistic size
+static openstudio::path prepareEnergyPlusInstall(const openstudio::path& rootDir) {
+  auto installDir = rootDir / "EnergyPlus";
+  openstudio::filesystem::create_directories(installDir);
+  writeFile(installDir / "Energy+.idd", 5 * 1024 * 1024);
+  writeFile(installDir / "Energy+.schema.epJSON", 10 * 1024 * 1024);
+#if defined _WIN32
+  writeFile(installDir / "energyplus.exe", 1024);
+  writeFile(installDir / "ExpandObjects.exe", 1024);
+#else
+  writeFile(installDir / "energyplus", 1024);
+  writeFile(installDir / "ExpandObjects", 1024);
+#endif
+  return installDir;
+}
+
+static void BM_PrepareRunDir(benchmark::State& state) {
+  const bool shareEnergyPlusInstall = (state.range(0) != 0);
+  const auto rootDir = openstudio::filesystem::temp_directory_path() / boost::filesystem::unique_path("PrepareRunDir-%%%%-%%%%");
+  const auto installDir = prepareEnergyPlusInstall(rootDir);
+
+  int i = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    const auto runDirPath = rootDir / fmt::format("run{}", i++);
+    openstudio::filesystem::create_directories(runDirPath);
+    state.ResumeTiming();
+
+    openstudio::workflow::PrepareRunDirResults results(runDirPath, installDir, shareEnergyPlusInstall);
+    benchmark::DoNotOptimize(results.copiedEnergyPlusFiles);
+  }
+
+  openstudio::filesystem::remove_all(rootDir);
+}
+
+// 0: copy the support files, 1: share the EnergyPlus install
+BENCHMARK(BM_PrepareRunDir)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) Alliance for Sustainable Energy, LLC.
+*  See also https://openstudio.net/license
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../PrepareRunDir.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <fmt/format.h>
+
+#include <fstream>
+#include <string>
+
+using namespace openstudio;
+
+class PrepareRunDirFixture : public testing::Test
+{
+ protected:
+  // A fake EnergyPlus install with support files of realistic size
+  void SetUp() override {
+    m_rootDir = openstudio::filesystem::temp_directory_path() / boost::filesystem::unique_path("PrepareRunDir-%%%%-%%%%");
+    m_installDir = m_rootDir / "EnergyPlus";
+    openstudio::filesystem::create_directories(m_installDir);
+
+    writeFile(m_installDir / "Energy+.idd", 5 * 1024 * 1024);
+    writeFile(m_installDir / "Energy+.schema.epJSON", 10 * 1024 * 1024);
+#if defined _WIN32
+    writeFile(m_installDir / "energyplus.exe", 1024);
+    writeFile(m_installDir / "ExpandObjects.exe", 1024);
+#else
+    writeFile(m_installDir / "energyplus", 1024);
+    writeFile(m_installDir / "ExpandObjects", 1024);
+#endif
+  }
+
+  void TearDown() override {
+    openstudio::filesystem::remove_all(m_rootDir);
+  }
+
+  static void writeFile(const openstudio::path& p, size_t size) {
+    std::ofstream ofs(p.string(), std::ios::binary | std::ios::trunc);
+    const std::string chunk(1024, 'x');
+    for (size_t i = 0; i < size / chunk.size(); ++i) {
+      ofs << chunk;
+    }
+  }
+
+  openstudio::path runDir(int i) const {
+    auto result = m_rootDir / fmt::format("run{}", i);
+    openstudio::filesystem::create_directories(result);
+    return result;
+  }
+
+  openstudio::path m_rootDir;
+  openstudio::path m_installDir;
+};
+
+TEST_F(PrepareRunDirFixture, PrepareRunDir_Copy) {
+  const auto originalDir = boost::filesystem::current_path();
+  const auto runDirPath = runDir(0);
+  {
+    workflow::PrepareRunDirResults results(runDirPath, m_installDir);
+    EXPECT_FALSE(results.shareEnergyPlusInstall());
+    EXPECT_TRUE(openstudio::filesystem::equivalent(runDirPath, boost::filesystem::current_path()));
+    EXPECT_EQ(m_installDir / results.energyPlusExe.filename(), results.energyPlusExe);
+    ASSERT_EQ(2u, results.copiedEnergyPlusFiles.size());
+    for (const auto& p : results.copiedEnergyPlusFiles) {
+      EXPECT_TRUE(openstudio::filesystem::is_regular_file(p));
+      EXPECT_FALSE(openstudio::filesystem::equivalent(p, m_installDir / p.filename()));
+    }
+  }
+  EXPECT_EQ(originalDir, boost::filesystem::current_path());
+  EXPECT_FALSE(openstudio::filesystem::exists(runDirPath / "Energy+.idd"));
+}
+
+TEST_F(PrepareRunDirFixture, PrepareRunDir_Shared) {
+  const auto originalDir = boost::filesystem::current_path();
+  const auto runDirPath = runDir(0);
+  {
+    workflow::PrepareRunDirResults results(runDirPath, m_installDir, true);
+    EXPECT_TRUE(results.shareEnergyPlusInstall());
+    // the process wide current directory is left alone
+    EXPECT_EQ(originalDir, boost::filesystem::current_path());
+    ASSERT_EQ(2u, results.copiedEnergyPlusFiles.size());
+    for (const auto& p : results.copiedEnergyPlusFiles) {
+      EXPECT_TRUE(openstudio::filesystem::exists(p));
+      EXPECT_EQ(openstudio::filesystem::file_size(m_installDir / p.filename()), openstudio::filesystem::file_size(p));
+    }
+
+    // a second run directory can be prepared while the first one is still in use
+    workflow::PrepareRunDirResults otherResults(runDir(1), m_installDir, true);
+    EXPECT_EQ(2u, otherResults.copiedEnergyPlusFiles.size());
+  }
+  EXPECT_EQ(originalDir, boost::filesystem::current_path());
+  EXPECT_FALSE(openstudio::filesystem::exists(runDirPath / "Energy+.idd"));
+  EXPECT_FALSE(openstudio::filesystem::exists(runDirPath / "Energy+.schema.epJSON"));
+
+  // the install is untouched
+  EXPECT_EQ(5u * 1024 * 1024, openstudio::filesystem::file_size(m_installDir / "Energy+.idd"));
+  EXPECT_EQ(10u * 1024 * 1024, openstudio::filesystem::file_size(m_installDir / "Energy+.schema.epJSON"));
+}